@@ -27,6 +27,7 @@
 #include <crypto/xts.h>
 #include <asm/cpu_device_id.h>
 #include <asm/simd.h>
+#include <asm/unaligned.h>
 #include <crypto/scatterwalk.h>
 #include <crypto/internal/aead.h>
 #include <crypto/internal/simd.h>
@@ -1007,6 +1008,79 @@ static int xts_decrypt(struct skcipher_request *req)
 	return xts_crypt(req, false);
 }
 
+/*
+ * Batched XTS with plain64 tweaks, see struct xts_plain64_iv. A whole run
+ * of data units is done under one kernel_fpu_begin() per walk step instead
+ * of one request, walk and FPU section per sector.
+ */
+static int xts_plain64_crypt(struct skcipher_request *req, bool encrypt)
+{
+	struct crypto_skcipher *tfm = crypto_skcipher_reqtfm(req);
+	struct aesni_xts_ctx *ctx = crypto_skcipher_ctx(tfm);
+	const struct xts_plain64_iv *iv = (const void *)req->iv;
+	unsigned int du_size, du_done = 0;
+	struct skcipher_walk walk;
+	u8 tweak[AES_BLOCK_SIZE];
+	u64 sector;
+	int err;
+
+	/* 512 to 4096 byte data units, as used for disk sectors */
+	if (iv->du_bits < 9 || iv->du_bits > 12)
+		return -EINVAL;
+	du_size = 1U << iv->du_bits;
+	if (!req->cryptlen || req->cryptlen & (du_size - 1))
+		return -EINVAL;
+	sector = le64_to_cpu(iv->sector);
+
+	err = skcipher_walk_virt(&walk, req, false);
+
+	while (walk.nbytes > 0) {
+		unsigned int nbytes = walk.nbytes, left;
+		const u8 *src = walk.src.virt.addr;
+		u8 *dst = walk.dst.virt.addr;
+
+		if (nbytes < walk.total)
+			nbytes &= ~(AES_BLOCK_SIZE - 1);
+
+		kernel_fpu_begin();
+		for (left = nbytes; left; ) {
+			unsigned int len = min(left, du_size - du_done);
+
+			if (!du_done) {
+				memset(tweak, 0, sizeof(tweak));
+				put_unaligned_le64(sector++, tweak);
+				aesni_enc(aes_ctx(ctx->raw_tweak_ctx), tweak,
+					  tweak);
+			}
+			if (encrypt)
+				aesni_xts_encrypt(aes_ctx(ctx->raw_crypt_ctx),
+						  dst, src, len, tweak);
+			else
+				aesni_xts_decrypt(aes_ctx(ctx->raw_crypt_ctx),
+						  dst, src, len, tweak);
+			du_done = (du_done + len) & (du_size - 1);
+			src += len;
+			dst += len;
+			left -= len;
+		}
+		kernel_fpu_end();
+
+		err = skcipher_walk_done(&walk, walk.nbytes - nbytes);
+	}
+	memzero_explicit(tweak, sizeof(tweak));
+	return err;
+}
+
+static int xts_plain64_encrypt(struct skcipher_request *req)
+{
+	return xts_plain64_crypt(req, true);
+}
+
+static int xts_plain64_decrypt(struct skcipher_request *req)
+{
+	return xts_plain64_crypt(req, false);
+}
+
 static struct crypto_alg aesni_cipher_alg = {
 	.cra_name		= "aes",
 	.cra_driver_name	= "aes-aesni",
@@ -1111,6 +1185,22 @@ static struct skcipher_alg aesni_skciphers[] = {
 		.setkey		= xts_aesni_setkey,
 		.encrypt	= xts_encrypt,
 		.decrypt	= xts_decrypt,
+	}, {
+		.base = {
+			.cra_name		= "__xts-plain64(aes)",
+			.cra_driver_name	= "__xts-plain64-aes-aesni",
+			.cra_priority		= 401,
+			.cra_flags		= CRYPTO_ALG_INTERNAL,
+			.cra_blocksize		= AES_BLOCK_SIZE,
+			.cra_ctxsize		= XTS_AES_CTX_SIZE,
+			.cra_module		= THIS_MODULE,
+		},
+		.min_keysize	= 2 * AES_MIN_KEY_SIZE,
+		.max_keysize	= 2 * AES_MAX_KEY_SIZE,
+		.ivsize		= sizeof(struct xts_plain64_iv),
+		.setkey		= xts_aesni_setkey,
+		.encrypt	= xts_plain64_encrypt,
+		.decrypt	= xts_plain64_decrypt,
 	}
 };
 
@@ -314,13 +314,100 @@ static int sha256_ni_final(struct shash_desc *desc, u8 *out)
 	return sha256_ni_finup(desc, NULL, 0, out);
 }
 
+asmlinkage void sha256_ni_transform_2x(struct sha256_state *digest1,
+				       struct sha256_state *digest2,
+				       const u8 *data1, const u8 *data2,
+				       int blocks);
+
+/*
+ * Finish two messages that share the state in @desc, in lockstep so that every
+ * block of the two messages goes through sha256_ni_transform_2x().  This is
+ * the same sequence of steps as sha256_base_do_update() followed by
+ * sha256_base_do_finalize(), just applied to both messages at once.
+ */
+static int sha256_ni_finup_mb(struct shash_desc *desc,
+			      const u8 * const data[], unsigned int len,
+			      u8 * const outs[], unsigned int num_msgs)
+{
+	const int bit_offset = SHA256_BLOCK_SIZE - sizeof(__be64);
+	const struct sha256_state *sctx = shash_desc_ctx(desc);
+	unsigned int digest_size = crypto_shash_digestsize(desc->tfm);
+	unsigned int partial = sctx->count % SHA256_BLOCK_SIZE;
+	const u64 bitcount = (sctx->count + len) << 3;
+	const u8 *data1 = data[0], *data2 = data[1];
+	struct sha256_state sctx1, sctx2;
+	unsigned int blocks;
+	int i;
+
+	if (WARN_ON_ONCE(num_msgs != 2) || !crypto_simd_usable())
+		return -EOPNOTSUPP;
+
+	memcpy(&sctx1, sctx, sizeof(sctx1));
+	memcpy(&sctx2, sctx, sizeof(sctx2));
+
+	kernel_fpu_begin();
+
+	if (partial && partial + len >= SHA256_BLOCK_SIZE) {
+		unsigned int p = SHA256_BLOCK_SIZE - partial;
+
+		memcpy(sctx1.buf + partial, data1, p);
+		memcpy(sctx2.buf + partial, data2, p);
+		sha256_ni_transform_2x(&sctx1, &sctx2, sctx1.buf, sctx2.buf, 1);
+		data1 += p;
+		data2 += p;
+		len -= p;
+		partial = 0;
+	}
+
+	blocks = len / SHA256_BLOCK_SIZE;
+	if (blocks) {
+		sha256_ni_transform_2x(&sctx1, &sctx2, data1, data2, blocks);
+		data1 += blocks * SHA256_BLOCK_SIZE;
+		data2 += blocks * SHA256_BLOCK_SIZE;
+		len %= SHA256_BLOCK_SIZE;
+	}
+
+	memcpy(sctx1.buf + partial, data1, len);
+	memcpy(sctx2.buf + partial, data2, len);
+	partial += len;
+
+	/* Add the padding, which is the same for both messages */
+	sctx1.buf[partial] = 0x80;
+	sctx2.buf[partial] = 0x80;
+	partial++;
+	if (partial > bit_offset) {
+		memset(sctx1.buf + partial, 0, SHA256_BLOCK_SIZE - partial);
+		memset(sctx2.buf + partial, 0, SHA256_BLOCK_SIZE - partial);
+		sha256_ni_transform_2x(&sctx1, &sctx2, sctx1.buf, sctx2.buf, 1);
+		partial = 0;
+	}
+	memset(sctx1.buf + partial, 0, bit_offset - partial);
+	memset(sctx2.buf + partial, 0, bit_offset - partial);
+	put_unaligned_be64(bitcount, sctx1.buf + bit_offset);
+	put_unaligned_be64(bitcount, sctx2.buf + bit_offset);
+	sha256_ni_transform_2x(&sctx1, &sctx2, sctx1.buf, sctx2.buf, 1);
+
+	kernel_fpu_end();
+
+	for (i = 0; digest_size > 0; i++, digest_size -= sizeof(__be32)) {
+		put_unaligned_be32(sctx1.state[i], outs[0] + i * 4);
+		put_unaligned_be32(sctx2.state[i], outs[1] + i * 4);
+	}
+
+	memzero_explicit(&sctx1, sizeof(sctx1));
+	memzero_explicit(&sctx2, sizeof(sctx2));
+	return 0;
+}
+
 static struct shash_alg sha256_ni_algs[] = { {
 	.digestsize	=	SHA256_DIGEST_SIZE,
 	.init		=	sha256_base_init,
 	.update		=	sha256_ni_update,
 	.final		=	sha256_ni_final,
 	.finup		=	sha256_ni_finup,
+	.finup_mb	=	sha256_ni_finup_mb,
 	.descsize	=	sizeof(struct sha256_state),
+	.mb_max_msgs	=	2,
 	.base		=	{
 		.cra_name	=	"sha256",
 		.cra_driver_name =	"sha256-ni",
@@ -334,7 +421,9 @@ static struct shash_alg sha256_ni_algs[] = { {
 	.update		=	sha256_ni_update,
 	.final		=	sha256_ni_final,
 	.finup		=	sha256_ni_finup,
+	.finup_mb	=	sha256_ni_finup_mb,
 	.descsize	=	sizeof(struct sha256_state),
+	.mb_max_msgs	=	2,
 	.base		=	{
 		.cra_name	=	"sha224",
 		.cra_driver_name =	"sha224-ni",
@@ -2441,11 +2441,33 @@ static void bfq_remove_request(struct request_queue *q,
 
 }
 
+/*
+ * Staging and batching are skipped with CONFIG_BFQ_CGROUP_DEBUG, whose
+ * per-request statistics take the queue lock anyway.
+ */
+static bool bfq_scalable(struct bfq_data *bfqd)
+{
+	return !IS_ENABLED(CONFIG_BFQ_CGROUP_DEBUG) && READ_ONCE(bfqd->scalable);
+}
+
+static void bfq_flush_staged(struct bfq_data *bfqd, struct list_head *free);
+
 static bool bfq_bio_merge(struct request_queue *q, struct bio *bio,
 		unsigned int nr_segs)
 {
 	struct bfq_data *bfqd = q->elevator->elevator_data;
 	struct request *free = NULL;
+	LIST_HEAD(staged_free);
+	struct bfq_io_cq *bic;
+	bool ret;
+
+	/*
+	 * Taking bfqd->lock for every bio is exactly what scalable mode
+	 * avoids: rely on plug merging and on merging at insertion.
+	 */
+	if (bfq_scalable(bfqd))
+		return false;
+
 	/*
 	 * bfq_bic_lookup grabs the queue_lock: invoke it now and
 	 * store its return value for later use, to avoid nesting
@@ -2453,11 +2475,13 @@ static bool bfq_bio_merge(struct request_queue *q, struct bio *bio,
 	 * returned by bfq_bic_lookup does not go away before
 	 * bfqd->lock is taken.
 	 */
-	struct bfq_io_cq *bic = bfq_bic_lookup(q);
-	bool ret;
+	bic = bfq_bic_lookup(q);
 
 	spin_lock_irq(&bfqd->lock);
 
+	/* Let the bio merge with requests still staged on other cpus */
+	bfq_flush_staged(bfqd, &staged_free);
+
 	if (bic) {
 		/*
 		 * Make sure cgroup info is uptodate for current process before
@@ -2477,6 +2501,7 @@ static bool bfq_bio_merge(struct request_queue *q, struct bio *bio,
 	spin_unlock_irq(&bfqd->lock);
 	if (free)
 		blk_mq_free_request(free);
+	blk_mq_free_requests(&staged_free);
 
 	return ret;
 }
@@ -5031,11 +5056,28 @@ static struct bfq_queue *bfq_select_queue(struct bfq_data *bfqd)
 	return bfqq;
 }
 
+/*
+ * Weight-raising periods are measured in jiffies, so in scalable mode
+ * checking them more than once per jiffy buys nothing.
+ */
+static bool bfq_wr_check_due(struct bfq_data *bfqd, struct bfq_queue *bfqq)
+{
+	if (!bfq_scalable(bfqd))
+		return true;
+
+	if (bfqq->last_wr_check == jiffies)
+		return false;
+
+	bfqq->last_wr_check = jiffies;
+	return true;
+}
+
 static void bfq_update_wr_data(struct bfq_data *bfqd, struct bfq_queue *bfqq)
 {
 	struct bfq_entity *entity = &bfqq->entity;
 
-	if (bfqq->wr_coeff > 1) { /* queue is being weight-raised */
+	/* queue is being weight-raised */
+	if (bfqq->wr_coeff > 1 && bfq_wr_check_due(bfqd, bfqq)) {
 		bfq_log_bfqq(bfqd, bfqq,
 			"raising period dur %u/%u msec, old coeff %u, w %d(%d)",
 			jiffies_to_msecs(jiffies - bfqq->last_wr_start_finish),
@@ -5146,13 +5188,16 @@ static struct request *bfq_dispatch_rq_from_bfqq(struct bfq_data *bfqd,
 static bool bfq_has_work(struct blk_mq_hw_ctx *hctx)
 {
 	struct bfq_data *bfqd = hctx->queue->elevator->elevator_data;
+	struct bfq_hctx_data *bhd = hctx->sched_data;
 
 	/*
 	 * Avoiding lock: a race on bfqd->queued should cause at
 	 * most a call to dispatch for nothing
 	 */
 	return !list_empty_careful(&bfqd->dispatch) ||
-		READ_ONCE(bfqd->queued);
+		READ_ONCE(bfqd->queued) ||
+		(bhd && !list_empty_careful(&bhd->dispatch)) ||
+		!bitmap_empty(bfqd->staged_cpus, nr_cpu_ids);
 }
 
 static struct request *__bfq_dispatch_request(struct blk_mq_hw_ctx *hctx)
@@ -5296,15 +5341,79 @@ static inline void bfq_update_dispatch_stats(struct request_queue *q,
 					     bool idle_timer_disabled) {}
 #endif /* CONFIG_BFQ_CGROUP_DEBUG */
 
+/* Max number of requests dispatched per lock hold in scalable mode */
+#define BFQ_DISPATCH_BATCH	8
+
+static struct request *bfq_pop_hctx_dispatch(struct bfq_hctx_data *bhd)
+{
+	struct request *rq = NULL;
+
+	if (!bhd || list_empty_careful(&bhd->dispatch))
+		return NULL;
+
+	spin_lock(&bhd->lock);
+	if (!list_empty(&bhd->dispatch)) {
+		rq = list_first_entry(&bhd->dispatch, struct request,
+				      queuelist);
+		list_del_init(&rq->queuelist);
+	}
+	spin_unlock(&bhd->lock);
+
+	return rq;
+}
+
+/*
+ * Hand the requests of a dispatch batch to the per-hctx lists of the
+ * hardware queues they belong to, and kick the hardware queues other than
+ * @hctx, as only one of them is run for a single-queue scheduler.
+ */
+static void bfq_park_batch(struct blk_mq_hw_ctx *hctx, struct list_head *batch)
+{
+	struct blk_mq_hw_ctx *kick[BFQ_DISPATCH_BATCH];
+	int i, nr_kick = 0;
+
+	while (!list_empty(batch)) {
+		struct request *rq = list_first_entry(batch, struct request,
+						      queuelist);
+		struct blk_mq_hw_ctx *rq_hctx = rq->mq_hctx;
+		struct bfq_hctx_data *bhd = rq_hctx->sched_data;
+
+		spin_lock(&bhd->lock);
+		list_move_tail(&rq->queuelist, &bhd->dispatch);
+		spin_unlock(&bhd->lock);
+
+		if (rq_hctx == hctx)
+			continue;
+		for (i = 0; i < nr_kick; i++)
+			if (kick[i] == rq_hctx)
+				break;
+		if (i == nr_kick)
+			kick[nr_kick++] = rq_hctx;
+	}
+
+	for (i = 0; i < nr_kick; i++)
+		blk_mq_run_hw_queue(kick[i], true);
+}
+
 static struct request *bfq_dispatch_request(struct blk_mq_hw_ctx *hctx)
 {
 	struct bfq_data *bfqd = hctx->queue->elevator->elevator_data;
-	struct request *rq;
+	struct bfq_hctx_data *bhd = hctx->sched_data;
+	struct request *rq, *next;
 	struct bfq_queue *in_serv_queue;
 	bool waiting_rq, idle_timer_disabled = false;
+	LIST_HEAD(batch);
+	LIST_HEAD(free);
+	int nr = 1;
+
+	rq = bfq_pop_hctx_dispatch(bhd);
+	if (rq)
+		return rq;
 
 	spin_lock_irq(&bfqd->lock);
 
+	bfq_flush_staged(bfqd, &free);
+
 	in_serv_queue = bfqd->in_service_queue;
 	waiting_rq = in_serv_queue && bfq_bfqq_wait_request(in_serv_queue);
 
@@ -5314,11 +5423,29 @@ static struct request *bfq_dispatch_request(struct blk_mq_hw_ctx *hctx)
 			waiting_rq && !bfq_bfqq_wait_request(in_serv_queue);
 	}
 
+	/*
+	 * In scalable mode, keep picking requests while the scheduler
+	 * lock is held. They are fully accounted as dispatched here, and
+	 * wait on per-hctx lists until blk-mq asks for them.
+	 */
+	if (rq && bfq_scalable(bfqd)) {
+		while (nr++ < BFQ_DISPATCH_BATCH) {
+			next = __bfq_dispatch_request(hctx);
+			if (!next)
+				break;
+			list_add_tail(&next->queuelist, &batch);
+		}
+	}
+
 	spin_unlock_irq(&bfqd->lock);
+	blk_mq_free_requests(&free);
 	bfq_update_dispatch_stats(hctx->queue, rq,
 			idle_timer_disabled ? in_serv_queue : NULL,
 				idle_timer_disabled);
 
+	if (!list_empty(&batch))
+		bfq_park_batch(hctx, &batch);
+
 	return rq;
 }
 
@@ -6231,27 +6358,22 @@ static inline void bfq_update_insert_stats(struct request_queue *q,
 
 static struct bfq_queue *bfq_init_rq(struct request *rq);
 
-static void bfq_insert_request(struct blk_mq_hw_ctx *hctx, struct request *rq,
-			       bool at_head)
+/*
+ * Insert rq into the scheduler, with bfqd->lock held. Return false if rq
+ * has been merged into another request instead, in which case it is added
+ * to @free, to be freed by the caller after releasing bfqd->lock.
+ */
+static bool bfq_insert_request_locked(struct bfq_data *bfqd,
+				      struct request *rq, bool at_head,
+				      struct list_head *free,
+				      bool *idle_timer_disabled)
 {
-	struct request_queue *q = hctx->queue;
-	struct bfq_data *bfqd = q->elevator->elevator_data;
+	struct request_queue *q = bfqd->queue;
 	struct bfq_queue *bfqq;
-	bool idle_timer_disabled = false;
-	blk_opf_t cmd_flags;
-	LIST_HEAD(free);
 
-#ifdef CONFIG_BFQ_GROUP_IOSCHED
-	if (!cgroup_subsys_on_dfl(io_cgrp_subsys) && rq->bio)
-		bfqg_stats_update_legacy_io(q, rq);
-#endif
-	spin_lock_irq(&bfqd->lock);
 	bfqq = bfq_init_rq(rq);
-	if (blk_mq_sched_try_insert_merge(q, rq, &free)) {
-		spin_unlock_irq(&bfqd->lock);
-		blk_mq_free_requests(&free);
-		return;
-	}
+	if (blk_mq_sched_try_insert_merge(q, rq, free))
+		return false;
 
 	trace_block_rq_insert(rq);
 
@@ -6261,13 +6383,7 @@ static void bfq_insert_request(struct blk_mq_hw_ctx *hctx, struct request *rq,
 		else
 			list_add_tail(&rq->queuelist, &bfqd->dispatch);
 	} else {
-		idle_timer_disabled = __bfq_insert_request(bfqd, rq);
-		/*
-		 * Update bfqq, because, if a queue merge has occurred
-		 * in __bfq_insert_request, then rq has been
-		 * redirected into a new queue.
-		 */
-		bfqq = RQ_BFQQ(rq);
+		*idle_timer_disabled = __bfq_insert_request(bfqd, rq);
 
 		if (rq_mergeable(rq)) {
 			elv_rqhash_add(q, rq);
@@ -6276,6 +6392,38 @@ static void bfq_insert_request(struct blk_mq_hw_ctx *hctx, struct request *rq,
 		}
 	}
 
+	return true;
+}
+
+static void bfq_insert_request(struct blk_mq_hw_ctx *hctx, struct request *rq,
+			       bool at_head)
+{
+	struct request_queue *q = hctx->queue;
+	struct bfq_data *bfqd = q->elevator->elevator_data;
+	struct bfq_queue *bfqq;
+	bool idle_timer_disabled = false;
+	blk_opf_t cmd_flags;
+	LIST_HEAD(free);
+
+#ifdef CONFIG_BFQ_GROUP_IOSCHED
+	if (!cgroup_subsys_on_dfl(io_cgrp_subsys) && rq->bio)
+		bfqg_stats_update_legacy_io(q, rq);
+#endif
+	spin_lock_irq(&bfqd->lock);
+	if (!bfq_insert_request_locked(bfqd, rq, at_head, &free,
+				       &idle_timer_disabled)) {
+		spin_unlock_irq(&bfqd->lock);
+		blk_mq_free_requests(&free);
+		return;
+	}
+
+	/*
+	 * Fetch bfqq only now, because, if a queue merge has occurred
+	 * in __bfq_insert_request, then rq has been redirected into a
+	 * new queue.
+	 */
+	bfqq = RQ_BFQQ(rq);
+
 	/*
 	 * Cache cmd_flags before releasing scheduler lock, because rq
 	 * may disappear afterwards (for example, because of a request
@@ -6288,9 +6436,73 @@ static void bfq_insert_request(struct blk_mq_hw_ctx *hctx, struct request *rq,
 				cmd_flags);
 }
 
+/*
+ * Scalable mode: park the requests on a per-cpu list without taking
+ * bfqd->lock. They enter the scheduler on the next bfq_flush_staged(),
+ * together with whatever other cpus staged meanwhile.
+ */
+static void bfq_stage_requests(struct bfq_data *bfqd, struct list_head *list)
+{
+	struct request *rq = list_first_entry(list, struct request, queuelist);
+	int cpu = rq->mq_ctx->cpu;
+	struct bfq_staged *st = per_cpu_ptr(bfqd->staged, cpu);
+
+#ifdef CONFIG_BFQ_GROUP_IOSCHED
+	if (!cgroup_subsys_on_dfl(io_cgrp_subsys)) {
+		list_for_each_entry(rq, list, queuelist)
+			if (rq->bio)
+				bfqg_stats_update_legacy_io(bfqd->queue, rq);
+	}
+#endif
+	/* irqs off, as st->lock nests inside the irq-safe bfqd->lock */
+	spin_lock_irq(&st->lock);
+	list_splice_tail_init(list, &st->list);
+	spin_unlock_irq(&st->lock);
+
+	set_bit(cpu, bfqd->staged_cpus);
+}
+
+/*
+ * Move all staged requests into the scheduler. Called with bfqd->lock
+ * held; requests merged away on insertion are added to @free.
+ */
+static void bfq_flush_staged(struct bfq_data *bfqd, struct list_head *free)
+{
+	bool idle_timer_disabled = false;
+	LIST_HEAD(list);
+	int cpu;
+
+	for_each_set_bit(cpu, bfqd->staged_cpus, nr_cpu_ids) {
+		struct bfq_staged *st = per_cpu_ptr(bfqd->staged, cpu);
+
+		if (!test_and_clear_bit(cpu, bfqd->staged_cpus))
+			continue;
+
+		spin_lock(&st->lock);
+		list_splice_tail_init(&st->list, &list);
+		spin_unlock(&st->lock);
+	}
+
+	while (!list_empty(&list)) {
+		struct request *rq = list_first_entry(&list, struct request,
+						      queuelist);
+
+		list_del_init(&rq->queuelist);
+		bfq_insert_request_locked(bfqd, rq, false, free,
+					  &idle_timer_disabled);
+	}
+}
+
 static void bfq_insert_requests(struct blk_mq_hw_ctx *hctx,
 				struct list_head *list, bool at_head)
 {
+	struct bfq_data *bfqd = hctx->queue->elevator->elevator_data;
+
+	if (!at_head && bfq_scalable(bfqd) && !list_empty(list)) {
+		bfq_stage_requests(bfqd, list);
+		return;
+	}
+
 	while (!list_empty(list)) {
 		struct request *rq;
 
@@ -7126,10 +7338,28 @@ static void bfq_depth_updated(struct blk_mq_hw_ctx *hctx)
 
 static int bfq_init_hctx(struct blk_mq_hw_ctx *hctx, unsigned int index)
 {
+	struct bfq_hctx_data *bhd;
+
+	bhd = kzalloc_node(sizeof(*bhd), GFP_KERNEL, hctx->numa_node);
+	if (!bhd)
+		return -ENOMEM;
+	spin_lock_init(&bhd->lock);
+	INIT_LIST_HEAD(&bhd->dispatch);
+	hctx->sched_data = bhd;
+
 	bfq_depth_updated(hctx);
 	return 0;
 }
 
+static void bfq_exit_hctx(struct blk_mq_hw_ctx *hctx, unsigned int index)
+{
+	struct bfq_hctx_data *bhd = hctx->sched_data;
+
+	WARN_ON_ONCE(!list_empty(&bhd->dispatch));
+	kfree(bhd);
+	hctx->sched_data = NULL;
+}
+
 static void bfq_exit_queue(struct elevator_queue *e)
 {
 	struct bfq_data *bfqd = e->elevator_data;
@@ -7160,6 +7390,8 @@ static void bfq_exit_queue(struct elevator_queue *e)
 	clear_bit(ELEVATOR_FLAG_DISABLE_WBT, &e->flags);
 	wbt_enable_default(bfqd->queue);
 
+	bitmap_free(bfqd->staged_cpus);
+	free_percpu(bfqd->staged);
 	kfree(bfqd);
 }
 
@@ -7321,6 +7553,17 @@ static int bfq_init_queue(struct request_queue *q, struct elevator_type *e)
 
 	spin_lock_init(&bfqd->lock);
 
+	bfqd->staged = alloc_percpu(struct bfq_staged);
+	bfqd->staged_cpus = bitmap_zalloc(nr_cpu_ids, GFP_KERNEL);
+	if (!bfqd->staged || !bfqd->staged_cpus)
+		goto out_free;
+	for_each_possible_cpu(i) {
+		struct bfq_staged *st = per_cpu_ptr(bfqd->staged, i);
+
+		spin_lock_init(&st->lock);
+		INIT_LIST_HEAD(&st->list);
+	}
+
 	/*
 	 * The invocation of the next bfq_create_group_hierarchy
 	 * function is the head of a chain of function calls
@@ -7352,6 +7595,8 @@ static int bfq_init_queue(struct request_queue *q, struct elevator_type *e)
 	return 0;
 
 out_free:
+	bitmap_free(bfqd->staged_cpus);
+	free_percpu(bfqd->staged);
 	kfree(bfqd);
 	kobject_put(&eq->kobj);
 	return -ENOMEM;
@@ -7406,6 +7651,7 @@ SHOW_FUNCTION(bfq_max_budget_show, bfqd->bfq_user_max_budget, 0);
 SHOW_FUNCTION(bfq_timeout_sync_show, bfqd->bfq_timeout, 1);
 SHOW_FUNCTION(bfq_strict_guarantees_show, bfqd->strict_guarantees, 0);
 SHOW_FUNCTION(bfq_low_latency_show, bfqd->low_latency, 0);
+SHOW_FUNCTION(bfq_scalable_show, bfqd->scalable, 0);
 #undef SHOW_FUNCTION
 
 #define USEC_SHOW_FUNCTION(__FUNC, __VAR)				\
@@ -7566,6 +7812,24 @@ static ssize_t bfq_low_latency_store(struct elevator_queue *e,
 	return count;
 }
 
+static ssize_t bfq_scalable_store(struct elevator_queue *e,
+				  const char *page, size_t count)
+{
+	struct bfq_data *bfqd = e->elevator_data;
+	unsigned long __data;
+	int ret;
+
+	ret = bfq_var_store(&__data, (page));
+	if (ret)
+		return ret;
+
+	if (__data > 1)
+		__data = 1;
+	WRITE_ONCE(bfqd->scalable, __data);
+
+	return count;
+}
+
 #define BFQ_ATTR(name) \
 	__ATTR(name, 0644, bfq_##name##_show, bfq_##name##_store)
 
@@ -7580,6 +7844,7 @@ static struct elv_fs_entry bfq_attrs[] = {
 	BFQ_ATTR(timeout_sync),
 	BFQ_ATTR(strict_guarantees),
 	BFQ_ATTR(low_latency),
+	BFQ_ATTR(scalable),
 	__ATTR_NULL
 };
 
@@ -7602,6 +7867,7 @@ static struct elevator_type iosched_bfq_mq = {
 		.has_work		= bfq_has_work,
 		.depth_updated		= bfq_depth_updated,
 		.init_hctx		= bfq_init_hctx,
+		.exit_hctx		= bfq_exit_hctx,
 		.init_sched		= bfq_init_queue,
 		.exit_sched		= bfq_exit_queue,
 	},
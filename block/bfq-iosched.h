@@ -355,6 +355,8 @@ struct bfq_queue {
 	 * finish time of the last weight-raising period.
 	 */
 	unsigned long last_wr_start_finish;
+	/* last time weight raising was checked for expiration */
+	unsigned long last_wr_check;
 	/* factor by which the weight of this queue is multiplied */
 	unsigned int wr_coeff;
 	/*
@@ -505,6 +507,24 @@ struct bfq_io_cq {
 	unsigned int requests;	/* Number of requests this process has in flight */
 };
 
+/*
+ * Per-cpu list of requests inserted while in scalable mode, and not yet
+ * handed to the scheduler proper (see bfq_stage_requests()).
+ */
+struct bfq_staged {
+	spinlock_t lock;
+	struct list_head list;
+} ____cacheline_aligned_in_smp;
+
+/*
+ * Per-hctx list of requests that have already been dispatched by the
+ * scheduler in a batch, and are waiting to be handed to the driver.
+ */
+struct bfq_hctx_data {
+	spinlock_t lock;
+	struct list_head dispatch;
+} ____cacheline_aligned_in_smp;
+
 /**
  * struct bfq_data - per-device data structure.
  *
@@ -732,6 +752,20 @@ struct bfq_data {
 	 */
 	bool strict_guarantees;
 
+	/*
+	 * Scalable mode: stage insertions on per-cpu lists and move
+	 * them into the scheduler in batches, dispatch batches of
+	 * requests to per-hctx lists, and evaluate weight-raising
+	 * expiration at most once per jiffy per queue. This trades
+	 * some scheduling precision for much less contention on
+	 * @lock.
+	 */
+	bool scalable;
+	/* per-cpu staged insertions, see struct bfq_staged */
+	struct bfq_staged __percpu *staged;
+	/* cpus whose staged list may be non-empty */
+	unsigned long *staged_cpus;
+
 	/*
 	 * Last time at which a queue entered the current burst of
 	 * queues being activated shortly after each other; for more
@@ -46,6 +46,15 @@
  * If needed, tools/cgroup/iocost_coef_gen.py can be used to generate
  * device-specific coefficients.
  *
+ * Unless the user configured a model, the coefficients are also fitted
+ * online from the sizes and completion latencies of the IOs, smoothed over
+ * roughly 16 periods.  Once a fit has enough samples and a small enough
+ * residual, it replaces the default parameters.  Latency at queue depth
+ * above one overstates the device time of each IO, but the absolute scale
+ * of the model is corrected by vrate adjustment anyway.  What the fit
+ * provides is the relative cost of pages, sequential and random IOs.  The
+ * fitted model and its error are reported in /sys/fs/cgroup/io.cost.fit.
+ *
  * 2. Control Strategy
  *
  * The device virtual time (vtime) is used as the primary control metric.
@@ -308,6 +317,20 @@ enum {
 
 	/* if apart further than 16M, consider randio for linear model */
 	LCOEF_RANDIO_PAGES	= 4096,
+
+	/*
+	 * Online cost model fitting. Latency samples are kept in 16ns
+	 * units, and per-period sums decay by 1/16th each period, giving a
+	 * smoothing window of roughly 16 periods.
+	 */
+	IOC_FIT_LAT_SHIFT	= 4,
+	IOC_FIT_DECAY_SHIFT	= 4,
+
+	/* samples needed in the window before a coefficient is trusted */
+	IOC_FIT_MIN_SAMPLES	= 512,
+
+	/* don't apply a fit whose rms residual exceeds 50% of the mean */
+	IOC_FIT_MAX_ERR_BP	= 5000,
 };
 
 enum ioc_running {
@@ -362,6 +385,23 @@ enum {
 	NR_LCOEFS,
 };
 
+/* IO classes and running sums of the online linear model fit */
+enum {
+	IOC_FIT_SEQ,
+	IOC_FIT_RAND,
+	NR_IOC_FIT_CLASSES,
+};
+
+enum {
+	FIT_NR,		/* number of samples */
+	FIT_X,		/* sum of sizes in pages */
+	FIT_Y,		/* sum of latencies */
+	FIT_XX,
+	FIT_XY,
+	FIT_YY,
+	NR_FIT_SUMS,
+};
+
 enum {
 	AUTOP_INVALID,
 	AUTOP_HDD,
@@ -396,6 +436,9 @@ struct ioc_pcpu_stat {
 
 	local64_t			rq_wait_ns;
 	u64				last_rq_wait_ns;
+
+	local64_t			fit[2][NR_IOC_FIT_CLASSES][NR_FIT_SUMS];
+	u64				last_fit[2][NR_IOC_FIT_CLASSES][NR_FIT_SUMS];
 };
 
 /* per device */
@@ -441,6 +484,15 @@ struct ioc {
 	int				autop_idx;
 	bool				user_qos_params:1;
 	bool				user_cost_model:1;
+
+	/* online cost model fitting, see ioc_fit_model() */
+	u64				fit_cursor[2];
+	u64				fit_sums[2][NR_IOC_FIT_CLASSES][NR_FIT_SUMS];
+	u64				fit_lcoefs[NR_I_LCOEFS];
+	u64				fit_nr[2];
+	u32				fit_err_bp[2];
+	bool				fit_conf[2];
+	bool				fit_applied;
 };
 
 struct iocg_pcpu_stat {
@@ -915,7 +967,7 @@ static bool ioc_refresh_params(struct ioc *ioc, bool force)
 
 	if (!ioc->user_qos_params)
 		memcpy(ioc->params.qos, p->qos, sizeof(p->qos));
-	if (!ioc->user_cost_model)
+	if (!ioc->user_cost_model && !ioc->fit_applied)
 		memcpy(ioc->params.i_lcoefs, p->i_lcoefs, sizeof(p->i_lcoefs));
 
 	ioc_refresh_period_us(ioc);
@@ -1592,6 +1644,178 @@ static void ioc_lat_stat(struct ioc *ioc, u32 *missed_ppm_ar, u32 *rq_wait_pct_p
 				   ioc->period_us * NSEC_PER_USEC);
 }
 
+/*
+ * Fit the linear cost model of one direction to the decayed completion
+ * samples. Latency is modeled as
+ *
+ *   lat = seqio|randio + pages * page
+ *
+ * with the per-page cost shared between the two classes. It is estimated
+ * as the pooled within-class regression slope, which is only meaningful if
+ * IO sizes vary enough. Otherwise the current per-page cost is kept, and
+ * only the per-IO costs are fitted. Coefficients which can't be trusted yet
+ * keep their current values.
+ */
+static void ioc_fit_dir(struct ioc *ioc, int rw)
+{
+	u64 (*s)[NR_FIT_SUMS] = ioc->fit_sums[rw];
+	int i_bps = rw == READ ? I_LCOEF_RBPS : I_LCOEF_WBPS;
+	u64 *u = &ioc->fit_lcoefs[i_bps];
+	s64 sxx = 0, sxy = 0, syy = 0, sse;
+	u64 nr = 0, sum_y = 0, page_ns = 0, rms;
+	bool page_fitted = false, fitted = false;
+	int cls;
+
+	memcpy(u, &ioc->params.i_lcoefs[i_bps], 3 * sizeof(*u));
+
+	for (cls = 0; cls < NR_IOC_FIT_CLASSES; cls++) {
+		u64 n = s[cls][FIT_NR];
+
+		if (!n)
+			continue;
+		sxx += s[cls][FIT_XX] -
+			mul_u64_u64_div_u64(s[cls][FIT_X], s[cls][FIT_X], n);
+		sxy += (s64)s[cls][FIT_XY] -
+			(s64)mul_u64_u64_div_u64(s[cls][FIT_X], s[cls][FIT_Y], n);
+		syy += s[cls][FIT_YY] -
+			mul_u64_u64_div_u64(s[cls][FIT_Y], s[cls][FIT_Y], n);
+		nr += n;
+		sum_y += s[cls][FIT_Y];
+	}
+
+	ioc->fit_nr[rw] = nr;
+	ioc->fit_conf[rw] = false;
+	if (nr < IOC_FIT_MIN_SAMPLES || !sum_y)
+		return;
+
+	/* need a size variance of at least one page squared */
+	if (sxx >= (s64)nr && sxy > 0) {
+		page_ns = mul_u64_u64_div_u64(sxy, 1 << IOC_FIT_LAT_SHIFT, sxx);
+		page_fitted = page_ns;
+	}
+	if (page_fitted)
+		u[0] = div64_u64((u64)IOC_PAGE_SIZE * NSEC_PER_SEC, page_ns);
+	else if (u[0])
+		page_ns = div64_u64((u64)IOC_PAGE_SIZE * NSEC_PER_SEC, u[0]);
+
+	for (cls = 0; cls < NR_IOC_FIT_CLASSES; cls++) {
+		u64 n = s[cls][FIT_NR];
+		s64 io_ns;
+
+		if (n < IOC_FIT_MIN_SAMPLES)
+			continue;
+		io_ns = (s64)(s[cls][FIT_Y] << IOC_FIT_LAT_SHIFT) -
+			(s64)(page_ns * s[cls][FIT_X]);
+		io_ns = max_t(s64, div64_s64(io_ns, n), 0);
+		if (io_ns + page_ns) {
+			u[1 + cls] = div64_u64(NSEC_PER_SEC, io_ns + page_ns);
+			fitted = true;
+		}
+	}
+
+	/* rms residual relative to the mean latency, in basis points */
+	sse = syy - 2 * (s64)mul_u64_u64_div_u64(max_t(s64, sxy, 0), page_ns,
+						 1 << IOC_FIT_LAT_SHIFT) +
+		(s64)mul_u64_u64_div_u64(max_t(s64, sxx, 0), page_ns * page_ns,
+					 1 << (2 * IOC_FIT_LAT_SHIFT));
+	rms = int_sqrt64(div64_u64(max_t(s64, sse, 0), nr));
+	ioc->fit_err_bp[rw] = min_t(u64, div64_u64(rms * 10000 * nr, sum_y),
+				    U32_MAX);
+
+	ioc->fit_conf[rw] = (page_fitted || fitted) &&
+		ioc->fit_err_bp[rw] <= IOC_FIT_MAX_ERR_BP;
+}
+
+/*
+ * Fold this period's completion samples into the decayed sums, refit the
+ * model and, unless the user configured one, switch to the fitted
+ * coefficients once they can be trusted. The builtin model for the device
+ * class is only the starting point.
+ */
+static void ioc_fit_model(struct ioc *ioc)
+{
+	u64 delta[2][NR_IOC_FIT_CLASSES][NR_FIT_SUMS] = { };
+	int cpu, rw, cls, i;
+	bool applied = false;
+
+	lockdep_assert_held(&ioc->lock);
+
+	for_each_online_cpu(cpu) {
+		struct ioc_pcpu_stat *stat = per_cpu_ptr(ioc->pcpu_stat, cpu);
+
+		for (rw = READ; rw <= WRITE; rw++)
+			for (cls = 0; cls < NR_IOC_FIT_CLASSES; cls++)
+				for (i = 0; i < NR_FIT_SUMS; i++) {
+					u64 v = local64_read(&stat->fit[rw][cls][i]);
+
+					delta[rw][cls][i] +=
+						v - stat->last_fit[rw][cls][i];
+					stat->last_fit[rw][cls][i] = v;
+				}
+	}
+
+	for (rw = READ; rw <= WRITE; rw++) {
+		for (cls = 0; cls < NR_IOC_FIT_CLASSES; cls++)
+			for (i = 0; i < NR_FIT_SUMS; i++) {
+				u64 *sum = &ioc->fit_sums[rw][cls][i];
+
+				*sum -= *sum >> IOC_FIT_DECAY_SHIFT;
+				*sum += delta[rw][cls][i];
+			}
+
+		ioc_fit_dir(ioc, rw);
+	}
+
+	if (ioc->user_cost_model)
+		return;
+
+	for (rw = READ; rw <= WRITE; rw++) {
+		int i_bps = rw == READ ? I_LCOEF_RBPS : I_LCOEF_WBPS;
+
+		if (!ioc->fit_conf[rw])
+			continue;
+		memcpy(&ioc->params.i_lcoefs[i_bps], &ioc->fit_lcoefs[i_bps],
+		       3 * sizeof(u64));
+		applied = true;
+	}
+
+	if (applied) {
+		ioc->fit_applied = true;
+		ioc_refresh_lcoefs(ioc);
+	}
+}
+
+static void ioc_fit_sample(struct ioc *ioc, struct ioc_pcpu_stat *ccs,
+			   struct request *rq, int rw, u64 now)
+{
+	u64 start = rq->io_start_time_ns ?: rq->start_time_ns;
+	u64 pos = blk_rq_pos(rq), cursor, dist, x, y;
+	local64_t *sums;
+	int cls;
+
+	if (now <= start)
+		return;
+
+	x = max_t(u64, DIV_ROUND_UP(blk_rq_stats_sectors(rq),
+				    1 << IOC_SECT_TO_PAGE_SHIFT), 1);
+	y = (now - start) >> IOC_FIT_LAT_SHIFT;
+
+	/* approximate, completions may not come back in issue order */
+	cursor = READ_ONCE(ioc->fit_cursor[rw]);
+	dist = pos > cursor ? pos - cursor : cursor - pos;
+	cls = (dist >> IOC_SECT_TO_PAGE_SHIFT) > LCOEF_RANDIO_PAGES ?
+		IOC_FIT_RAND : IOC_FIT_SEQ;
+	WRITE_ONCE(ioc->fit_cursor[rw], pos + blk_rq_stats_sectors(rq));
+
+	sums = ccs->fit[rw][cls];
+	local64_add(1, &sums[FIT_NR]);
+	local64_add(x, &sums[FIT_X]);
+	local64_add(y, &sums[FIT_Y]);
+	local64_add(x * x, &sums[FIT_XX]);
+	local64_add(x * y, &sums[FIT_XY]);
+	local64_add(y * y, &sums[FIT_YY]);
+}
+
 /* was iocg idle this period? */
 static bool iocg_is_idle(struct ioc_gq *iocg)
 {
@@ -2394,6 +2618,7 @@ static void ioc_timer_fn(struct timer_list *timer)
 	ioc_adjust_base_vrate(ioc, rq_wait_pct, nr_lagging, nr_shortages,
 			      prev_busy_level, missed_ppm);
 
+	ioc_fit_model(ioc);
 	ioc_refresh_params(ioc, false);
 
 	ioc_forgive_debts(ioc, usage_us_sum, nr_debtors, &now);
@@ -2759,7 +2984,7 @@ static void ioc_rqos_done(struct rq_qos *rqos, struct request *rq)
 {
 	struct ioc *ioc = rqos_to_ioc(rqos);
 	struct ioc_pcpu_stat *ccs;
-	u64 on_q_ns, rq_wait_ns, size_nsec;
+	u64 now, on_q_ns, rq_wait_ns, size_nsec;
 	int pidx, rw;
 
 	if (!ioc->enabled || !rq->alloc_time_ns || !rq->start_time_ns)
@@ -2778,7 +3003,8 @@ static void ioc_rqos_done(struct rq_qos *rqos, struct request *rq)
 		return;
 	}
 
-	on_q_ns = ktime_get_ns() - rq->alloc_time_ns;
+	now = ktime_get_ns();
+	on_q_ns = now - rq->alloc_time_ns;
 	rq_wait_ns = rq->start_time_ns - rq->alloc_time_ns;
 	size_nsec = div64_u64(calc_size_vtime_cost(rq, ioc), VTIME_PER_NSEC);
 
@@ -2792,6 +3018,8 @@ static void ioc_rqos_done(struct rq_qos *rqos, struct request *rq)
 
 	local64_add(rq_wait_ns, &ccs->rq_wait_ns);
 
+	ioc_fit_sample(ioc, ccs, rq, rw, now);
+
 	put_cpu_ptr(ccs);
 }
 
@@ -3316,6 +3544,43 @@ static int ioc_cost_model_show(struct seq_file *sf, void *v)
 	return 0;
 }
 
+static u64 ioc_cost_fit_prfill(struct seq_file *sf,
+			       struct blkg_policy_data *pd, int off)
+{
+	const char *dname = blkg_dev_name(pd->blkg);
+	struct ioc *ioc = pd_to_iocg(pd)->ioc;
+	u64 *u = ioc->fit_lcoefs;
+
+	if (!dname)
+		return 0;
+
+	spin_lock_irq(&ioc->lock);
+	seq_printf(sf, "%s ctrl=%s model=linear "
+		   "rbps=%llu rseqiops=%llu rrandiops=%llu "
+		   "wbps=%llu wseqiops=%llu wrandiops=%llu "
+		   "rerr=%u.%02u werr=%u.%02u rsamples=%llu wsamples=%llu "
+		   "rconf=%d wconf=%d\n",
+		   dname, ioc->user_cost_model ? "user" :
+		   (ioc->fit_applied ? "fit" : "auto"),
+		   u[I_LCOEF_RBPS], u[I_LCOEF_RSEQIOPS], u[I_LCOEF_RRANDIOPS],
+		   u[I_LCOEF_WBPS], u[I_LCOEF_WSEQIOPS], u[I_LCOEF_WRANDIOPS],
+		   ioc->fit_err_bp[READ] / 100, ioc->fit_err_bp[READ] % 100,
+		   ioc->fit_err_bp[WRITE] / 100, ioc->fit_err_bp[WRITE] % 100,
+		   ioc->fit_nr[READ], ioc->fit_nr[WRITE],
+		   ioc->fit_conf[READ], ioc->fit_conf[WRITE]);
+	spin_unlock_irq(&ioc->lock);
+	return 0;
+}
+
+static int ioc_cost_fit_show(struct seq_file *sf, void *v)
+{
+	struct blkcg *blkcg = css_to_blkcg(seq_css(sf));
+
+	blkcg_print_blkgs(sf, blkcg, ioc_cost_fit_prfill,
+			  &blkcg_policy_iocost, seq_cft(sf)->private, false);
+	return 0;
+}
+
 static const match_table_t cost_ctrl_tokens = {
 	{ COST_CTRL,		"ctrl=%s"	},
 	{ COST_MODEL,		"model=%s"	},
@@ -3401,6 +3666,8 @@ static ssize_t ioc_cost_model_write(struct kernfs_open_file *of, char *input,
 	} else {
 		ioc->user_cost_model = false;
 	}
+	/* start over from the builtin model, the fit gets reapplied */
+	ioc->fit_applied = false;
 	ioc_refresh_params(ioc, true);
 	spin_unlock_irq(&ioc->lock);
 
@@ -3433,6 +3700,11 @@ static struct cftype ioc_files[] = {
 		.seq_show = ioc_cost_model_show,
 		.write = ioc_cost_model_write,
 	},
+	{
+		.name = "cost.fit",
+		.flags = CFTYPE_ONLY_ON_ROOT,
+		.seq_show = ioc_cost_fit_show,
+	},
 	{}
 };
 
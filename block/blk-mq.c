@@ -4738,8 +4738,49 @@ static bool blk_poll_stats_enable(struct request_queue *q)
 	return blk_stats_alloc_enable(q);
 }
 
+/*
+ * Adaptive hybrid polling keeps one blk-stat bucket per hardware queue and
+ * data direction. The mean completion time of each bucket is refreshed every
+ * stats window, and the poller sleeps for a learned fraction of it before
+ * spinning. The fraction is nudged down whenever the first poll after waking
+ * finds completions already waiting (we slept too long) and up otherwise, so
+ * it settles where roughly one wakeup in five is late: tight latency
+ * distributions converge close to the mean, wide ones stay well below it.
+ */
+#define BLK_MQ_POLL_FRAC_SHIFT		10
+#define BLK_MQ_POLL_FRAC_MIN		(1U << (BLK_MQ_POLL_FRAC_SHIFT - 4))
+#define BLK_MQ_POLL_FRAC_MAX		(1U << BLK_MQ_POLL_FRAC_SHIFT)
+#define BLK_MQ_POLL_FRAC_UP		8
+#define BLK_MQ_POLL_FRAC_DOWN		32
+/* Not worth arming an hrtimer for less than this */
+#define BLK_MQ_POLL_MIN_SLEEP_NS	2000
+
+struct blk_mq_poll_adapt_stat {
+	u64			polls;
+	u64			sleeps;
+	u64			overslept;
+	u64			slept_ns;
+	u64			spun_ns;
+};
+
+struct blk_mq_poll_adapt {
+	struct blk_stat_callback	*cb;
+	struct blk_mq_poll_adapt_stat __percpu *stat;
+	u64				lat_ns[2];
+	unsigned int			nr_buckets;
+	struct {
+		u64			expected_ns;
+		unsigned int		fraction;
+	} bkt[];
+};
+
 static void blk_mq_poll_stats_start(struct request_queue *q)
 {
+	struct blk_mq_poll_adapt *pa = READ_ONCE(q->poll_adapt);
+
+	if (pa && !blk_stat_is_active(pa->cb))
+		blk_stat_activate_msecs(pa->cb, 100);
+
 	/*
 	 * We don't arm the callback if polling stats are not enabled or the
 	 * callback is already active.
@@ -4750,6 +4791,123 @@ static void blk_mq_poll_stats_start(struct request_queue *q)
 	blk_stat_activate_msecs(q->poll_cb, 100);
 }
 
+static int blk_mq_poll_adapt_bkt(const struct request *rq)
+{
+	struct blk_mq_poll_adapt *pa = READ_ONCE(rq->q->poll_adapt);
+	unsigned int bucket;
+
+	if (!pa || !rq->mq_hctx)
+		return -1;
+
+	/* Hardware queues added after the mode was enabled aren't tracked */
+	bucket = rq->mq_hctx->queue_num * 2 + op_is_write(req_op(rq));
+	if (bucket >= pa->nr_buckets)
+		return -1;
+
+	return bucket;
+}
+
+static void blk_mq_poll_adapt_fn(struct blk_stat_callback *cb)
+{
+	struct request_queue *q = cb->data;
+	struct blk_mq_poll_adapt *pa = q->poll_adapt;
+	u64 lat[2] = { }, nr[2] = { };
+	unsigned int bucket;
+	int ddir;
+
+	for (bucket = 0; bucket < cb->buckets; bucket++) {
+		struct blk_rq_stat *stat = &cb->stat[bucket];
+
+		if (!stat->nr_samples)
+			continue;
+
+		WRITE_ONCE(pa->bkt[bucket].expected_ns, stat->mean);
+		lat[bucket & 1] += stat->mean * stat->nr_samples;
+		nr[bucket & 1] += stat->nr_samples;
+	}
+
+	for (ddir = 0; ddir < 2; ddir++) {
+		if (nr[ddir])
+			WRITE_ONCE(pa->lat_ns[ddir], div64_u64(lat[ddir], nr[ddir]));
+	}
+}
+
+int blk_mq_poll_adapt_enable(struct request_queue *q)
+{
+	unsigned int i, nr_buckets = q->nr_hw_queues * 2;
+	struct blk_mq_poll_adapt *pa;
+
+	if (q->poll_adapt)
+		return 0;
+
+	pa = kzalloc_node(struct_size(pa, bkt, nr_buckets), GFP_KERNEL,
+			  q->node);
+	if (!pa)
+		return -ENOMEM;
+	pa->stat = alloc_percpu(struct blk_mq_poll_adapt_stat);
+	if (!pa->stat)
+		goto free_pa;
+	pa->cb = blk_stat_alloc_callback(blk_mq_poll_adapt_fn,
+					 blk_mq_poll_adapt_bkt, nr_buckets, q);
+	if (!pa->cb)
+		goto free_stat;
+
+	pa->nr_buckets = nr_buckets;
+	for (i = 0; i < nr_buckets; i++)
+		pa->bkt[i].fraction = 1U << (BLK_MQ_POLL_FRAC_SHIFT - 1);
+
+	smp_store_release(&q->poll_adapt, pa);
+	blk_stat_add_callback(q, pa->cb);
+	return 0;
+
+free_stat:
+	free_percpu(pa->stat);
+free_pa:
+	kfree(pa);
+	return -ENOMEM;
+}
+
+void blk_mq_poll_adapt_free(struct request_queue *q)
+{
+	struct blk_mq_poll_adapt *pa = q->poll_adapt;
+
+	if (!pa)
+		return;
+
+	blk_stat_remove_callback(q, pa->cb);
+	blk_stat_free_callback(pa->cb);
+	free_percpu(pa->stat);
+	kfree(pa);
+	q->poll_adapt = NULL;
+}
+
+ssize_t blk_mq_poll_adapt_show(struct request_queue *q, char *page)
+{
+	struct blk_mq_poll_adapt *pa = q->poll_adapt;
+	struct blk_mq_poll_adapt_stat sum = { };
+	int cpu;
+
+	if (!pa)
+		return sprintf(page, "0 0 0 0 0 0 0\n");
+
+	for_each_possible_cpu(cpu) {
+		struct blk_mq_poll_adapt_stat *stat = per_cpu_ptr(pa->stat, cpu);
+
+		sum.polls += stat->polls;
+		sum.sleeps += stat->sleeps;
+		sum.overslept += stat->overslept;
+		sum.slept_ns += stat->slept_ns;
+		sum.spun_ns += stat->spun_ns;
+	}
+
+	return sprintf(page, "%llu %llu %llu %llu %llu %llu %llu\n",
+		       sum.polls, sum.sleeps, sum.overslept,
+		       div_u64(sum.slept_ns, NSEC_PER_USEC),
+		       div_u64(sum.spun_ns, NSEC_PER_USEC),
+		       READ_ONCE(pa->lat_ns[READ]),
+		       READ_ONCE(pa->lat_ns[WRITE]));
+}
+
 static void blk_mq_poll_stats_fn(struct blk_stat_callback *cb)
 {
 	struct request_queue *q = cb->data;
@@ -4793,36 +4951,12 @@ static unsigned long blk_mq_poll_nsecs(struct request_queue *q,
 	return ret;
 }
 
-static bool blk_mq_poll_hybrid(struct request_queue *q, blk_qc_t qc)
+static void blk_mq_poll_sleep(struct request *rq, u64 nsecs)
 {
-	struct blk_mq_hw_ctx *hctx = blk_qc_to_hctx(q, qc);
-	struct request *rq = blk_qc_to_rq(hctx, qc);
 	struct hrtimer_sleeper hs;
 	enum hrtimer_mode mode;
-	unsigned int nsecs;
 	ktime_t kt;
 
-	/*
-	 * If a request has completed on queue that uses an I/O scheduler, we
-	 * won't get back a request from blk_qc_to_rq.
-	 */
-	if (!rq || (rq->rq_flags & RQF_MQ_POLL_SLEPT))
-		return false;
-
-	/*
-	 * If we get here, hybrid polling is enabled. Hence poll_nsec can be:
-	 *
-	 *  0:	use half of prev avg
-	 * >0:	use this specific value
-	 */
-	if (q->poll_nsec > 0)
-		nsecs = q->poll_nsec;
-	else
-		nsecs = blk_mq_poll_nsecs(q, rq);
-
-	if (!nsecs)
-		return false;
-
 	rq->rq_flags |= RQF_MQ_POLL_SLEPT;
 
 	/*
@@ -4848,6 +4982,36 @@ static bool blk_mq_poll_hybrid(struct request_queue *q, blk_qc_t qc)
 
 	__set_current_state(TASK_RUNNING);
 	destroy_hrtimer_on_stack(&hs.timer);
+}
+
+static bool blk_mq_poll_hybrid(struct request_queue *q, blk_qc_t qc)
+{
+	struct blk_mq_hw_ctx *hctx = blk_qc_to_hctx(q, qc);
+	struct request *rq = blk_qc_to_rq(hctx, qc);
+	unsigned int nsecs;
+
+	/*
+	 * If a request has completed on queue that uses an I/O scheduler, we
+	 * won't get back a request from blk_qc_to_rq.
+	 */
+	if (!rq || (rq->rq_flags & RQF_MQ_POLL_SLEPT))
+		return false;
+
+	/*
+	 * If we get here, hybrid polling is enabled. Hence poll_nsec can be:
+	 *
+	 *  0:	use half of prev avg
+	 * >0:	use this specific value
+	 */
+	if (q->poll_nsec > 0)
+		nsecs = q->poll_nsec;
+	else
+		nsecs = blk_mq_poll_nsecs(q, rq);
+
+	if (!nsecs)
+		return false;
+
+	blk_mq_poll_sleep(rq, nsecs);
 
 	/*
 	 * If we sleep, have the caller restart the poll loop to reset the
@@ -4887,9 +5051,106 @@ static int blk_mq_poll_classic(struct request_queue *q, blk_qc_t cookie,
 	return 0;
 }
 
+static u64 blk_mq_poll_adapt_nsecs(struct blk_mq_poll_adapt *pa, int bucket,
+				   struct request *rq, u64 now)
+{
+	u64 expected = READ_ONCE(pa->bkt[bucket].expected_ns);
+	u64 target, elapsed = 0;
+
+	if (!expected)
+		return 0;
+
+	target = (expected * READ_ONCE(pa->bkt[bucket].fraction)) >>
+			BLK_MQ_POLL_FRAC_SHIFT;
+
+	/* Time the request already spent in flight counts toward the target */
+	if (rq->io_start_time_ns && now > rq->io_start_time_ns)
+		elapsed = now - rq->io_start_time_ns;
+	if (target < elapsed + BLK_MQ_POLL_MIN_SLEEP_NS)
+		return 0;
+
+	return target - elapsed;
+}
+
+static void blk_mq_poll_adapt_update(struct blk_mq_poll_adapt *pa, int bucket,
+				     bool overslept)
+{
+	unsigned int frac = READ_ONCE(pa->bkt[bucket].fraction);
+
+	if (overslept) {
+		frac = max(frac - BLK_MQ_POLL_FRAC_DOWN, BLK_MQ_POLL_FRAC_MIN);
+		this_cpu_inc(pa->stat->overslept);
+	} else {
+		frac = min(frac + BLK_MQ_POLL_FRAC_UP, BLK_MQ_POLL_FRAC_MAX);
+	}
+
+	WRITE_ONCE(pa->bkt[bucket].fraction, frac);
+}
+
+static int blk_mq_poll_adaptive(struct request_queue *q, blk_qc_t qc,
+				struct blk_mq_poll_adapt *pa,
+				struct io_comp_batch *iob, unsigned int flags)
+{
+	struct blk_mq_hw_ctx *hctx = blk_qc_to_hctx(q, qc);
+	struct request *rq = blk_qc_to_rq(hctx, qc);
+	u64 start, nsecs, now;
+	int bucket, ret;
+
+	start = ktime_get_ns();
+	this_cpu_inc(pa->stat->polls);
+
+	if ((flags & BLK_POLL_NOSLEEP) || !rq ||
+	    (rq->rq_flags & RQF_MQ_POLL_SLEPT))
+		goto spin;
+
+	bucket = blk_mq_poll_adapt_bkt(rq);
+	if (bucket < 0)
+		goto spin;
+
+	nsecs = blk_mq_poll_adapt_nsecs(pa, bucket, rq, start);
+	if (!nsecs)
+		goto spin;
+
+	blk_mq_poll_sleep(rq, nsecs);
+
+	now = ktime_get_ns();
+	this_cpu_inc(pa->stat->sleeps);
+	this_cpu_add(pa->stat->slept_ns, now - start);
+	start = now;
+
+	/*
+	 * Poll once right after waking up. If completions were already
+	 * waiting, we slept past them. This may be another request on the
+	 * same hardware queue, which is as good a signal as our own.
+	 */
+	ret = q->mq_ops->poll(hctx, iob);
+	blk_mq_poll_adapt_update(pa, bucket, ret > 0);
+
+	this_cpu_add(pa->stat->spun_ns, ktime_get_ns() - start);
+
+	/*
+	 * As for hybrid polling, have the caller restart the poll loop. It
+	 * goes straight to busy polling if the IO isn't complete yet.
+	 */
+	return ret > 0 ? ret : 1;
+
+spin:
+	ret = blk_mq_poll_classic(q, qc, iob, flags);
+	this_cpu_add(pa->stat->spun_ns, ktime_get_ns() - start);
+	return ret;
+}
+
 int blk_mq_poll(struct request_queue *q, blk_qc_t cookie, struct io_comp_batch *iob,
 		unsigned int flags)
 {
+	if (q->poll_nsec == BLK_MQ_POLL_ADAPTIVE) {
+		struct blk_mq_poll_adapt *pa = smp_load_acquire(&q->poll_adapt);
+
+		if (pa)
+			return blk_mq_poll_adaptive(q, cookie, pa, iob, flags);
+		return blk_mq_poll_classic(q, cookie, iob, flags);
+	}
+
 	if (!(flags & BLK_POLL_NOSLEEP) &&
 	    q->poll_nsec != BLK_MQ_POLL_CLASSIC) {
 		if (blk_mq_poll_hybrid(q, cookie))
@@ -44,6 +44,9 @@ void blk_mq_flush_busy_ctxs(struct blk_mq_hw_ctx *hctx, struct list_head *list);
 struct request *blk_mq_dequeue_from_ctx(struct blk_mq_hw_ctx *hctx,
 					struct blk_mq_ctx *start);
 void blk_mq_put_rq_ref(struct request *rq);
+int blk_mq_poll_adapt_enable(struct request_queue *q);
+void blk_mq_poll_adapt_free(struct request_queue *q);
+ssize_t blk_mq_poll_adapt_show(struct request_queue *q, char *page);
 
 /*
  * Internal helpers for allocating/freeing the request map
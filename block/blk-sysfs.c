@@ -400,8 +400,9 @@ static ssize_t queue_poll_delay_show(struct request_queue *q, char *page)
 {
 	int val;
 
-	if (q->poll_nsec == BLK_MQ_POLL_CLASSIC)
-		val = BLK_MQ_POLL_CLASSIC;
+	if (q->poll_nsec == BLK_MQ_POLL_CLASSIC ||
+	    q->poll_nsec == BLK_MQ_POLL_ADAPTIVE)
+		val = q->poll_nsec;
 	else
 		val = q->poll_nsec / 1000;
 
@@ -420,16 +421,30 @@ static ssize_t queue_poll_delay_store(struct request_queue *q, const char *page,
 	if (err < 0)
 		return err;
 
-	if (val == BLK_MQ_POLL_CLASSIC)
+	if (val == BLK_MQ_POLL_CLASSIC) {
 		q->poll_nsec = BLK_MQ_POLL_CLASSIC;
-	else if (val >= 0)
+	} else if (val == BLK_MQ_POLL_ADAPTIVE) {
+		err = blk_mq_poll_adapt_enable(q);
+		if (err)
+			return err;
+		q->poll_nsec = BLK_MQ_POLL_ADAPTIVE;
+	} else if (val >= 0) {
 		q->poll_nsec = val * 1000;
-	else
+	} else {
 		return -EINVAL;
+	}
 
 	return count;
 }
 
+static ssize_t queue_poll_stats_show(struct request_queue *q, char *page)
+{
+	if (!q->mq_ops || !q->mq_ops->poll)
+		return -EINVAL;
+
+	return blk_mq_poll_adapt_show(q, page);
+}
+
 static ssize_t queue_poll_show(struct request_queue *q, char *page)
 {
 	return queue_var_show(test_bit(QUEUE_FLAG_POLL, &q->queue_flags), page);
@@ -608,6 +623,7 @@ QUEUE_RW_ENTRY(queue_nomerges, "nomerges");
 QUEUE_RW_ENTRY(queue_rq_affinity, "rq_affinity");
 QUEUE_RW_ENTRY(queue_poll, "io_poll");
 QUEUE_RW_ENTRY(queue_poll_delay, "io_poll_delay");
+QUEUE_RO_ENTRY(queue_poll_stats, "io_poll_stats");
 QUEUE_RW_ENTRY(queue_wc, "write_cache");
 QUEUE_RO_ENTRY(queue_fua, "fua");
 QUEUE_RO_ENTRY(queue_dax, "dax");
@@ -671,6 +687,7 @@ static struct attribute *queue_attrs[] = {
 	&queue_dax_entry.attr,
 	&queue_wb_lat_entry.attr,
 	&queue_poll_delay_entry.attr,
+	&queue_poll_stats_entry.attr,
 	&queue_io_timeout_entry.attr,
 #ifdef CONFIG_BLK_DEV_THROTTLING_LOW
 	&blk_throtl_sample_time_entry.attr,
@@ -775,6 +792,7 @@ static void blk_release_queue(struct kobject *kobj)
 	if (q->poll_stat)
 		blk_stat_remove_callback(q, q->poll_cb);
 	blk_stat_free_callback(q->poll_cb);
+	blk_mq_poll_adapt_free(q);
 
 	blk_free_queue_stats(q->stats);
 	kfree(q->poll_stat);
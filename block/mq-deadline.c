@@ -81,6 +81,18 @@ struct dd_per_prio {
 	struct io_stats_per_prio stats;
 };
 
+/*
+ * Per hardware queue insertion lists. Requests are queued here under a lock
+ * that is private to the hardware queue and only moved into the shared sort
+ * and FIFO lists, under dd->lock, when dispatching or merging. This keeps
+ * submitters on different hardware queues from contending on dd->lock.
+ */
+struct dd_hctx_data {
+	spinlock_t lock;
+	struct list_head at_head;
+	struct list_head at_tail;
+} ____cacheline_aligned_in_smp;
+
 struct deadline_data {
 	/*
 	 * run time data
@@ -88,6 +100,10 @@ struct deadline_data {
 
 	struct dd_per_prio per_prio[DD_PRIO_COUNT];
 
+	/* hardware queues with requests on their dd_hctx_data lists */
+	unsigned long *insert_pending;
+	unsigned int nr_hw_queues;
+
 	/* Data direction of latest dispatched request. */
 	enum dd_data_dir last_dir;
 	unsigned int batching;		/* number of sequential requests made */
@@ -561,6 +577,8 @@ static struct request *dd_dispatch_prio_aged_requests(struct deadline_data *dd,
 	return NULL;
 }
 
+static void dd_flush_inserts(struct request_queue *q, struct deadline_data *dd);
+
 /*
  * Called from blk_mq_run_hw_queue() -> __blk_mq_sched_dispatch_requests().
  *
@@ -577,6 +595,7 @@ static struct request *dd_dispatch_request(struct blk_mq_hw_ctx *hctx)
 	enum dd_prio prio;
 
 	spin_lock(&dd->lock);
+	dd_flush_inserts(hctx->queue, dd);
 	rq = dd_dispatch_prio_aged_requests(dd, now);
 	if (rq)
 		goto unlock;
@@ -631,10 +650,30 @@ static void dd_depth_updated(struct blk_mq_hw_ctx *hctx)
 /* Called by blk_mq_init_hctx() and blk_mq_init_sched(). */
 static int dd_init_hctx(struct blk_mq_hw_ctx *hctx, unsigned int hctx_idx)
 {
+	struct dd_hctx_data *dhd;
+
+	dhd = kmalloc_node(sizeof(*dhd), GFP_KERNEL, hctx->numa_node);
+	if (!dhd)
+		return -ENOMEM;
+
+	spin_lock_init(&dhd->lock);
+	INIT_LIST_HEAD(&dhd->at_head);
+	INIT_LIST_HEAD(&dhd->at_tail);
+	hctx->sched_data = dhd;
+
 	dd_depth_updated(hctx);
 	return 0;
 }
 
+static void dd_exit_hctx(struct blk_mq_hw_ctx *hctx, unsigned int hctx_idx)
+{
+	struct dd_hctx_data *dhd = hctx->sched_data;
+
+	WARN_ON_ONCE(!list_empty(&dhd->at_head));
+	WARN_ON_ONCE(!list_empty(&dhd->at_tail));
+	kfree(dhd);
+}
+
 static void dd_exit_sched(struct elevator_queue *e)
 {
 	struct deadline_data *dd = e->elevator_data;
@@ -658,6 +697,7 @@ static void dd_exit_sched(struct elevator_queue *e)
 			  stats->dispatched, atomic_read(&stats->completed));
 	}
 
+	bitmap_free(dd->insert_pending);
 	kfree(dd);
 }
 
@@ -679,6 +719,12 @@ static int dd_init_sched(struct request_queue *q, struct elevator_type *e)
 	if (!dd)
 		goto put_eq;
 
+	dd->nr_hw_queues = q->nr_hw_queues;
+	dd->insert_pending = bitmap_zalloc_node(dd->nr_hw_queues, GFP_KERNEL,
+						q->node);
+	if (!dd->insert_pending)
+		goto free_dd;
+
 	eq->elevator_data = dd;
 
 	for (prio = 0; prio <= DD_PRIO_MAX; prio++) {
@@ -706,6 +752,8 @@ static int dd_init_sched(struct request_queue *q, struct elevator_type *e)
 	q->elevator = eq;
 	return 0;
 
+free_dd:
+	kfree(dd);
 put_eq:
 	kobject_put(&eq->kobj);
 	return ret;
@@ -743,6 +791,27 @@ static int dd_request_merge(struct request_queue *q, struct request **rq,
 	return ELEVATOR_NO_MERGE;
 }
 
+/*
+ * Whether any request is waiting to be dispatched that a bio could be merged
+ * into. Checked without dd->lock: missing a merge with a request that is being
+ * inserted concurrently only costs a merge opportunity.
+ */
+static bool dd_has_merge_candidates(struct deadline_data *dd)
+{
+	enum dd_prio prio;
+	enum dd_data_dir dir;
+
+	if (!bitmap_empty(dd->insert_pending, dd->nr_hw_queues))
+		return true;
+
+	for (prio = 0; prio <= DD_PRIO_MAX; prio++)
+		for (dir = DD_READ; dir <= DD_WRITE; dir++)
+			if (!RB_EMPTY_ROOT(&dd->per_prio[prio].sort_list[dir]))
+				return true;
+
+	return false;
+}
+
 /*
  * Attempt to merge a bio into an existing request. This function is called
  * before @bio is associated with a request.
@@ -754,7 +823,12 @@ static bool dd_bio_merge(struct request_queue *q, struct bio *bio,
 	struct request *free = NULL;
 	bool ret;
 
+	/* Nothing queued to merge with, don't touch dd->lock */
+	if (!dd_has_merge_candidates(dd))
+		return false;
+
 	spin_lock(&dd->lock);
+	dd_flush_inserts(q, dd);
 	ret = blk_mq_sched_try_merge(q, bio, nr_segs, &free);
 	spin_unlock(&dd->lock);
 
@@ -781,12 +855,6 @@ static void dd_insert_request(struct blk_mq_hw_ctx *hctx, struct request *rq,
 
 	lockdep_assert_held(&dd->lock);
 
-	/*
-	 * This may be a requeue of a write request that has locked its
-	 * target zone. If it is the case, this releases the zone lock.
-	 */
-	blk_req_zone_write_unlock(rq);
-
 	prio = ioprio_class_to_prio[ioprio_class];
 	per_prio = &dd->per_prio[prio];
 	if (!rq->elv.priv[0]) {
@@ -801,9 +869,9 @@ static void dd_insert_request(struct blk_mq_hw_ctx *hctx, struct request *rq,
 
 	trace_block_rq_insert(rq);
 
+	/* ->fifo_time holds the time the request was queued to the hctx */
 	if (at_head) {
 		list_add(&rq->queuelist, &per_prio->dispatch);
-		rq->fifo_time = jiffies;
 	} else {
 		deadline_add_rq_rb(per_prio, rq);
 
@@ -816,11 +884,56 @@ static void dd_insert_request(struct blk_mq_hw_ctx *hctx, struct request *rq,
 		/*
 		 * set expire time and add to fifo list
 		 */
-		rq->fifo_time = jiffies + dd->fifo_expire[data_dir];
+		rq->fifo_time += dd->fifo_expire[data_dir];
 		list_add_tail(&rq->queuelist, &per_prio->fifo_list[data_dir]);
 	}
 }
 
+/*
+ * Move the requests queued on the per hardware queue lists into the sort and
+ * FIFO lists. Requests keep the time they were queued at, so deadlines and
+ * write starvation are accounted the same as if they had been inserted
+ * directly.
+ */
+static void dd_flush_inserts(struct request_queue *q, struct deadline_data *dd)
+{
+	unsigned int i;
+
+	lockdep_assert_held(&dd->lock);
+
+	for_each_set_bit(i, dd->insert_pending, dd->nr_hw_queues) {
+		struct blk_mq_hw_ctx *hctx;
+		struct dd_hctx_data *dhd;
+		LIST_HEAD(at_head);
+		LIST_HEAD(at_tail);
+
+		if (!test_and_clear_bit(i, dd->insert_pending))
+			continue;
+
+		hctx = xa_load(&q->hctx_table, i);
+		dhd = hctx->sched_data;
+		spin_lock(&dhd->lock);
+		list_splice_init(&dhd->at_head, &at_head);
+		list_splice_init(&dhd->at_tail, &at_tail);
+		spin_unlock(&dhd->lock);
+
+		while (!list_empty(&at_head)) {
+			struct request *rq;
+
+			rq = list_first_entry(&at_head, struct request, queuelist);
+			list_del_init(&rq->queuelist);
+			dd_insert_request(hctx, rq, true);
+		}
+		while (!list_empty(&at_tail)) {
+			struct request *rq;
+
+			rq = list_first_entry(&at_tail, struct request, queuelist);
+			list_del_init(&rq->queuelist);
+			dd_insert_request(hctx, rq, false);
+		}
+	}
+}
+
 /*
  * Called from blk_mq_sched_insert_request() or blk_mq_sched_insert_requests().
  */
@@ -829,16 +942,25 @@ static void dd_insert_requests(struct blk_mq_hw_ctx *hctx,
 {
 	struct request_queue *q = hctx->queue;
 	struct deadline_data *dd = q->elevator->elevator_data;
+	struct dd_hctx_data *dhd = hctx->sched_data;
+	const unsigned long now = jiffies;
+	struct request *rq;
 
-	spin_lock(&dd->lock);
-	while (!list_empty(list)) {
-		struct request *rq;
-
-		rq = list_first_entry(list, struct request, queuelist);
-		list_del_init(&rq->queuelist);
-		dd_insert_request(hctx, rq, at_head);
+	list_for_each_entry(rq, list, queuelist) {
+		/*
+		 * This may be a requeue of a write request that has locked its
+		 * target zone. If it is the case, this releases the zone lock.
+		 */
+		blk_req_zone_write_unlock(rq);
+		rq->fifo_time = now;
 	}
-	spin_unlock(&dd->lock);
+
+	spin_lock(&dhd->lock);
+	list_splice_tail_init(list, at_head ? &dhd->at_head : &dhd->at_tail);
+	spin_unlock(&dhd->lock);
+
+	/* pairs with test_and_clear_bit() in dd_flush_inserts() */
+	set_bit(hctx->queue_num, dd->insert_pending);
 }
 
 /* Callback from inside blk_mq_rq_ctx_init(). */
@@ -852,6 +974,9 @@ static bool dd_has_write_work(struct blk_mq_hw_ctx *hctx)
 	struct deadline_data *dd = hctx->queue->elevator->elevator_data;
 	enum dd_prio p;
 
+	if (!bitmap_empty(dd->insert_pending, dd->nr_hw_queues))
+		return true;
+
 	for (p = 0; p <= DD_PRIO_MAX; p++)
 		if (!list_empty_careful(&dd->per_prio[p].fifo_list[DD_WRITE]))
 			return true;
@@ -917,6 +1042,9 @@ static bool dd_has_work(struct blk_mq_hw_ctx *hctx)
 	struct deadline_data *dd = hctx->queue->elevator->elevator_data;
 	enum dd_prio prio;
 
+	if (!bitmap_empty(dd->insert_pending, dd->nr_hw_queues))
+		return true;
+
 	for (prio = 0; prio <= DD_PRIO_MAX; prio++)
 		if (dd_has_work_for_prio(&dd->per_prio[prio]))
 			return true;
@@ -1216,6 +1344,7 @@ static struct elevator_type mq_deadline = {
 		.init_sched		= dd_init_sched,
 		.exit_sched		= dd_exit_sched,
 		.init_hctx		= dd_init_hctx,
+		.exit_hctx		= dd_exit_hctx,
 	},
 
 #ifdef CONFIG_BLK_DEBUG_FS
@@ -19,6 +19,7 @@
 #include <crypto/aead.h>
 #include <crypto/hash.h>
 #include <crypto/skcipher.h>
+#include <crypto/xts.h>
 #include <linux/err.h>
 #include <linux/fips.h>
 #include <linux/module.h>
@@ -292,6 +293,8 @@ struct test_sg_division {
  * @key_offset_relative_to_alignmask: if true, add the algorithm's alignmask to
  *				      the @key_offset
  * @finalization_type: what finalization function to use for hashes
+ * @finup_mb: with FINALIZATION_TYPE_FINUP, use crypto_shash_finup_mb() on two
+ *	      messages instead of crypto_shash_finup().  Ignored for ahashes.
  * @nosimd: execute with SIMD disabled?  Requires !CRYPTO_TFM_REQ_MAY_SLEEP.
  */
 struct testvec_config {
@@ -305,6 +308,7 @@ struct testvec_config {
 	bool iv_offset_relative_to_alignmask;
 	bool key_offset_relative_to_alignmask;
 	enum finalization_type finalization_type;
+	bool finup_mb;
 	bool nosimd;
 };
 
@@ -390,6 +394,11 @@ static const struct testvec_config default_hash_testvec_configs[] = {
 		.name = "init+finup aligned buffer",
 		.src_divs = { { .proportion_of_total = 10000 } },
 		.finalization_type = FINALIZATION_TYPE_FINUP,
+	}, {
+		.name = "init+finup_mb aligned buffer",
+		.src_divs = { { .proportion_of_total = 10000 } },
+		.finalization_type = FINALIZATION_TYPE_FINUP,
+		.finup_mb = true,
 	}, {
 		.name = "digest aligned buffer",
 		.src_divs = { { .proportion_of_total = 10000 } },
@@ -1063,6 +1072,10 @@ static void generate_random_testvec_config(struct testvec_config *cfg,
 	case 1:
 		cfg->finalization_type = FINALIZATION_TYPE_FINUP;
 		p += scnprintf(p, end - p, " use_finup");
+		if (prandom_u32_max(2) == 0) {
+			cfg->finup_mb = true;
+			p += scnprintf(p, end - p, "_mb");
+		}
 		break;
 	default:
 		cfg->finalization_type = FINALIZATION_TYPE_DIGEST;
@@ -1215,6 +1228,68 @@ static inline int check_shash_op(const char *op, int err,
 	return err;
 }
 
+/*
+ * Finish the hash with crypto_shash_finup_mb() instead of crypto_shash_finup().
+ * The test vector's data is the first message.  The second message is a copy
+ * of it with the last byte flipped, so that mixing up the two lanes of a
+ * multi-buffer implementation is caught; its digest is checked against a plain
+ * finup() of the same data starting from the same state.
+ */
+static int do_shash_finup_mb(struct shash_desc *desc, const u8 *data,
+			     unsigned int len, u8 *result, u8 *hashstate,
+			     const struct test_sg_division *div,
+			     const char *driver, const char *vec_name,
+			     const struct testvec_config *cfg)
+{
+	struct crypto_shash *tfm = desc->tfm;
+	const unsigned int digestsize = crypto_shash_digestsize(tfm);
+	u8 other_result[HASH_MAX_DIGESTSIZE];
+	u8 expected[HASH_MAX_DIGESTSIZE];
+	const u8 *datas[2];
+	u8 *outs[2];
+	u8 *other;
+	int err;
+
+	other = kmemdup(data, len, GFP_KERNEL);
+	if (!other)
+		return -ENOMEM;
+	if (len)
+		other[len - 1] ^= 0xff;
+
+	err = crypto_shash_export(desc, hashstate);
+	err = check_shash_op("export", err, driver, vec_name, cfg);
+	if (err)
+		goto out;
+
+	datas[0] = data;
+	datas[1] = other;
+	outs[0] = result;
+	outs[1] = other_result;
+	if (div->nosimd)
+		crypto_disable_simd_for_test();
+	err = crypto_shash_finup_mb(desc, datas, len, outs, 2);
+	if (div->nosimd)
+		crypto_reenable_simd_for_test();
+	err = check_shash_op("finup_mb", err, driver, vec_name, cfg);
+	if (err)
+		goto out;
+
+	err = crypto_shash_import(desc, hashstate) ?:
+	      crypto_shash_finup(desc, other, len, expected);
+	err = check_shash_op("finup", err, driver, vec_name, cfg);
+	if (err)
+		goto out;
+
+	if (memcmp(other_result, expected, digestsize) != 0) {
+		pr_err("alg: shash: %s finup_mb() gave a wrong digest for the second message on test vector %s, cfg=\"%s\"\n",
+		       driver, vec_name, cfg->name);
+		err = -EINVAL;
+	}
+out:
+	kfree(other);
+	return err;
+}
+
 /* Test one hash test vector in one configuration, using the shash API */
 static int test_shash_vec_cfg(const struct hash_testvec *vec,
 			      const char *vec_name,
@@ -1304,6 +1379,17 @@ static int test_shash_vec_cfg(const struct hash_testvec *vec,
 		return err;
 
 	for (i = 0; i < tsgl->nents; i++) {
+		if (i + 1 == tsgl->nents &&
+		    cfg->finalization_type == FINALIZATION_TYPE_FINUP &&
+		    cfg->finup_mb) {
+			err = do_shash_finup_mb(desc, sg_virt(&tsgl->sgl[i]),
+						tsgl->sgl[i].length, result,
+						hashstate, divs[i], driver,
+						vec_name, cfg);
+			if (err)
+				return err;
+			goto result_ready;
+		}
 		if (i + 1 == tsgl->nents &&
 		    cfg->finalization_type == FINALIZATION_TYPE_FINUP) {
 			if (divs[i]->nosimd)
@@ -2944,6 +3030,30 @@ static int test_skcipher_vec(int enc, const struct cipher_testvec *vec,
  * Generate a symmetric cipher test vector from the given implementation.
  * Assumes the buffers in 'vec' were already allocated.
  */
+/*
+ * xts-plain64 rejects IVs without a 512 to 4096 byte data unit and lengths
+ * that aren't a multiple of it, which random IVs and lengths nearly always
+ * are. Make most vectors valid: one or more whole data units.
+ */
+static void fixup_xts_plain64_testvec(struct cipher_testvec *vec,
+				      unsigned int maxdatasize)
+{
+	struct xts_plain64_iv *iv = (struct xts_plain64_iv *)vec->iv;
+	unsigned int du_bits = 9 + prandom_u32_max(4);
+
+	if (prandom_u32_max(8) == 0)
+		return;
+
+	while (du_bits > 9 && (1U << du_bits) > maxdatasize)
+		du_bits--;
+	if ((1U << du_bits) > maxdatasize)
+		return;
+
+	iv->du_bits = du_bits;
+	memset(iv->reserved, 0, sizeof(iv->reserved));
+	vec->len = (1 + prandom_u32_max(maxdatasize >> du_bits)) << du_bits;
+}
+
 static void generate_random_cipher_testvec(struct skcipher_request *req,
 					   struct cipher_testvec *vec,
 					   unsigned int maxdatasize,
@@ -2968,6 +3078,9 @@ static void generate_random_cipher_testvec(struct skcipher_request *req,
 
 	/* Plaintext */
 	vec->len = generate_random_length(maxdatasize);
+	if (strncmp(crypto_skcipher_alg(tfm)->base.cra_name,
+		    "xts-plain64(", 12) == 0)
+		fixup_xts_plain64_testvec(vec, maxdatasize);
 	generate_random_bytes((u8 *)vec->ptext, vec->len);
 
 	/* If the key couldn't be set, no need to continue to encrypt. */
@@ -5657,6 +5770,13 @@ static const struct alg_test_desc alg_test_descs[] = {
 		}
 	}, {
 #endif
+		.alg = "xts-plain64(aes)",
+		.generic_driver = "xts-plain64(xts(ecb(aes-generic)))",
+		.test = alg_test_skcipher,
+		.suite = {
+			.cipher = __VECS(aes_xts_plain64_tv_template)
+		}
+	}, {
 		.alg = "xts4096(paes)",
 		.test = alg_test_null,
 		.fips_allowed = 1,
@@ -18478,6 +18478,4293 @@ static const struct cipher_testvec aes_xts_tv_template[] = {
 	}
 };
 
+/*
+ * xts-plain64: one request covers consecutive data units, each encrypted as
+ * xts(aes) with the plain64 IV of its own sector. The vectors were generated
+ * that way, one data unit at a time. The IV holds the first sector (le64)
+ * and log2 of the data unit size.
+ */
+static const struct cipher_testvec aes_xts_plain64_tv_template[] = {
+	{ /* 2 units of 512 bytes */
+		.key	= "\x01\x08\x0f\x16\x1d\x24\x2b\x32"
+			  "\x39\x40\x47\x4e\x55\x5c\x63\x6a"
+			  "\x71\x78\x7f\x86\x8d\x94\x9b\xa2"
+			  "\xa9\xb0\xb7\xbe\xc5\xcc\xd3\xda",
+		.klen	= 32,
+		.iv	= "\x34\x12\x00\x00\x00\x00\x00\x00"
+			  "\x09\x00\x00\x00\x00\x00\x00\x00",
+		.ptext	= "\x05\x12\x1f\x2c\x39\x46\x53\x60"
+			  "\x6d\x7a\x87\x94\xa1\xae\xbb\xc8"
+			  "\xd5\xe2\xef\xfc\x09\x16\x23\x30"
+			  "\x3d\x4a\x57\x64\x71\x7e\x8b\x98"
+			  "\xa5\xb2\xbf\xcc\xd9\xe6\xf3\x00"
+			  "\x0d\x1a\x27\x34\x41\x4e\x5b\x68"
+			  "\x75\x82\x8f\x9c\xa9\xb6\xc3\xd0"
+			  "\xdd\xea\xf7\x04\x11\x1e\x2b\x38"
+			  "\x45\x52\x5f\x6c\x79\x86\x93\xa0"
+			  "\xad\xba\xc7\xd4\xe1\xee\xfb\x08"
+			  "\x15\x22\x2f\x3c\x49\x56\x63\x70"
+			  "\x7d\x8a\x97\xa4\xb1\xbe\xcb\xd8"
+			  "\xe5\xf2\xff\x0c\x19\x26\x33\x40"
+			  "\x4d\x5a\x67\x74\x81\x8e\x9b\xa8"
+			  "\xb5\xc2\xcf\xdc\xe9\xf6\x03\x10"
+			  "\x1d\x2a\x37\x44\x51\x5e\x6b\x78"
+			  "\x85\x92\x9f\xac\xb9\xc6\xd3\xe0"
+			  "\xed\xfa\x07\x14\x21\x2e\x3b\x48"
+			  "\x55\x62\x6f\x7c\x89\x96\xa3\xb0"
+			  "\xbd\xca\xd7\xe4\xf1\xfe\x0b\x18"
+			  "\x25\x32\x3f\x4c\x59\x66\x73\x80"
+			  "\x8d\x9a\xa7\xb4\xc1\xce\xdb\xe8"
+			  "\xf5\x02\x0f\x1c\x29\x36\x43\x50"
+			  "\x5d\x6a\x77\x84\x91\x9e\xab\xb8"
+			  "\xc5\xd2\xdf\xec\xf9\x06\x13\x20"
+			  "\x2d\x3a\x47\x54\x61\x6e\x7b\x88"
+			  "\x95\xa2\xaf\xbc\xc9\xd6\xe3\xf0"
+			  "\xfd\x0a\x17\x24\x31\x3e\x4b\x58"
+			  "\x65\x72\x7f\x8c\x99\xa6\xb3\xc0"
+			  "\xcd\xda\xe7\xf4\x01\x0e\x1b\x28"
+			  "\x35\x42\x4f\x5c\x69\x76\x83\x90"
+			  "\x9d\xaa\xb7\xc4\xd1\xde\xeb\xf8"
+			  "\x05\x12\x1f\x2c\x39\x46\x53\x60"
+			  "\x6d\x7a\x87\x94\xa1\xae\xbb\xc8"
+			  "\xd5\xe2\xef\xfc\x09\x16\x23\x30"
+			  "\x3d\x4a\x57\x64\x71\x7e\x8b\x98"
+			  "\xa5\xb2\xbf\xcc\xd9\xe6\xf3\x00"
+			  "\x0d\x1a\x27\x34\x41\x4e\x5b\x68"
+			  "\x75\x82\x8f\x9c\xa9\xb6\xc3\xd0"
+			  "\xdd\xea\xf7\x04\x11\x1e\x2b\x38"
+			  "\x45\x52\x5f\x6c\x79\x86\x93\xa0"
+			  "\xad\xba\xc7\xd4\xe1\xee\xfb\x08"
+			  "\x15\x22\x2f\x3c\x49\x56\x63\x70"
+			  "\x7d\x8a\x97\xa4\xb1\xbe\xcb\xd8"
+			  "\xe5\xf2\xff\x0c\x19\x26\x33\x40"
+			  "\x4d\x5a\x67\x74\x81\x8e\x9b\xa8"
+			  "\xb5\xc2\xcf\xdc\xe9\xf6\x03\x10"
+			  "\x1d\x2a\x37\x44\x51\x5e\x6b\x78"
+			  "\x85\x92\x9f\xac\xb9\xc6\xd3\xe0"
+			  "\xed\xfa\x07\x14\x21\x2e\x3b\x48"
+			  "\x55\x62\x6f\x7c\x89\x96\xa3\xb0"
+			  "\xbd\xca\xd7\xe4\xf1\xfe\x0b\x18"
+			  "\x25\x32\x3f\x4c\x59\x66\x73\x80"
+			  "\x8d\x9a\xa7\xb4\xc1\xce\xdb\xe8"
+			  "\xf5\x02\x0f\x1c\x29\x36\x43\x50"
+			  "\x5d\x6a\x77\x84\x91\x9e\xab\xb8"
+			  "\xc5\xd2\xdf\xec\xf9\x06\x13\x20"
+			  "\x2d\x3a\x47\x54\x61\x6e\x7b\x88"
+			  "\x95\xa2\xaf\xbc\xc9\xd6\xe3\xf0"
+			  "\xfd\x0a\x17\x24\x31\x3e\x4b\x58"
+			  "\x65\x72\x7f\x8c\x99\xa6\xb3\xc0"
+			  "\xcd\xda\xe7\xf4\x01\x0e\x1b\x28"
+			  "\x35\x42\x4f\x5c\x69\x76\x83\x90"
+			  "\x9d\xaa\xb7\xc4\xd1\xde\xeb\xf8"
+			  "\x05\x12\x1f\x2c\x39\x46\x53\x60"
+			  "\x6d\x7a\x87\x94\xa1\xae\xbb\xc8"
+			  "\xd5\xe2\xef\xfc\x09\x16\x23\x30"
+			  "\x3d\x4a\x57\x64\x71\x7e\x8b\x98"
+			  "\xa5\xb2\xbf\xcc\xd9\xe6\xf3\x00"
+			  "\x0d\x1a\x27\x34\x41\x4e\x5b\x68"
+			  "\x75\x82\x8f\x9c\xa9\xb6\xc3\xd0"
+			  "\xdd\xea\xf7\x04\x11\x1e\x2b\x38"
+			  "\x45\x52\x5f\x6c\x79\x86\x93\xa0"
+			  "\xad\xba\xc7\xd4\xe1\xee\xfb\x08"
+			  "\x15\x22\x2f\x3c\x49\x56\x63\x70"
+			  "\x7d\x8a\x97\xa4\xb1\xbe\xcb\xd8"
+			  "\xe5\xf2\xff\x0c\x19\x26\x33\x40"
+			  "\x4d\x5a\x67\x74\x81\x8e\x9b\xa8"
+			  "\xb5\xc2\xcf\xdc\xe9\xf6\x03\x10"
+			  "\x1d\x2a\x37\x44\x51\x5e\x6b\x78"
+			  "\x85\x92\x9f\xac\xb9\xc6\xd3\xe0"
+			  "\xed\xfa\x07\x14\x21\x2e\x3b\x48"
+			  "\x55\x62\x6f\x7c\x89\x96\xa3\xb0"
+			  "\xbd\xca\xd7\xe4\xf1\xfe\x0b\x18"
+			  "\x25\x32\x3f\x4c\x59\x66\x73\x80"
+			  "\x8d\x9a\xa7\xb4\xc1\xce\xdb\xe8"
+			  "\xf5\x02\x0f\x1c\x29\x36\x43\x50"
+			  "\x5d\x6a\x77\x84\x91\x9e\xab\xb8"
+			  "\xc5\xd2\xdf\xec\xf9\x06\x13\x20"
+			  "\x2d\x3a\x47\x54\x61\x6e\x7b\x88"
+			  "\x95\xa2\xaf\xbc\xc9\xd6\xe3\xf0"
+			  "\xfd\x0a\x17\x24\x31\x3e\x4b\x58"
+			  "\x65\x72\x7f\x8c\x99\xa6\xb3\xc0"
+			  "\xcd\xda\xe7\xf4\x01\x0e\x1b\x28"
+			  "\x35\x42\x4f\x5c\x69\x76\x83\x90"
+			  "\x9d\xaa\xb7\xc4\xd1\xde\xeb\xf8"
+			  "\x05\x12\x1f\x2c\x39\x46\x53\x60"
+			  "\x6d\x7a\x87\x94\xa1\xae\xbb\xc8"
+			  "\xd5\xe2\xef\xfc\x09\x16\x23\x30"
+			  "\x3d\x4a\x57\x64\x71\x7e\x8b\x98"
+			  "\xa5\xb2\xbf\xcc\xd9\xe6\xf3\x00"
+			  "\x0d\x1a\x27\x34\x41\x4e\x5b\x68"
+			  "\x75\x82\x8f\x9c\xa9\xb6\xc3\xd0"
+			  "\xdd\xea\xf7\x04\x11\x1e\x2b\x38"
+			  "\x45\x52\x5f\x6c\x79\x86\x93\xa0"
+			  "\xad\xba\xc7\xd4\xe1\xee\xfb\x08"
+			  "\x15\x22\x2f\x3c\x49\x56\x63\x70"
+			  "\x7d\x8a\x97\xa4\xb1\xbe\xcb\xd8"
+			  "\xe5\xf2\xff\x0c\x19\x26\x33\x40"
+			  "\x4d\x5a\x67\x74\x81\x8e\x9b\xa8"
+			  "\xb5\xc2\xcf\xdc\xe9\xf6\x03\x10"
+			  "\x1d\x2a\x37\x44\x51\x5e\x6b\x78"
+			  "\x85\x92\x9f\xac\xb9\xc6\xd3\xe0"
+			  "\xed\xfa\x07\x14\x21\x2e\x3b\x48"
+			  "\x55\x62\x6f\x7c\x89\x96\xa3\xb0"
+			  "\xbd\xca\xd7\xe4\xf1\xfe\x0b\x18"
+			  "\x25\x32\x3f\x4c\x59\x66\x73\x80"
+			  "\x8d\x9a\xa7\xb4\xc1\xce\xdb\xe8"
+			  "\xf5\x02\x0f\x1c\x29\x36\x43\x50"
+			  "\x5d\x6a\x77\x84\x91\x9e\xab\xb8"
+			  "\xc5\xd2\xdf\xec\xf9\x06\x13\x20"
+			  "\x2d\x3a\x47\x54\x61\x6e\x7b\x88"
+			  "\x95\xa2\xaf\xbc\xc9\xd6\xe3\xf0"
+			  "\xfd\x0a\x17\x24\x31\x3e\x4b\x58"
+			  "\x65\x72\x7f\x8c\x99\xa6\xb3\xc0"
+			  "\xcd\xda\xe7\xf4\x01\x0e\x1b\x28"
+			  "\x35\x42\x4f\x5c\x69\x76\x83\x90"
+			  "\x9d\xaa\xb7\xc4\xd1\xde\xeb\xf8",
+		.ctext	= "\x52\xe4\x32\x6d\xe8\x32\x37\x69"
+			  "\x70\xa8\x4e\x11\xb3\x11\x9c\x19"
+			  "\xd3\x07\xdf\x67\x3a\xfa\xa1\x77"
+			  "\x1c\xf7\x27\x8d\x27\x7d\x76\x0a"
+			  "\xde\x67\x6e\xee\x05\x5d\xbd\x2a"
+			  "\xc8\xd3\xea\x44\xe1\xea\x79\x68"
+			  "\x54\xba\x70\x67\x22\x60\x71\x10"
+			  "\xa1\xa8\x70\x6f\xb3\xe5\x69\x7b"
+			  "\xfd\x72\xb8\xa1\x07\x0f\xf7\x14"
+			  "\x04\x95\x8a\x8d\x0e\x22\xe7\x95"
+			  "\xc9\x31\x43\x4b\xf8\xf6\x3e\x88"
+			  "\xa3\x4f\x7f\x96\xd7\x8a\xa9\xf2"
+			  "\x1f\x91\x80\x70\xa9\xa9\xdd\xc8"
+			  "\x50\x45\xb5\x9e\x12\xe0\x03\xeb"
+			  "\x95\x4e\x6a\xe6\xda\x88\xe0\x25"
+			  "\x57\x78\x9a\x2f\x58\x34\x58\x4c"
+			  "\x01\xea\xd3\x4b\xe9\xdc\x53\x5e"
+			  "\x46\x68\x91\x05\x2d\x31\x93\xb3"
+			  "\x47\xca\x12\x6d\x13\x41\x82\x6a"
+			  "\x97\xdb\x6c\x45\x0e\x21\x55\xe1"
+			  "\x8e\xf2\xbf\xb5\x1f\x14\x39\x1b"
+			  "\xe3\xb4\x38\x74\x2e\xfb\x42\x9e"
+			  "\xab\xa4\xae\x70\xd0\x4f\x83\x67"
+			  "\xcb\xab\x55\x65\x63\x64\x03\x1f"
+			  "\x4e\x1a\x78\xf1\x84\x70\xd0\xc2"
+			  "\x29\x95\x77\x1e\x73\xbf\xb4\x54"
+			  "\x3f\x9d\xcb\xfe\xf7\x88\xc1\x01"
+			  "\x27\xc4\x4b\xc3\xe4\xfa\x5c\x9a"
+			  "\xe7\xb0\x6b\xd9\xc0\x51\x0c\x3d"
+			  "\x86\x68\xba\x11\x64\xee\x3d\x76"
+			  "\xe4\x40\x71\xd6\x13\x2c\xd5\xc0"
+			  "\x02\xad\xaf\xfe\xaa\x2c\x33\x19"
+			  "\x25\xdb\xe0\x8c\xc6\x95\x4e\xbd"
+			  "\x09\x74\x8d\x12\xf8\x7a\x96\xd4"
+			  "\xf0\x34\xb2\xb9\xc7\x2e\x27\x14"
+			  "\xdc\x3c\x54\xcf\xf3\x28\xdd\x92"
+			  "\x3a\x00\x9b\x05\xa9\x23\xd4\x12"
+			  "\xed\xe9\xc4\x6d\x93\x7f\x32\xca"
+			  "\x0c\xe1\x20\xbf\xda\x5c\x24\x30"
+			  "\x40\xb0\x1c\x43\xed\xb8\x02\x0f"
+			  "\xa0\xcf\x6a\x0d\xca\x79\xd6\x2b"
+			  "\x3f\xe8\x55\x54\xf3\x2a\x13\x13"
+			  "\x60\x8e\xb2\xa7\xa0\x41\x80\x37"
+			  "\xf5\x4f\x7d\x84\x00\x3b\x91\x2f"
+			  "\xfd\x90\xbb\xe9\xa7\x34\xa1\x52"
+			  "\xb2\x5d\xff\xa0\x4c\x7a\xd2\x0f"
+			  "\xd9\x6a\x16\x43\x31\x81\xb4\xfb"
+			  "\x18\xc7\x35\x09\xbd\xf1\x0b\x67"
+			  "\x95\x16\xf9\xa6\xc6\x98\x4a\x06"
+			  "\x36\x6c\x43\xda\x1f\xc7\x2b\xbd"
+			  "\xe6\xc0\x7e\x93\xe6\x1b\x81\x9d"
+			  "\x49\x33\xbc\xb6\x9c\x51\x25\x50"
+			  "\x08\x99\x4c\x00\xc0\x12\x63\x56"
+			  "\xb9\x3d\x91\x94\x29\x35\xc9\x41"
+			  "\x80\x8d\x6b\x3a\x06\x2e\x89\xb7"
+			  "\x66\xd5\xb0\x26\xb2\x6f\x58\x18"
+			  "\x2b\x72\x3d\xe8\xf2\x4e\x40\xd5"
+			  "\xcf\xd6\x74\x02\x94\xb5\x5e\x11"
+			  "\x72\xf8\x2e\x8c\xdf\xf8\x05\x86"
+			  "\xf7\xaf\xff\x6c\xce\x8b\x89\x20"
+			  "\xd2\x0a\x7c\x90\x3d\x06\x66\x99"
+			  "\x65\x34\x23\x39\x8d\xf8\xef\xd2"
+			  "\xfb\x12\xcd\x9e\xf1\x07\x66\xb4"
+			  "\x43\x12\xd5\x0a\x34\x3e\x23\xb8"
+			  "\xcd\x62\x02\xd0\x06\xf9\x5e\xcf"
+			  "\xd0\x54\xe5\x47\xb5\x43\xa4\x4c"
+			  "\xc1\x1e\x6e\xbd\xef\xe0\xcd\x43"
+			  "\x81\xa6\xbf\xb2\x90\x00\x49\x99"
+			  "\xb0\x28\xb1\x09\x93\xa9\x0c\xcb"
+			  "\x55\xbf\xbb\x38\x5a\xdb\xeb\x84"
+			  "\x4f\xac\x69\x9a\xea\x6a\xe3\x6e"
+			  "\xdc\x18\xe4\x04\xfa\xf0\x2e\x50"
+			  "\x3a\xff\x9e\xe0\x9f\x8f\x69\x00"
+			  "\x8e\xfa\x12\x32\x72\xe7\x34\x02"
+			  "\x2e\x96\xe4\x36\x3a\xd6\x57\x9d"
+			  "\xf2\x17\xeb\xbc\x74\x3f\xf2\x79"
+			  "\x59\x19\xbe\xb3\x3a\x93\x34\x31"
+			  "\xf6\x5b\xb3\xe9\x2a\x0f\xb9\xad"
+			  "\x62\x0b\xf3\x9d\xd1\xf1\x14\xd7"
+			  "\x07\xea\xf0\x1b\x58\x26\x85\x72"
+			  "\x37\xf2\x1a\xd5\x62\xf7\xa2\x7b"
+			  "\x87\x7e\x86\xd4\x32\x66\x62\x04"
+			  "\x8c\x1c\x4c\xd5\x8b\xa9\x4b\xf7"
+			  "\x44\xb1\x5e\x63\xea\x3b\xdc\xd5"
+			  "\x3b\x16\x57\x83\xe7\x8f\x22\xa0"
+			  "\xf0\x42\xab\x7f\x42\x22\xb9\x4a"
+			  "\xf2\x32\x68\xe8\xc5\x12\x29\xc9"
+			  "\x60\xb3\xa8\x4c\x85\x20\xa4\xa0"
+			  "\x64\x87\x5e\x8a\x8e\x3a\xc7\x65"
+			  "\xcd\x9f\x45\x8b\x3b\x5b\xd3\x59"
+			  "\x0e\x48\xcb\xa2\x24\x7c\x41\x17"
+			  "\xf9\x20\x27\x22\x34\x33\x48\x22"
+			  "\x8e\x5b\x04\x6f\x70\x39\xf2\x36"
+			  "\x23\x95\x73\xd7\xcf\x9d\xa9\x08"
+			  "\x9b\x76\x7c\x18\xa9\xcc\x3a\x6d"
+			  "\xfe\x69\xef\x9f\x07\xec\x64\x1a"
+			  "\x58\x46\xdc\x03\x8e\xe4\x2e\xd0"
+			  "\xf1\xba\x5a\x7f\x95\xcb\x8f\x41"
+			  "\x83\x01\x4f\xf4\xce\x06\x07\xa6"
+			  "\x2a\xaa\xe3\x9e\xe1\x41\x41\x44"
+			  "\x6a\x48\xfd\x1b\x81\xe7\x5d\x72"
+			  "\x49\x54\x27\xfb\xe9\x5b\x93\x73"
+			  "\x18\xd8\x9d\x6d\x86\xf1\x06\xbd"
+			  "\x3b\x8c\x98\x6a\x88\x18\xfc\x22"
+			  "\x58\x7c\x81\x45\xa1\x15\x9e\x47"
+			  "\x79\x56\x79\x1b\x8b\x2c\xe8\x69"
+			  "\x05\x1e\x58\xb3\xb5\x02\xfe\x21"
+			  "\xc9\xff\x2e\x61\x02\x59\x78\x10"
+			  "\xe5\x77\x12\x1f\xfa\x77\x44\x4c"
+			  "\x61\x9e\x0c\xae\x92\xa4\x58\x05"
+			  "\x8f\xba\xbe\xd0\x3e\x52\x99\x55"
+			  "\x5a\x24\x57\x28\xca\x67\x69\xc2"
+			  "\x2e\x2b\x61\x41\x5e\x0a\x86\xfd"
+			  "\x2e\xcf\x0e\xd3\xf8\x3f\x84\x5a"
+			  "\x53\xe4\x46\xd2\x37\x2e\x49\x8c"
+			  "\xfa\x54\xe7\x44\x3d\xae\x80\x2a"
+			  "\xe7\xbc\x3d\x4d\xf4\xdb\x64\x62"
+			  "\x69\x22\x7c\x24\x01\xf5\x08\xfa"
+			  "\xbb\xfb\xb5\xee\xc9\x40\xa4\x24"
+			  "\x33\x21\x27\xfe\xbe\xf3\x91\x41"
+			  "\x07\x93\x88\x46\xa7\x65\x35\x98"
+			  "\xe9\xa4\x6f\xff\x7b\xb9\x44\x98"
+			  "\x23\x67\x62\x3e\x3b\xbf\x25\xb4"
+			  "\xef\xec\x68\xe2\x88\xc5\x57\x3a"
+			  "\xc6\xf3\x2f\x3c\x56\xe2\xd1\x58"
+			  "\x66\xa7\x2c\x57\xf0\xec\x2a\xcf"
+			  "\x02\x2e\x0b\x02\x2b\x34\x48\xe3"
+			  "\x5c\x51\xaa\x8f\x16\x95\xad\x3a",
+		.len	= 1024,
+	}, { /* 3 units of 512 bytes, the sector number crosses 2^32 */
+		.key	= "\xff\xfc\xf9\xf6\xf3\xf0\xed\xea"
+			  "\xe7\xe4\xe1\xde\xdb\xd8\xd5\xd2"
+			  "\xcf\xcc\xc9\xc6\xc3\xc0\xbd\xba"
+			  "\xb7\xb4\xb1\xae\xab\xa8\xa5\xa2"
+			  "\x9f\x9c\x99\x96\x93\x90\x8d\x8a"
+			  "\x87\x84\x81\x7e\x7b\x78\x75\x72"
+			  "\x6f\x6c\x69\x66\x63\x60\x5d\x5a"
+			  "\x57\x54\x51\x4e\x4b\x48\x45\x42",
+		.klen	= 64,
+		.iv	= "\xfe\xff\xff\xff\x00\x00\x00\x00"
+			  "\x09\x00\x00\x00\x00\x00\x00\x00",
+		.ptext	= "\x00\x01\x04\x09\x10\x19\x24\x32"
+			  "\x41\x52\x65\x7a\x91\xaa\xc6\xe3"
+			  "\x02\x23\x46\x6b\x92\xbc\xe7\x14"
+			  "\x43\x74\xa7\xdc\x14\x4d\x88\xc5"
+			  "\x04\x45\x88\xce\x15\x5e\xa9\xf6"
+			  "\x45\x96\xea\x3f\x96\xef\x4a\xa7"
+			  "\x06\x68\xcb\x30\x97\x00\x6b\xd8"
+			  "\x48\xb9\x2c\xa1\x18\x91\x0c\x8a"
+			  "\x09\x8a\x0d\x92\x19\xa2\x2e\xbb"
+			  "\x4a\xdb\x6e\x03\x9a\x34\xcf\x6c"
+			  "\x0b\xac\x4f\xf4\x9c\x45\xf0\x9d"
+			  "\x4c\xfd\xb0\x66\x1d\xd6\x91\x4e"
+			  "\x0d\xce\x92\x57\x1e\xe7\xb2\x7f"
+			  "\x4e\x20\xf3\xc8\x9f\x78\x53\x30"
+			  "\x10\xf1\xd4\xb9\xa0\x89\x74\x62"
+			  "\x51\x42\x35\x2a\x21\x1a\x16\x13"
+			  "\x12\x13\x16\x1b\x22\x2c\x37\x44"
+			  "\x53\x64\x77\x8c\xa4\xbd\xd8\xf5"
+			  "\x14\x35\x58\x7e\xa5\xce\xf9\x26"
+			  "\x55\x86\xba\xef\x26\x5f\x9a\xd7"
+			  "\x16\x58\x9b\xe0\x27\x70\xbb\x08"
+			  "\x58\xa9\xfc\x51\xa8\x01\x5c\xba"
+			  "\x19\x7a\xdd\x42\xa9\x12\x7e\xeb"
+			  "\x5a\xcb\x3e\xb3\x2a\xa4\x1f\x9c"
+			  "\x1b\x9c\x1f\xa4\x2c\xb5\x40\xcd"
+			  "\x5c\xed\x80\x16\xad\x46\xe1\x7e"
+			  "\x1d\xbe\x62\x07\xae\x57\x02\xaf"
+			  "\x5e\x10\xc3\x78\x2f\xe8\xa3\x60"
+			  "\x20\xe1\xa4\x69\x30\xf9\xc4\x92"
+			  "\x61\x32\x05\xda\xb1\x8a\x66\x43"
+			  "\x22\x03\xe6\xcb\xb2\x9c\x87\x74"
+			  "\x63\x54\x47\x3c\x34\x2d\x28\x25"
+			  "\x24\x25\x28\x2e\x35\x3e\x49\x56"
+			  "\x65\x76\x8a\x9f\xb6\xcf\xea\x07"
+			  "\x26\x48\x6b\x90\xb7\xe0\x0b\x38"
+			  "\x68\x99\xcc\x01\x38\x71\xac\xea"
+			  "\x29\x6a\xad\xf2\x39\x82\xce\x1b"
+			  "\x6a\xbb\x0e\x63\xba\x14\x6f\xcc"
+			  "\x2b\x8c\xef\x54\xbc\x25\x90\xfd"
+			  "\x6c\xdd\x50\xc6\x3d\xb6\x31\xae"
+			  "\x2d\xae\x32\xb7\x3e\xc7\x52\xdf"
+			  "\x6e\x00\x93\x28\xbf\x58\xf3\x90"
+			  "\x30\xd1\x74\x19\xc0\x69\x14\xc2"
+			  "\x71\x22\xd5\x8a\x41\xfa\xb6\x73"
+			  "\x32\xf3\xb6\x7b\x42\x0c\xd7\xa4"
+			  "\x73\x44\x17\xec\xc4\x9d\x78\x55"
+			  "\x34\x15\xf8\xde\xc5\xae\x99\x86"
+			  "\x75\x66\x5a\x4f\x46\x3f\x3a\x37"
+			  "\x36\x38\x3b\x40\x47\x50\x5b\x68"
+			  "\x78\x89\x9c\xb1\xc8\xe1\xfc\x1a"
+			  "\x39\x5a\x7d\xa2\xc9\xf2\x1e\x4b"
+			  "\x7a\xab\xde\x13\x4a\x84\xbf\xfc"
+			  "\x3b\x7c\xbf\x04\x4c\x95\xe0\x2d"
+			  "\x7c\xcd\x20\x76\xcd\x26\x81\xde"
+			  "\x3d\x9e\x02\x67\xce\x37\xa2\x0f"
+			  "\x7e\xf0\x63\xd8\x4f\xc8\x43\xc0"
+			  "\x40\xc1\x44\xc9\x50\xd9\x64\xf2"
+			  "\x81\x12\xa5\x3a\xd1\x6a\x06\xa3"
+			  "\x42\xe3\x86\x2b\xd2\x7c\x27\xd4"
+			  "\x83\x34\xe7\x9c\x54\x0d\xc8\x85"
+			  "\x44\x05\xc8\x8e\x55\x1e\xe9\xb6"
+			  "\x85\x56\x2a\xff\xd6\xaf\x8a\x67"
+			  "\x46\x28\x0b\xf0\xd7\xc0\xab\x98"
+			  "\x88\x79\x6c\x61\x58\x51\x4c\x4a"
+			  "\x49\x4a\x4d\x52\x59\x62\x6e\x7b"
+			  "\x8a\x9b\xae\xc3\xda\xf4\x0f\x2c"
+			  "\x4b\x6c\x8f\xb4\xdc\x05\x30\x5d"
+			  "\x8c\xbd\xf0\x26\x5d\x96\xd1\x0e"
+			  "\x4d\x8e\xd2\x17\x5e\xa7\xf2\x3f"
+			  "\x8e\xe0\x33\x88\xdf\x38\x93\xf0"
+			  "\x50\xb1\x14\x79\xe0\x49\xb4\x22"
+			  "\x91\x02\x75\xea\x61\xda\x56\xd3"
+			  "\x52\xd3\x56\xdb\x62\xec\x77\x04"
+			  "\x93\x24\xb7\x4c\xe4\x7d\x18\xb5"
+			  "\x54\xf5\x98\x3e\xe5\x8e\x39\xe6"
+			  "\x95\x46\xfa\xaf\x66\x1f\xda\x97"
+			  "\x56\x18\xdb\xa0\x67\x30\xfb\xc8"
+			  "\x98\x69\x3c\x11\xe8\xc1\x9c\x7a"
+			  "\x59\x3a\x1d\x02\xe9\xd2\xbe\xab"
+			  "\x9a\x8b\x7e\x73\x6a\x64\x5f\x5c"
+			  "\x5b\x5c\x5f\x64\x6c\x75\x80\x8d"
+			  "\x9c\xad\xc0\xd6\xed\x06\x21\x3e"
+			  "\x5d\x7e\xa2\xc7\xee\x17\x42\x6f"
+			  "\x9e\xd0\x03\x38\x6f\xa8\xe3\x20"
+			  "\x60\xa1\xe4\x29\x70\xb9\x04\x52"
+			  "\xa1\xf2\x45\x9a\xf1\x4a\xa6\x03"
+			  "\x62\xc3\x26\x8b\xf2\x5c\xc7\x34"
+			  "\xa3\x14\x87\xfc\x74\xed\x68\xe5"
+			  "\x64\xe5\x68\xee\x75\xfe\x89\x16"
+			  "\xa5\x36\xca\x5f\xf6\x8f\x2a\xc7"
+			  "\x66\x08\xab\x50\xf7\xa0\x4b\xf8"
+			  "\xa8\x59\x0c\xc1\x78\x31\xec\xaa"
+			  "\x69\x2a\xed\xb2\x79\x42\x0e\xdb"
+			  "\xaa\x7b\x4e\x23\xfa\xd4\xaf\x8c"
+			  "\x6b\x4c\x2f\x14\xfc\xe5\xd0\xbd"
+			  "\xac\x9d\x90\x86\x7d\x76\x71\x6e"
+			  "\x6d\x6e\x72\x77\x7e\x87\x92\x9f"
+			  "\xae\xc0\xd3\xe8\xff\x18\x33\x50"
+			  "\x70\x91\xb4\xd9\x00\x29\x54\x82"
+			  "\xb1\xe2\x15\x4a\x81\xba\xf6\x33"
+			  "\x72\xb3\xf6\x3b\x82\xcc\x17\x64"
+			  "\xb3\x04\x57\xac\x04\x5d\xb8\x15"
+			  "\x74\xd5\x38\x9e\x05\x6e\xd9\x46"
+			  "\xb5\x26\x9a\x0f\x86\xff\x7a\xf7"
+			  "\x76\xf8\x7b\x00\x87\x10\x9b\x28"
+			  "\xb8\x49\xdc\x71\x08\xa1\x3c\xda"
+			  "\x79\x1a\xbd\x62\x09\xb2\x5e\x0b"
+			  "\xba\x6b\x1e\xd3\x8a\x44\xff\xbc"
+			  "\x7b\x3c\xff\xc4\x8c\x55\x20\xed"
+			  "\xbc\x8d\x60\x36\x0d\xe6\xc1\x9e"
+			  "\x7d\x5e\x42\x27\x0e\xf7\xe2\xcf"
+			  "\xbe\xb0\xa3\x98\x8f\x88\x83\x80"
+			  "\x80\x81\x84\x89\x90\x99\xa4\xb2"
+			  "\xc1\xd2\xe5\xfa\x11\x2a\x46\x63"
+			  "\x82\xa3\xc6\xeb\x12\x3c\x67\x94"
+			  "\xc3\xf4\x27\x5c\x94\xcd\x08\x45"
+			  "\x84\xc5\x08\x4e\x95\xde\x29\x76"
+			  "\xc5\x16\x6a\xbf\x16\x6f\xca\x27"
+			  "\x86\xe8\x4b\xb0\x17\x80\xeb\x58"
+			  "\xc8\x39\xac\x21\x98\x11\x8c\x0a"
+			  "\x89\x0a\x8d\x12\x99\x22\xae\x3b"
+			  "\xca\x5b\xee\x83\x1a\xb4\x4f\xec"
+			  "\x8b\x2c\xcf\x74\x1c\xc5\x70\x1d"
+			  "\xcc\x7d\x30\xe6\x9d\x56\x11\xce"
+			  "\x8d\x4e\x12\xd7\x9e\x67\x32\xff"
+			  "\xce\xa0\x73\x48\x1f\xf8\xd3\xb0"
+			  "\x90\x71\x54\x39\x20\x09\xf4\xe2"
+			  "\xd1\xc2\xb5\xaa\xa1\x9a\x96\x93"
+			  "\x92\x93\x96\x9b\xa2\xac\xb7\xc4"
+			  "\xd3\xe4\xf7\x0c\x24\x3d\x58\x75"
+			  "\x94\xb5\xd8\xfe\x25\x4e\x79\xa6"
+			  "\xd5\x06\x3a\x6f\xa6\xdf\x1a\x57"
+			  "\x96\xd8\x1b\x60\xa7\xf0\x3b\x88"
+			  "\xd8\x29\x7c\xd1\x28\x81\xdc\x3a"
+			  "\x99\xfa\x5d\xc2\x29\x92\xfe\x6b"
+			  "\xda\x4b\xbe\x33\xaa\x24\x9f\x1c"
+			  "\x9b\x1c\x9f\x24\xac\x35\xc0\x4d"
+			  "\xdc\x6d\x00\x96\x2d\xc6\x61\xfe"
+			  "\x9d\x3e\xe2\x87\x2e\xd7\x82\x2f"
+			  "\xde\x90\x43\xf8\xaf\x68\x23\xe0"
+			  "\xa0\x61\x24\xe9\xb0\x79\x44\x12"
+			  "\xe1\xb2\x85\x5a\x31\x0a\xe6\xc3"
+			  "\xa2\x83\x66\x4b\x32\x1c\x07\xf4"
+			  "\xe3\xd4\xc7\xbc\xb4\xad\xa8\xa5"
+			  "\xa4\xa5\xa8\xae\xb5\xbe\xc9\xd6"
+			  "\xe5\xf6\x0a\x1f\x36\x4f\x6a\x87"
+			  "\xa6\xc8\xeb\x10\x37\x60\x8b\xb8"
+			  "\xe8\x19\x4c\x81\xb8\xf1\x2c\x6a"
+			  "\xa9\xea\x2d\x72\xb9\x02\x4e\x9b"
+			  "\xea\x3b\x8e\xe3\x3a\x94\xef\x4c"
+			  "\xab\x0c\x6f\xd4\x3c\xa5\x10\x7d"
+			  "\xec\x5d\xd0\x46\xbd\x36\xb1\x2e"
+			  "\xad\x2e\xb2\x37\xbe\x47\xd2\x5f"
+			  "\xee\x80\x13\xa8\x3f\xd8\x73\x10"
+			  "\xb0\x51\xf4\x99\x40\xe9\x94\x42"
+			  "\xf1\xa2\x55\x0a\xc1\x7a\x36\xf3"
+			  "\xb2\x73\x36\xfb\xc2\x8c\x57\x24"
+			  "\xf3\xc4\x97\x6c\x44\x1d\xf8\xd5"
+			  "\xb4\x95\x78\x5e\x45\x2e\x19\x06"
+			  "\xf5\xe6\xda\xcf\xc6\xbf\xba\xb7"
+			  "\xb6\xb8\xbb\xc0\xc7\xd0\xdb\xe8"
+			  "\xf8\x09\x1c\x31\x48\x61\x7c\x9a"
+			  "\xb9\xda\xfd\x22\x49\x72\x9e\xcb"
+			  "\xfa\x2b\x5e\x93\xca\x04\x3f\x7c"
+			  "\xbb\xfc\x3f\x84\xcc\x15\x60\xad"
+			  "\xfc\x4d\xa0\xf6\x4d\xa6\x01\x5e"
+			  "\xbd\x1e\x82\xe7\x4e\xb7\x22\x8f"
+			  "\xfe\x70\xe3\x58\xcf\x48\xc3\x40"
+			  "\xc0\x41\xc4\x49\xd0\x59\xe4\x72"
+			  "\x01\x92\x25\xba\x51\xea\x86\x23"
+			  "\xc2\x63\x06\xab\x52\xfc\xa7\x54"
+			  "\x03\xb4\x67\x1c\xd4\x8d\x48\x05"
+			  "\xc4\x85\x48\x0e\xd5\x9e\x69\x36"
+			  "\x05\xd6\xaa\x7f\x56\x2f\x0a\xe7"
+			  "\xc6\xa8\x8b\x70\x57\x40\x2b\x18"
+			  "\x08\xf9\xec\xe1\xd8\xd1\xcc\xca"
+			  "\xc9\xca\xcd\xd2\xd9\xe2\xee\xfb"
+			  "\x0a\x1b\x2e\x43\x5a\x74\x8f\xac"
+			  "\xcb\xec\x0f\x34\x5c\x85\xb0\xdd"
+			  "\x0c\x3d\x70\xa6\xdd\x16\x51\x8e"
+			  "\xcd\x0e\x52\x97\xde\x27\x72\xbf"
+			  "\x0e\x60\xb3\x08\x5f\xb8\x13\x70"
+			  "\xd0\x31\x94\xf9\x60\xc9\x34\xa2"
+			  "\x11\x82\xf5\x6a\xe1\x5a\xd6\x53"
+			  "\xd2\x53\xd6\x5b\xe2\x6c\xf7\x84"
+			  "\x13\xa4\x37\xcc\x64\xfd\x98\x35"
+			  "\xd4\x75\x18\xbe\x65\x0e\xb9\x66"
+			  "\x15\xc6\x7a\x2f\xe6\x9f\x5a\x17"
+			  "\xd6\x98\x5b\x20\xe7\xb0\x7b\x48"
+			  "\x18\xe9\xbc\x91\x68\x41\x1c\xfa"
+			  "\xd9\xba\x9d\x82\x69\x52\x3e\x2b"
+			  "\x1a\x0b\xfe\xf3\xea\xe4\xdf\xdc",
+		.ctext	= "\xae\x24\xd9\xff\x2c\x38\x79\x4c"
+			  "\xf6\x20\x75\x0f\xa4\x39\xb9\x15"
+			  "\x6f\xd4\x4b\x06\x89\x88\x79\xf1"
+			  "\x6e\xe5\x1b\xbc\x89\x2c\x83\xf5"
+			  "\x77\xa6\x56\x54\x8f\xce\x80\x5b"
+			  "\x1a\x8f\xb9\x76\x83\xe8\xf8\x4f"
+			  "\x77\x90\x67\xa0\x27\x36\x44\x06"
+			  "\x83\x65\xe4\x9c\xcd\x9f\x08\xea"
+			  "\x57\x90\x1d\xd1\xe5\x30\xf6\x36"
+			  "\x2d\x90\xc2\x27\xda\x1c\x00\x5f"
+			  "\xce\x8e\x0b\xcd\xc3\x9a\xd1\x90"
+			  "\xc6\x6b\x3c\x24\x95\x33\x77\xbf"
+			  "\x0a\x08\xf9\x92\x10\xf5\xee\x36"
+			  "\xaa\xc0\x9f\x4a\x3c\xbd\xea\x98"
+			  "\x52\x4f\x18\xe7\x25\xc3\x7e\x9d"
+			  "\x8d\x52\xd0\x0c\x06\x05\x2a\x7d"
+			  "\x9f\x6a\xba\x3e\xaf\x3c\xfd\xf1"
+			  "\x71\xca\xd2\xd5\x5e\x7f\x42\x6b"
+			  "\x1a\xe6\x3c\x08\x6f\x29\xef\xa0"
+			  "\x97\xdd\x52\x86\xd6\x94\xdf\x2c"
+			  "\xc7\xa0\xea\xcd\x17\x81\xfc\x67"
+			  "\x6f\x94\x86\xcb\x5e\x51\x7f\xf7"
+			  "\x19\x19\xf4\x4b\x5f\xe2\x6e\x9a"
+			  "\x2e\x2b\xea\x0e\x93\x9e\x88\x88"
+			  "\x46\x77\x47\x2a\x30\x05\xf6\xcc"
+			  "\xd7\x0f\x01\x28\xe2\x39\xde\xbc"
+			  "\xaa\x27\x26\xc0\xfa\x4b\x8d\x61"
+			  "\x2a\xb6\x3c\x49\xb8\xcd\xd1\x1b"
+			  "\x85\x30\x5c\x1d\xf1\x11\x1e\x5e"
+			  "\x70\x41\x0e\x79\x8f\xc0\xbd\x91"
+			  "\xd2\xdf\x83\xa7\x21\x2b\x37\x39"
+			  "\x96\x1c\x75\xf8\xda\xde\xa9\x6d"
+			  "\x6e\x52\x77\x29\x47\x89\xe5\xb6"
+			  "\x45\x25\x3a\x33\xe8\x89\xec\x48"
+			  "\x5f\x6b\xb5\x8c\xd4\x13\x50\x9f"
+			  "\x94\x3c\x2f\xda\x4d\x56\x5f\x94"
+			  "\x03\xb6\x76\x2d\xe8\x55\x91\x94"
+			  "\x66\x26\x10\x12\x3e\xc9\xc0\x5c"
+			  "\x12\xf9\x2d\x5c\x39\x00\x2a\x32"
+			  "\x49\x79\xe6\x62\x39\x3c\x45\xf5"
+			  "\x92\xe9\x9a\x2a\xdd\x47\x11\x5f"
+			  "\xc9\x11\x15\xbd\x3b\xb2\x34\xba"
+			  "\x01\x4a\x7a\xff\xdf\xa7\xa3\xe8"
+			  "\x15\x6f\x45\x5e\x01\x56\xbe\x33"
+			  "\x46\x26\xbc\x41\x71\x9a\xce\xd4"
+			  "\x31\x50\xca\x2f\x7c\xfd\xfa\x53"
+			  "\xee\x9a\x99\xa1\x5f\x0d\xf1\x82"
+			  "\x65\xa2\x83\x66\x8a\xea\xed\xa4"
+			  "\x31\x79\x4f\xb8\x0e\xa6\xe4\x28"
+			  "\x30\xe7\x0e\xea\x07\x02\xfa\x93"
+			  "\x42\x67\x43\xff\x9d\xb0\x8f\x09"
+			  "\x6f\x07\xf9\x8f\x83\x65\xc5\x20"
+			  "\xe6\x91\x01\x49\x6b\xf9\xaa\x05"
+			  "\x09\x42\x92\x6d\x50\x53\x50\x5d"
+			  "\x4b\x0f\x50\x35\x4f\xdb\x75\xa8"
+			  "\xe2\xb9\x80\xdc\xea\x60\x52\x9d"
+			  "\xfa\xc3\x63\x32\x11\x08\xc1\x01"
+			  "\x4b\xa4\x6f\x70\x50\x4a\x17\x50"
+			  "\x09\xfb\xae\x51\x7a\x2d\xfc\xb6"
+			  "\xc8\x3e\x2a\x57\x11\x25\xb4\x5a"
+			  "\xad\x51\xf7\x5b\x99\x57\x42\xdf"
+			  "\x67\x94\x44\xfe\xb3\x68\x6a\x12"
+			  "\x9d\x8d\xd8\x8a\xfd\x50\x93\xf5"
+			  "\xd6\x70\xa8\x7f\xde\xac\xb9\xe6"
+			  "\x44\x63\x9b\xf0\x30\x05\x7b\xef"
+			  "\x38\xe4\xdb\x93\x49\xab\xe5\x0a"
+			  "\xf6\x4b\x0c\xcd\xc0\x41\x8f\xd9"
+			  "\x0c\xe4\xe7\xa1\xd1\xbe\xbb\xb2"
+			  "\x97\x7e\x72\x34\x49\x16\x7a\xc9"
+			  "\x07\xeb\x0b\x2c\xaf\x70\x4a\x82"
+			  "\x26\x9f\xda\xb5\xde\x22\x12\x20"
+			  "\xac\xc0\x3e\xcb\x43\xc1\x37\xfb"
+			  "\xff\xc7\xe4\xe2\x5b\xcb\x98\xf8"
+			  "\x5d\x22\xb1\x67\x34\xc0\x79\xd9"
+			  "\xe5\x91\x87\xc7\x1c\xa3\xe2\xbd"
+			  "\x0a\xff\x63\x9f\x82\xf6\xd6\x26"
+			  "\x2a\x38\xc8\x1f\x57\xc6\xbc\x9e"
+			  "\xfa\xd1\x4e\xa4\x50\xd9\xd7\xd2"
+			  "\x6e\xb5\xd5\x02\x00\x38\x35\x7a"
+			  "\xd2\xe7\xce\x8b\x50\xea\x48\xeb"
+			  "\x48\xb5\x5e\x2b\x36\x5a\xb1\xc8"
+			  "\x72\x41\xa5\x2e\xce\x81\xe3\xc0"
+			  "\xbf\xbb\xea\xac\xae\x3e\x08\xbe"
+			  "\x40\x9f\xe8\x07\x90\xdd\x82\xc6"
+			  "\x82\x6f\x2c\x1c\xf2\xea\x21\x4c"
+			  "\x80\xa6\xc4\x91\xc4\x31\xb4\xaa"
+			  "\x7c\x90\xd7\x79\x91\x3c\x35\xf8"
+			  "\x35\x3b\x11\x31\xe4\x0a\x15\x42"
+			  "\x82\x74\xda\xb4\x2c\xa1\x2c\x06"
+			  "\xa9\xff\xab\xcc\xbc\xab\x78\xf8"
+			  "\x89\xbd\x24\x9d\x02\x2a\xb5\xeb"
+			  "\x85\x0c\x7f\xd3\xbb\x4b\x78\x3b"
+			  "\xcd\x7c\x3e\x45\x86\xc5\x6a\x5b"
+			  "\x4b\xc8\xc8\x86\x59\x11\x7c\xf2"
+			  "\xed\xb6\x7c\xea\xbc\x0c\xf6\x1a"
+			  "\xf7\xfa\xff\x5b\x4a\x14\x48\xfe"
+			  "\x66\x14\x9e\xeb\x8a\xba\x9f\x21"
+			  "\x14\x7a\xb7\x1b\xb1\x8a\xf5\x1f"
+			  "\x57\x83\xb0\x12\x6e\x71\x76\x95"
+			  "\x16\xff\x45\x5c\x24\xbc\x9d\xb2"
+			  "\x9d\x03\xe1\xfb\xd1\xf7\x79\x2f"
+			  "\x56\x04\x8d\xaa\x25\x7e\x74\x57"
+			  "\x14\x55\xa9\x80\x8a\x39\xef\xb0"
+			  "\x6f\x8e\x6c\xfb\x52\x9a\x74\x2d"
+			  "\x19\x44\x08\x3c\x8a\xac\x4e\x67"
+			  "\x9a\x34\xaf\x43\xc7\x87\x33\xa9"
+			  "\xcd\xb5\x3b\x90\x85\xff\x56\x17"
+			  "\xf7\xcc\x2c\xac\x34\x74\x29\xa2"
+			  "\xbb\x37\xfc\xd7\x7e\x34\x1a\x5a"
+			  "\x3e\x46\x23\x45\xae\x98\x33\x12"
+			  "\xf4\x10\x3f\xf6\xb1\xb5\x97\x3d"
+			  "\xf0\x8d\x5c\xb0\xc5\x2f\xcf\x07"
+			  "\xc8\x44\x23\x76\x9e\x46\xf2\xdf"
+			  "\x21\xd0\x33\xed\xe6\x2a\x28\xec"
+			  "\x0a\x8d\xd2\x00\xc3\xbc\x82\xf6"
+			  "\xe5\x56\xe4\x71\x05\x3a\xcd\x2d"
+			  "\x7c\x4c\x4f\xaf\x86\x6e\x2c\xcd"
+			  "\x41\x28\xb7\x6f\xba\xae\x62\x42"
+			  "\x22\x5b\x18\x67\x29\x42\xa0\xfd"
+			  "\x14\x55\xac\xcb\x65\x13\xbf\xd8"
+			  "\x15\x9c\xb7\x8f\x19\x3a\x54\x9d"
+			  "\xee\x85\x52\x39\xc6\x87\x51\x8b"
+			  "\xed\x31\xe6\x7e\xf8\x90\x04\xf0"
+			  "\xde\x95\xc9\x27\x2c\x7b\xc5\x65"
+			  "\xca\x62\x26\xce\xed\x2a\x09\x5a"
+			  "\xf7\x6d\xba\x53\x88\x57\x24\x53"
+			  "\x5d\x4f\xbe\x7a\x75\xdf\x69\xf8"
+			  "\xfb\x37\x6f\xb6\x1a\xd7\xb4\xc4"
+			  "\x52\x1f\x7c\xfd\x80\x78\x2f\xb5"
+			  "\x42\xce\x2b\x1e\x76\xbc\x7d\x40"
+			  "\x39\x5a\x1c\x77\xf6\x4f\x7b\xb9"
+			  "\x23\x7b\x9c\x0d\x11\x74\x16\xf9"
+			  "\xd3\x96\xb6\x87\x36\x67\xc9\x8c"
+			  "\xb5\x16\x49\xa7\xad\x21\xb6\x5b"
+			  "\x83\x79\xff\x1c\x82\xb4\xea\x78"
+			  "\x9e\x6f\x82\x00\x83\x5c\xaf\xbe"
+			  "\xda\xca\xff\x03\x72\x45\xab\x6b"
+			  "\x85\x40\x8e\x43\xfd\xec\xb1\x4a"
+			  "\x0a\xf0\x2f\x85\x76\x2a\xb6\x52"
+			  "\x95\x0d\xf6\x6b\x82\x03\xff\x58"
+			  "\xb9\x6d\x37\xa9\xdf\xd2\xc9\x45"
+			  "\xbb\x38\xa8\x44\x8f\xf7\xb0\x12"
+			  "\x47\x07\xb8\x75\x34\xef\x07\xdf"
+			  "\xa7\xf7\x23\x7b\x72\x40\x7f\xee"
+			  "\x23\x97\x95\x0f\xa9\x2c\x81\xd8"
+			  "\x02\x54\x53\xd7\x7a\x4b\x0f\x70"
+			  "\xe5\x94\xf9\x3a\xa5\x25\x76\x20"
+			  "\x31\x15\xb0\x89\x52\xf8\xeb\x3f"
+			  "\xdc\x82\xd9\x8d\xf4\xd2\xd9\x92"
+			  "\xa1\x9c\xf2\xac\x2f\xdd\x21\x4e"
+			  "\x27\x18\x5f\x20\xef\xc8\x79\xad"
+			  "\x8e\x6c\x06\x0e\xe1\xa8\x89\xff"
+			  "\x44\xdf\xe0\x8e\x09\x7b\x0a\x0b"
+			  "\x61\xf2\x71\xbb\xb3\xa0\xb7\x5b"
+			  "\x1c\xad\xdc\x16\x25\xe1\x7d\xbf"
+			  "\x74\x6f\x25\xec\x1d\x25\x33\xc4"
+			  "\x0f\xef\xd6\xf7\xc1\x44\xae\x13"
+			  "\x3a\x5e\x8a\xe5\x18\x37\x9e\x8d"
+			  "\x59\xb4\xee\xdb\xe6\xa9\x3a\xac"
+			  "\xc8\xe5\xa2\xb5\x2b\x4a\x09\x0f"
+			  "\xe3\xe9\x4a\x31\xb5\x85\xce\xc2"
+			  "\x5b\x8d\xfc\x17\x87\x20\x15\x4e"
+			  "\x6c\x82\xa7\x0e\x68\x59\x9b\xbe"
+			  "\x52\xda\xe8\x87\x50\xdc\x55\x0f"
+			  "\xa9\x65\x98\x5d\x76\x99\x9f\x3d"
+			  "\xec\xf5\x96\xb3\xd3\xad\x99\x41"
+			  "\xf4\xf6\x0f\x62\xec\x72\x93\x9f"
+			  "\x6e\x03\x11\xe1\xdd\xd0\x2c\x06"
+			  "\xd6\x35\x7f\x7f\x4e\x14\x8f\x6a"
+			  "\x79\x0a\xa1\xa0\x29\xa1\xb5\xc6"
+			  "\x3b\x86\xc3\xbd\xa5\x03\x8c\x40"
+			  "\x70\xe4\x18\x33\x3e\x45\xf2\x49"
+			  "\x75\xbe\x3e\x6e\xce\x15\x9e\xe0"
+			  "\x83\x54\x0e\xc8\x4a\xf3\xe9\xde"
+			  "\x7e\x1c\x5a\xf7\x70\xec\x71\xc0"
+			  "\x76\xa7\xb5\x5f\xfe\x56\x3f\xb5"
+			  "\x58\xfc\x68\xd8\xce\xff\xa4\x67"
+			  "\xf2\x62\x3f\x4c\x7b\xc4\xd1\x60"
+			  "\x22\x90\xc5\x40\x91\x69\xa7\x5a"
+			  "\x3e\xc3\x66\xec\x3d\x31\x8f\x10"
+			  "\xa4\x80\xaa\xb2\xfa\xff\xc1\xe2"
+			  "\x86\x5d\xe7\x88\x4e\x18\x66\x9a"
+			  "\x69\xab\x37\xa5\x49\xce\x90\xb4"
+			  "\x16\xed\x15\x9d\x89\x40\xa3\x34"
+			  "\x43\x03\x43\xa6\xff\x83\x7c\x4d"
+			  "\x51\x6c\xd7\x4b\x90\x98\xf2\x0b"
+			  "\x18\x78\x3e\x1e\x42\x85\x00\xd1"
+			  "\xe7\x66\x46\xcc\x48\x12\x1b\xcc"
+			  "\xf1\x4c\x29\x96\x25\x0e\x7c\xfa"
+			  "\x14\x9b\x83\xcb\xb4\x83\x65\x7d"
+			  "\x9f\xa5\xce\xa0\x8e\xd8\x99\xfe"
+			  "\x95\xb7\x01\x4f\x10\x60\x7c\x36",
+		.len	= 1536,
+	}, { /* 2 units of 1024 bytes */
+		.key	= "\x0b\x28\x45\x62\x7f\x9c\xb9\xd6"
+			  "\xf3\x10\x2d\x4a\x67\x84\xa1\xbe"
+			  "\xdb\xf8\x15\x32\x4f\x6c\x89\xa6"
+			  "\xc3\xe0\xfd\x1a\x37\x54\x71\x8e",
+		.klen	= 32,
+		.iv	= "\x08\x07\x06\x05\x04\x03\x02\x01"
+			  "\x0a\x00\x00\x00\x00\x00\x00\x00",
+		.ptext	= "\x00\x05\x0a\x0f\x14\x19\x1e\x23"
+			  "\x28\x2d\x32\x37\x3c\x41\x46\x4b"
+			  "\x50\x55\x5a\x5f\x64\x69\x6e\x73"
+			  "\x78\x7d\x82\x87\x8c\x91\x96\x9b"
+			  "\xa0\xa5\xaa\xaf\xb4\xb9\xbe\xc3"
+			  "\xc8\xcd\xd2\xd7\xdc\xe1\xe6\xeb"
+			  "\xf0\xf5\xfa\xff\x04\x09\x0e\x13"
+			  "\x18\x1d\x22\x27\x2c\x31\x36\x3b"
+			  "\x40\x45\x4a\x4f\x54\x59\x5e\x63"
+			  "\x68\x6d\x72\x77\x7c\x81\x86\x8b"
+			  "\x90\x95\x9a\x9f\xa4\xa9\xae\xb3"
+			  "\xb8\xbd\xc2\xc7\xcc\xd1\xd6\xdb"
+			  "\xe0\xe5\xea\xef\xf4\xf9\xfe\x03"
+			  "\x08\x0d\x12\x17\x1c\x21\x26\x2b"
+			  "\x30\x35\x3a\x3f\x44\x49\x4e\x53"
+			  "\x58\x5d\x62\x67\x6c\x71\x76\x7b"
+			  "\x80\x85\x8a\x8f\x94\x99\x9e\xa3"
+			  "\xa8\xad\xb2\xb7\xbc\xc1\xc6\xcb"
+			  "\xd0\xd5\xda\xdf\xe4\xe9\xee\xf3"
+			  "\xf8\xfd\x02\x07\x0c\x11\x16\x1b"
+			  "\x20\x25\x2a\x2f\x34\x39\x3e\x43"
+			  "\x48\x4d\x52\x57\x5c\x61\x66\x6b"
+			  "\x70\x75\x7a\x7f\x84\x89\x8e\x93"
+			  "\x98\x9d\xa2\xa7\xac\xb1\xb6\xbb"
+			  "\xc0\xc5\xca\xcf\xd4\xd9\xde\xe3"
+			  "\xe8\xed\xf2\xf7\xfc\x01\x06\x0b"
+			  "\x10\x15\x1a\x1f\x24\x29\x2e\x33"
+			  "\x38\x3d\x42\x47\x4c\x51\x56\x5b"
+			  "\x60\x65\x6a\x6f\x74\x79\x7e\x83"
+			  "\x88\x8d\x92\x97\x9c\xa1\xa6\xab"
+			  "\xb0\xb5\xba\xbf\xc4\xc9\xce\xd3"
+			  "\xd8\xdd\xe2\xe7\xec\xf1\xf6\xfb"
+			  "\x01\x06\x0b\x10\x15\x1a\x1f\x24"
+			  "\x29\x2e\x33\x38\x3d\x42\x47\x4c"
+			  "\x51\x56\x5b\x60\x65\x6a\x6f\x74"
+			  "\x79\x7e\x83\x88\x8d\x92\x97\x9c"
+			  "\xa1\xa6\xab\xb0\xb5\xba\xbf\xc4"
+			  "\xc9\xce\xd3\xd8\xdd\xe2\xe7\xec"
+			  "\xf1\xf6\xfb\x00\x05\x0a\x0f\x14"
+			  "\x19\x1e\x23\x28\x2d\x32\x37\x3c"
+			  "\x41\x46\x4b\x50\x55\x5a\x5f\x64"
+			  "\x69\x6e\x73\x78\x7d\x82\x87\x8c"
+			  "\x91\x96\x9b\xa0\xa5\xaa\xaf\xb4"
+			  "\xb9\xbe\xc3\xc8\xcd\xd2\xd7\xdc"
+			  "\xe1\xe6\xeb\xf0\xf5\xfa\xff\x04"
+			  "\x09\x0e\x13\x18\x1d\x22\x27\x2c"
+			  "\x31\x36\x3b\x40\x45\x4a\x4f\x54"
+			  "\x59\x5e\x63\x68\x6d\x72\x77\x7c"
+			  "\x81\x86\x8b\x90\x95\x9a\x9f\xa4"
+			  "\xa9\xae\xb3\xb8\xbd\xc2\xc7\xcc"
+			  "\xd1\xd6\xdb\xe0\xe5\xea\xef\xf4"
+			  "\xf9\xfe\x03\x08\x0d\x12\x17\x1c"
+			  "\x21\x26\x2b\x30\x35\x3a\x3f\x44"
+			  "\x49\x4e\x53\x58\x5d\x62\x67\x6c"
+			  "\x71\x76\x7b\x80\x85\x8a\x8f\x94"
+			  "\x99\x9e\xa3\xa8\xad\xb2\xb7\xbc"
+			  "\xc1\xc6\xcb\xd0\xd5\xda\xdf\xe4"
+			  "\xe9\xee\xf3\xf8\xfd\x02\x07\x0c"
+			  "\x11\x16\x1b\x20\x25\x2a\x2f\x34"
+			  "\x39\x3e\x43\x48\x4d\x52\x57\x5c"
+			  "\x61\x66\x6b\x70\x75\x7a\x7f\x84"
+			  "\x89\x8e\x93\x98\x9d\xa2\xa7\xac"
+			  "\xb1\xb6\xbb\xc0\xc5\xca\xcf\xd4"
+			  "\xd9\xde\xe3\xe8\xed\xf2\xf7\xfc"
+			  "\x02\x07\x0c\x11\x16\x1b\x20\x25"
+			  "\x2a\x2f\x34\x39\x3e\x43\x48\x4d"
+			  "\x52\x57\x5c\x61\x66\x6b\x70\x75"
+			  "\x7a\x7f\x84\x89\x8e\x93\x98\x9d"
+			  "\xa2\xa7\xac\xb1\xb6\xbb\xc0\xc5"
+			  "\xca\xcf\xd4\xd9\xde\xe3\xe8\xed"
+			  "\xf2\xf7\xfc\x01\x06\x0b\x10\x15"
+			  "\x1a\x1f\x24\x29\x2e\x33\x38\x3d"
+			  "\x42\x47\x4c\x51\x56\x5b\x60\x65"
+			  "\x6a\x6f\x74\x79\x7e\x83\x88\x8d"
+			  "\x92\x97\x9c\xa1\xa6\xab\xb0\xb5"
+			  "\xba\xbf\xc4\xc9\xce\xd3\xd8\xdd"
+			  "\xe2\xe7\xec\xf1\xf6\xfb\x00\x05"
+			  "\x0a\x0f\x14\x19\x1e\x23\x28\x2d"
+			  "\x32\x37\x3c\x41\x46\x4b\x50\x55"
+			  "\x5a\x5f\x64\x69\x6e\x73\x78\x7d"
+			  "\x82\x87\x8c\x91\x96\x9b\xa0\xa5"
+			  "\xaa\xaf\xb4\xb9\xbe\xc3\xc8\xcd"
+			  "\xd2\xd7\xdc\xe1\xe6\xeb\xf0\xf5"
+			  "\xfa\xff\x04\x09\x0e\x13\x18\x1d"
+			  "\x22\x27\x2c\x31\x36\x3b\x40\x45"
+			  "\x4a\x4f\x54\x59\x5e\x63\x68\x6d"
+			  "\x72\x77\x7c\x81\x86\x8b\x90\x95"
+			  "\x9a\x9f\xa4\xa9\xae\xb3\xb8\xbd"
+			  "\xc2\xc7\xcc\xd1\xd6\xdb\xe0\xe5"
+			  "\xea\xef\xf4\xf9\xfe\x03\x08\x0d"
+			  "\x12\x17\x1c\x21\x26\x2b\x30\x35"
+			  "\x3a\x3f\x44\x49\x4e\x53\x58\x5d"
+			  "\x62\x67\x6c\x71\x76\x7b\x80\x85"
+			  "\x8a\x8f\x94\x99\x9e\xa3\xa8\xad"
+			  "\xb2\xb7\xbc\xc1\xc6\xcb\xd0\xd5"
+			  "\xda\xdf\xe4\xe9\xee\xf3\xf8\xfd"
+			  "\x03\x08\x0d\x12\x17\x1c\x21\x26"
+			  "\x2b\x30\x35\x3a\x3f\x44\x49\x4e"
+			  "\x53\x58\x5d\x62\x67\x6c\x71\x76"
+			  "\x7b\x80\x85\x8a\x8f\x94\x99\x9e"
+			  "\xa3\xa8\xad\xb2\xb7\xbc\xc1\xc6"
+			  "\xcb\xd0\xd5\xda\xdf\xe4\xe9\xee"
+			  "\xf3\xf8\xfd\x02\x07\x0c\x11\x16"
+			  "\x1b\x20\x25\x2a\x2f\x34\x39\x3e"
+			  "\x43\x48\x4d\x52\x57\x5c\x61\x66"
+			  "\x6b\x70\x75\x7a\x7f\x84\x89\x8e"
+			  "\x93\x98\x9d\xa2\xa7\xac\xb1\xb6"
+			  "\xbb\xc0\xc5\xca\xcf\xd4\xd9\xde"
+			  "\xe3\xe8\xed\xf2\xf7\xfc\x01\x06"
+			  "\x0b\x10\x15\x1a\x1f\x24\x29\x2e"
+			  "\x33\x38\x3d\x42\x47\x4c\x51\x56"
+			  "\x5b\x60\x65\x6a\x6f\x74\x79\x7e"
+			  "\x83\x88\x8d\x92\x97\x9c\xa1\xa6"
+			  "\xab\xb0\xb5\xba\xbf\xc4\xc9\xce"
+			  "\xd3\xd8\xdd\xe2\xe7\xec\xf1\xf6"
+			  "\xfb\x00\x05\x0a\x0f\x14\x19\x1e"
+			  "\x23\x28\x2d\x32\x37\x3c\x41\x46"
+			  "\x4b\x50\x55\x5a\x5f\x64\x69\x6e"
+			  "\x73\x78\x7d\x82\x87\x8c\x91\x96"
+			  "\x9b\xa0\xa5\xaa\xaf\xb4\xb9\xbe"
+			  "\xc3\xc8\xcd\xd2\xd7\xdc\xe1\xe6"
+			  "\xeb\xf0\xf5\xfa\xff\x04\x09\x0e"
+			  "\x13\x18\x1d\x22\x27\x2c\x31\x36"
+			  "\x3b\x40\x45\x4a\x4f\x54\x59\x5e"
+			  "\x63\x68\x6d\x72\x77\x7c\x81\x86"
+			  "\x8b\x90\x95\x9a\x9f\xa4\xa9\xae"
+			  "\xb3\xb8\xbd\xc2\xc7\xcc\xd1\xd6"
+			  "\xdb\xe0\xe5\xea\xef\xf4\xf9\xfe"
+			  "\x04\x09\x0e\x13\x18\x1d\x22\x27"
+			  "\x2c\x31\x36\x3b\x40\x45\x4a\x4f"
+			  "\x54\x59\x5e\x63\x68\x6d\x72\x77"
+			  "\x7c\x81\x86\x8b\x90\x95\x9a\x9f"
+			  "\xa4\xa9\xae\xb3\xb8\xbd\xc2\xc7"
+			  "\xcc\xd1\xd6\xdb\xe0\xe5\xea\xef"
+			  "\xf4\xf9\xfe\x03\x08\x0d\x12\x17"
+			  "\x1c\x21\x26\x2b\x30\x35\x3a\x3f"
+			  "\x44\x49\x4e\x53\x58\x5d\x62\x67"
+			  "\x6c\x71\x76\x7b\x80\x85\x8a\x8f"
+			  "\x94\x99\x9e\xa3\xa8\xad\xb2\xb7"
+			  "\xbc\xc1\xc6\xcb\xd0\xd5\xda\xdf"
+			  "\xe4\xe9\xee\xf3\xf8\xfd\x02\x07"
+			  "\x0c\x11\x16\x1b\x20\x25\x2a\x2f"
+			  "\x34\x39\x3e\x43\x48\x4d\x52\x57"
+			  "\x5c\x61\x66\x6b\x70\x75\x7a\x7f"
+			  "\x84\x89\x8e\x93\x98\x9d\xa2\xa7"
+			  "\xac\xb1\xb6\xbb\xc0\xc5\xca\xcf"
+			  "\xd4\xd9\xde\xe3\xe8\xed\xf2\xf7"
+			  "\xfc\x01\x06\x0b\x10\x15\x1a\x1f"
+			  "\x24\x29\x2e\x33\x38\x3d\x42\x47"
+			  "\x4c\x51\x56\x5b\x60\x65\x6a\x6f"
+			  "\x74\x79\x7e\x83\x88\x8d\x92\x97"
+			  "\x9c\xa1\xa6\xab\xb0\xb5\xba\xbf"
+			  "\xc4\xc9\xce\xd3\xd8\xdd\xe2\xe7"
+			  "\xec\xf1\xf6\xfb\x00\x05\x0a\x0f"
+			  "\x14\x19\x1e\x23\x28\x2d\x32\x37"
+			  "\x3c\x41\x46\x4b\x50\x55\x5a\x5f"
+			  "\x64\x69\x6e\x73\x78\x7d\x82\x87"
+			  "\x8c\x91\x96\x9b\xa0\xa5\xaa\xaf"
+			  "\xb4\xb9\xbe\xc3\xc8\xcd\xd2\xd7"
+			  "\xdc\xe1\xe6\xeb\xf0\xf5\xfa\xff"
+			  "\x05\x0a\x0f\x14\x19\x1e\x23\x28"
+			  "\x2d\x32\x37\x3c\x41\x46\x4b\x50"
+			  "\x55\x5a\x5f\x64\x69\x6e\x73\x78"
+			  "\x7d\x82\x87\x8c\x91\x96\x9b\xa0"
+			  "\xa5\xaa\xaf\xb4\xb9\xbe\xc3\xc8"
+			  "\xcd\xd2\xd7\xdc\xe1\xe6\xeb\xf0"
+			  "\xf5\xfa\xff\x04\x09\x0e\x13\x18"
+			  "\x1d\x22\x27\x2c\x31\x36\x3b\x40"
+			  "\x45\x4a\x4f\x54\x59\x5e\x63\x68"
+			  "\x6d\x72\x77\x7c\x81\x86\x8b\x90"
+			  "\x95\x9a\x9f\xa4\xa9\xae\xb3\xb8"
+			  "\xbd\xc2\xc7\xcc\xd1\xd6\xdb\xe0"
+			  "\xe5\xea\xef\xf4\xf9\xfe\x03\x08"
+			  "\x0d\x12\x17\x1c\x21\x26\x2b\x30"
+			  "\x35\x3a\x3f\x44\x49\x4e\x53\x58"
+			  "\x5d\x62\x67\x6c\x71\x76\x7b\x80"
+			  "\x85\x8a\x8f\x94\x99\x9e\xa3\xa8"
+			  "\xad\xb2\xb7\xbc\xc1\xc6\xcb\xd0"
+			  "\xd5\xda\xdf\xe4\xe9\xee\xf3\xf8"
+			  "\xfd\x02\x07\x0c\x11\x16\x1b\x20"
+			  "\x25\x2a\x2f\x34\x39\x3e\x43\x48"
+			  "\x4d\x52\x57\x5c\x61\x66\x6b\x70"
+			  "\x75\x7a\x7f\x84\x89\x8e\x93\x98"
+			  "\x9d\xa2\xa7\xac\xb1\xb6\xbb\xc0"
+			  "\xc5\xca\xcf\xd4\xd9\xde\xe3\xe8"
+			  "\xed\xf2\xf7\xfc\x01\x06\x0b\x10"
+			  "\x15\x1a\x1f\x24\x29\x2e\x33\x38"
+			  "\x3d\x42\x47\x4c\x51\x56\x5b\x60"
+			  "\x65\x6a\x6f\x74\x79\x7e\x83\x88"
+			  "\x8d\x92\x97\x9c\xa1\xa6\xab\xb0"
+			  "\xb5\xba\xbf\xc4\xc9\xce\xd3\xd8"
+			  "\xdd\xe2\xe7\xec\xf1\xf6\xfb\x00"
+			  "\x06\x0b\x10\x15\x1a\x1f\x24\x29"
+			  "\x2e\x33\x38\x3d\x42\x47\x4c\x51"
+			  "\x56\x5b\x60\x65\x6a\x6f\x74\x79"
+			  "\x7e\x83\x88\x8d\x92\x97\x9c\xa1"
+			  "\xa6\xab\xb0\xb5\xba\xbf\xc4\xc9"
+			  "\xce\xd3\xd8\xdd\xe2\xe7\xec\xf1"
+			  "\xf6\xfb\x00\x05\x0a\x0f\x14\x19"
+			  "\x1e\x23\x28\x2d\x32\x37\x3c\x41"
+			  "\x46\x4b\x50\x55\x5a\x5f\x64\x69"
+			  "\x6e\x73\x78\x7d\x82\x87\x8c\x91"
+			  "\x96\x9b\xa0\xa5\xaa\xaf\xb4\xb9"
+			  "\xbe\xc3\xc8\xcd\xd2\xd7\xdc\xe1"
+			  "\xe6\xeb\xf0\xf5\xfa\xff\x04\x09"
+			  "\x0e\x13\x18\x1d\x22\x27\x2c\x31"
+			  "\x36\x3b\x40\x45\x4a\x4f\x54\x59"
+			  "\x5e\x63\x68\x6d\x72\x77\x7c\x81"
+			  "\x86\x8b\x90\x95\x9a\x9f\xa4\xa9"
+			  "\xae\xb3\xb8\xbd\xc2\xc7\xcc\xd1"
+			  "\xd6\xdb\xe0\xe5\xea\xef\xf4\xf9"
+			  "\xfe\x03\x08\x0d\x12\x17\x1c\x21"
+			  "\x26\x2b\x30\x35\x3a\x3f\x44\x49"
+			  "\x4e\x53\x58\x5d\x62\x67\x6c\x71"
+			  "\x76\x7b\x80\x85\x8a\x8f\x94\x99"
+			  "\x9e\xa3\xa8\xad\xb2\xb7\xbc\xc1"
+			  "\xc6\xcb\xd0\xd5\xda\xdf\xe4\xe9"
+			  "\xee\xf3\xf8\xfd\x02\x07\x0c\x11"
+			  "\x16\x1b\x20\x25\x2a\x2f\x34\x39"
+			  "\x3e\x43\x48\x4d\x52\x57\x5c\x61"
+			  "\x66\x6b\x70\x75\x7a\x7f\x84\x89"
+			  "\x8e\x93\x98\x9d\xa2\xa7\xac\xb1"
+			  "\xb6\xbb\xc0\xc5\xca\xcf\xd4\xd9"
+			  "\xde\xe3\xe8\xed\xf2\xf7\xfc\x01"
+			  "\x07\x0c\x11\x16\x1b\x20\x25\x2a"
+			  "\x2f\x34\x39\x3e\x43\x48\x4d\x52"
+			  "\x57\x5c\x61\x66\x6b\x70\x75\x7a"
+			  "\x7f\x84\x89\x8e\x93\x98\x9d\xa2"
+			  "\xa7\xac\xb1\xb6\xbb\xc0\xc5\xca"
+			  "\xcf\xd4\xd9\xde\xe3\xe8\xed\xf2"
+			  "\xf7\xfc\x01\x06\x0b\x10\x15\x1a"
+			  "\x1f\x24\x29\x2e\x33\x38\x3d\x42"
+			  "\x47\x4c\x51\x56\x5b\x60\x65\x6a"
+			  "\x6f\x74\x79\x7e\x83\x88\x8d\x92"
+			  "\x97\x9c\xa1\xa6\xab\xb0\xb5\xba"
+			  "\xbf\xc4\xc9\xce\xd3\xd8\xdd\xe2"
+			  "\xe7\xec\xf1\xf6\xfb\x00\x05\x0a"
+			  "\x0f\x14\x19\x1e\x23\x28\x2d\x32"
+			  "\x37\x3c\x41\x46\x4b\x50\x55\x5a"
+			  "\x5f\x64\x69\x6e\x73\x78\x7d\x82"
+			  "\x87\x8c\x91\x96\x9b\xa0\xa5\xaa"
+			  "\xaf\xb4\xb9\xbe\xc3\xc8\xcd\xd2"
+			  "\xd7\xdc\xe1\xe6\xeb\xf0\xf5\xfa"
+			  "\xff\x04\x09\x0e\x13\x18\x1d\x22"
+			  "\x27\x2c\x31\x36\x3b\x40\x45\x4a"
+			  "\x4f\x54\x59\x5e\x63\x68\x6d\x72"
+			  "\x77\x7c\x81\x86\x8b\x90\x95\x9a"
+			  "\x9f\xa4\xa9\xae\xb3\xb8\xbd\xc2"
+			  "\xc7\xcc\xd1\xd6\xdb\xe0\xe5\xea"
+			  "\xef\xf4\xf9\xfe\x03\x08\x0d\x12"
+			  "\x17\x1c\x21\x26\x2b\x30\x35\x3a"
+			  "\x3f\x44\x49\x4e\x53\x58\x5d\x62"
+			  "\x67\x6c\x71\x76\x7b\x80\x85\x8a"
+			  "\x8f\x94\x99\x9e\xa3\xa8\xad\xb2"
+			  "\xb7\xbc\xc1\xc6\xcb\xd0\xd5\xda"
+			  "\xdf\xe4\xe9\xee\xf3\xf8\xfd\x02",
+		.ctext	= "\x09\xcf\x0c\xc8\x05\x94\x9d\x8d"
+			  "\x64\x7f\x4a\x59\xa5\x7f\x31\x08"
+			  "\x6f\x8c\x29\x0e\xa8\x71\x80\x5c"
+			  "\xc4\xb9\x38\xd6\x15\x40\xdf\x76"
+			  "\x5d\x83\x71\xaf\xf7\x42\x1a\x35"
+			  "\xc8\xdf\xd8\xe3\x18\xba\x86\x56"
+			  "\xb0\xbc\x2f\x33\x75\x94\xc6\x00"
+			  "\x04\x84\xdf\xbb\xde\xa5\x06\xea"
+			  "\x52\xff\xcb\xdd\xeb\x0e\xfb\x6a"
+			  "\xa2\x16\x85\x61\x9d\x44\x06\xac"
+			  "\x78\xa9\x01\x60\x97\x4e\x05\xfb"
+			  "\x9c\xfd\xf5\x8e\xd4\x9c\xc7\xd9"
+			  "\x4b\xb8\x49\x54\xfb\x98\x64\x4b"
+			  "\x36\xa2\xaf\x02\xfe\x85\xb0\x7c"
+			  "\x20\xad\xc0\xb4\xf2\x16\xc1\xbe"
+			  "\x6c\x66\x21\x83\xe8\xd8\x40\xd1"
+			  "\x87\x7f\x4e\x85\x0b\x33\xd5\xaa"
+			  "\x75\xbb\x41\x40\x5e\x91\xf1\xb4"
+			  "\xb3\xe1\x54\xc1\xfd\x8e\x83\x0d"
+			  "\x50\x1f\xf3\xfc\x32\x38\x79\x9c"
+			  "\xdb\x61\xa4\x31\x29\x38\xfe\x9d"
+			  "\xcd\x3a\x53\xe4\x0a\x67\xc9\x3a"
+			  "\xc3\xb5\x82\xbe\xcb\x9f\x2e\x99"
+			  "\xb8\x80\xdd\x3c\xe2\xee\x25\x5d"
+			  "\x59\xc4\xc2\x10\xe8\x95\x37\xd9"
+			  "\xbe\xf3\x55\x46\x75\xc8\x43\xb5"
+			  "\x0d\x8c\xc3\xa8\x48\x4b\x8d\xf3"
+			  "\xfd\x3d\x6f\x1a\xc9\xfc\x35\x09"
+			  "\x0f\x4e\x0c\x68\x1f\x47\x28\x54"
+			  "\x47\xcc\xba\x58\x8b\xc2\xc6\xd9"
+			  "\xc5\x16\x14\x9f\x19\xcf\xf0\x7f"
+			  "\x64\xee\xe9\x01\x77\x1d\x75\xc0"
+			  "\x48\xbb\xba\x23\xa3\x2d\x5f\x45"
+			  "\x06\x01\x25\xba\x59\x95\x6c\x2e"
+			  "\xe6\x3e\x85\x29\x34\x1f\x8d\x45"
+			  "\xe3\x25\xcd\x38\x42\x24\xb2\xda"
+			  "\xa2\xd5\x66\x90\x45\x52\x1a\xee"
+			  "\x90\x52\xe9\x6d\x5d\x06\xb9\xa8"
+			  "\x83\x54\x7c\x88\xdc\xf2\x20\x93"
+			  "\x10\x8a\x9c\x65\x4a\x31\x2c\xdd"
+			  "\x5b\xdc\xf8\x8a\xbd\x43\x9f\x01"
+			  "\x16\x59\xe2\x28\xac\x36\x05\xf4"
+			  "\x94\xce\xef\xe0\xd1\x4d\x5d\xbe"
+			  "\xff\xe7\x64\x29\xec\x7d\xf4\x6b"
+			  "\xd1\x10\xe4\x6c\xf6\x18\xa2\xcd"
+			  "\x00\xe0\xb0\xf9\xc3\x30\x01\x8f"
+			  "\x08\x4e\xd5\xf1\xae\xf8\x63\x8d"
+			  "\x46\x07\xb2\x76\x68\xc5\xae\xdf"
+			  "\x80\x09\x9c\xe5\x0e\x59\xe9\x67"
+			  "\x47\x6c\xb0\xc4\xee\xe7\x16\x75"
+			  "\x62\x88\xbc\xf3\x1e\x35\xa3\xa8"
+			  "\x03\xb7\x25\xed\x3c\xbc\x87\xce"
+			  "\x25\x3e\x11\xfc\x00\xa7\x77\xcb"
+			  "\xf0\xfa\x3a\xa3\x42\x34\x76\x32"
+			  "\x11\x26\x94\xf3\x88\x1a\x31\x99"
+			  "\xb3\xd9\x63\x39\xa6\x92\xe4\xa2"
+			  "\xfd\x4a\x6c\x36\x99\xdb\x40\x5c"
+			  "\xd6\x38\x0b\xc4\xd1\xc4\x4a\x77"
+			  "\x8f\xab\x46\xcc\x43\xbd\x55\x57"
+			  "\x70\x57\xe3\x0a\xe8\x53\x29\xae"
+			  "\x99\xab\xd5\x8f\x04\x4e\x51\xce"
+			  "\x59\x81\x18\xb3\x6d\x51\x25\x0d"
+			  "\xba\x57\xbe\x15\x91\x39\x26\xc3"
+			  "\x64\xa6\x8e\x74\xbf\xb6\x09\x01"
+			  "\x6e\x8a\xbf\x5c\xae\x10\x37\x9f"
+			  "\x34\x58\x2d\x9f\x6c\x8d\xc0\xb6"
+			  "\xfb\x2a\x77\xa8\xc3\xe5\x98\x90"
+			  "\x4b\x9e\xc2\x06\xb3\x06\x8a\x9f"
+			  "\x51\x0c\x76\x7c\xd5\x51\xe9\x89"
+			  "\x27\xb9\xcf\xdc\x63\x0d\x5e\x90"
+			  "\x78\x8d\xa4\xe0\x1d\x65\xa3\x89"
+			  "\xfc\x9f\x57\x65\x7f\x67\x0c\x60"
+			  "\xc4\x57\x09\x98\x1b\x52\xae\x83"
+			  "\x56\xf3\xb8\x12\xdf\x01\xc3\x47"
+			  "\x79\x64\xbd\x06\xf5\xdf\x9e\x0f"
+			  "\x62\x49\x06\x29\x72\x52\x71\x32"
+			  "\xec\xf7\xca\x97\xc3\x2d\x8f\x31"
+			  "\x97\xf9\xe2\xb3\x28\x18\x55\x3c"
+			  "\x55\xeb\x29\x55\x00\x07\xf7\xbb"
+			  "\x44\x91\x41\x8e\xa1\x4e\xa0\x88"
+			  "\xf5\xca\x95\xf2\x9d\x3c\xdc\xe7"
+			  "\x7c\x66\x6d\xf3\x0c\x72\x0b\x7c"
+			  "\xbe\xc3\xa5\xce\x19\xb4\x0d\x05"
+			  "\x1a\xb4\xe0\x1d\xa6\xba\xd5\xe6"
+			  "\xb0\x1e\x08\x52\xae\xbc\x3c\xe3"
+			  "\xba\x7c\x28\x55\xa2\xaa\x5e\x0b"
+			  "\xd9\x2e\xfd\x88\x32\x11\x65\x29"
+			  "\x68\xb9\xdc\xbc\xab\x55\xea\x35"
+			  "\x76\x9c\x82\x1e\xa0\x7a\x92\xed"
+			  "\x4e\x83\xe0\x8f\x19\xbd\x9b\x65"
+			  "\x8b\xa3\xc2\xb4\xa0\x64\xd6\x71"
+			  "\xa9\x5e\xc8\xf7\x41\x54\xe7\x87"
+			  "\x03\xde\x50\x5a\xb6\xd7\x84\xac"
+			  "\xc0\xd7\x65\x63\xbb\x75\x90\xf2"
+			  "\x8a\x23\xd8\x41\x26\x30\x72\xf0"
+			  "\x05\x8d\x1a\x4a\xff\x17\x4d\x73"
+			  "\xac\x4e\x31\x47\xde\x42\x65\xf9"
+			  "\x05\x04\x5e\xc3\x8b\xfd\x0a\x3e"
+			  "\x31\x2e\x84\xf2\xfa\x10\xde\x57"
+			  "\x6c\x31\xe4\xb4\x2d\xa4\x13\xe9"
+			  "\x68\xca\x4e\x48\x0d\x7c\xab\x06"
+			  "\xc1\xba\x5c\x11\x3c\x8e\x96\x81"
+			  "\x69\x09\xbc\x6a\xcd\xeb\x01\x71"
+			  "\x96\x14\xc7\x25\x2e\x46\xee\x9e"
+			  "\x65\xf0\xe3\xcb\x99\x93\x50\x41"
+			  "\x73\x70\x00\xb2\xaa\xd8\x48\xb3"
+			  "\xcf\xda\x2d\x94\x35\x9c\xdd\x5c"
+			  "\xac\x0b\xac\x40\x83\xe5\x40\xef"
+			  "\x40\xd8\x67\x6f\xc8\x5a\x2e\xf7"
+			  "\x0a\x2e\x74\x1d\x88\xad\x66\xc3"
+			  "\x4e\x7b\xe4\x8a\x52\x63\x10\x36"
+			  "\x03\xf6\x40\x36\xf4\xfe\x81\x87"
+			  "\x30\x45\x4f\x59\xdf\x01\x71\xb6"
+			  "\x7d\xfe\x14\x61\xe1\x02\xb6\xf8"
+			  "\xd3\xf0\x17\x04\x96\x12\x8a\x39"
+			  "\xdd\x43\x09\x28\xe1\xa7\x66\x8d"
+			  "\x0a\x3f\xed\x75\xe0\x1b\xde\x5a"
+			  "\x84\x54\x1a\x97\x46\x38\x28\x65"
+			  "\xc5\x22\x9d\xc0\x16\x72\x0b\x33"
+			  "\x18\x12\x68\x28\x94\x1f\x3a\x43"
+			  "\xa0\xa7\xd8\xda\xdc\x3f\xa1\xec"
+			  "\xea\xb3\xc8\xf6\x4b\xdb\xdb\x24"
+			  "\xe2\xfa\xb7\x5d\xc2\x1c\x31\x49"
+			  "\x0c\x91\x82\x7a\x25\xf9\x4b\x8f"
+			  "\xd5\x92\x81\x1e\x75\x21\x26\x6a"
+			  "\xfc\xad\x8d\xd7\x4c\xe8\x56\x7c"
+			  "\x69\x87\xde\x93\x18\xa7\x8c\x3b"
+			  "\x45\xfc\x47\xa1\x34\x81\x03\x98"
+			  "\xa4\xdc\xda\xac\xe8\x4f\x74\xaf"
+			  "\xa6\x0b\x8b\xec\x7a\xc2\x47\xb7"
+			  "\x85\x94\xb8\x1d\x6c\xea\x8c\xe2"
+			  "\x8d\xb6\x9f\x57\xd5\xcb\x82\x23"
+			  "\x9f\xa9\x23\x96\xa9\x69\x24\x5b"
+			  "\x2e\x41\x24\x45\x1b\xfa\xe8\xab"
+			  "\x0b\xc3\x8e\x65\x59\x0b\xf3\x78"
+			  "\x29\xde\x50\x8c\x4f\x2c\xca\x67"
+			  "\x0a\x8d\x54\x66\x75\x58\x56\x8c"
+			  "\x5d\xa8\xe3\xc0\x71\x33\x84\x68"
+			  "\x2a\x65\xdf\x6d\x1e\x5a\x8b\xae"
+			  "\xbe\xfa\xdc\x98\xc3\x80\xed\x2a"
+			  "\x2f\xc9\x0a\x9f\x0b\xcd\x9a\xc6"
+			  "\xb4\x6a\x3c\x24\x68\x62\x81\x2d"
+			  "\x15\xe4\x16\x55\x09\x4d\x82\x46"
+			  "\x0d\x9a\x65\xf1\x32\x5d\x96\x57"
+			  "\x21\xd8\x5b\x1b\xa7\x90\x01\xd3"
+			  "\x28\x20\xba\x30\xc0\x3e\x7c\x60"
+			  "\x1f\xfa\x7d\xce\x0b\x5c\xb1\xe2"
+			  "\x4d\xe7\x9a\x5d\x0c\x28\x7d\x77"
+			  "\x3f\xfb\xe7\x77\x9a\x95\x97\xe1"
+			  "\xca\xe2\x08\xc2\x74\xb9\x5e\x07"
+			  "\x62\x47\x1c\x19\x49\x2b\xb5\x8c"
+			  "\x1e\xbb\x66\xeb\x68\xe8\x74\xaa"
+			  "\x93\xe0\x24\x66\x62\xc7\x74\xca"
+			  "\x33\x47\xc0\x02\xfa\xf1\xc6\x05"
+			  "\xf8\x68\xd6\xab\xc2\x30\xaa\x3b"
+			  "\xe7\x8e\xf6\x4f\xfe\x97\x6d\x31"
+			  "\x90\x58\x0d\xdd\x53\x49\xf9\xa5"
+			  "\x2c\xeb\x15\xda\xb1\x2f\x53\xad"
+			  "\xaf\xcc\x20\x8d\x3f\xf7\x0e\x9b"
+			  "\xbb\xfd\xfe\xf4\x9e\x1d\x83\xd7"
+			  "\x42\x64\x42\x17\xa9\xa0\x5e\x8f"
+			  "\x3b\x24\xcc\x05\x01\x8c\xf2\x4c"
+			  "\x1e\x08\x74\x17\x74\x63\x24\x8d"
+			  "\xd1\x57\x9f\x9d\x5a\x2a\x3f\x2b"
+			  "\x56\x0e\x7f\xb7\xa4\x77\xf0\xf4"
+			  "\xaa\x99\x57\x5c\x25\x73\xdb\x96"
+			  "\x43\x07\x12\x85\x7f\x88\x0b\xd9"
+			  "\x86\x49\x2b\xe2\x80\xfb\x2a\x42"
+			  "\x7b\xd8\x56\xf5\x41\x12\x75\xd7"
+			  "\x4b\xfe\x5b\x84\x07\xc9\xc0\xcd"
+			  "\x2e\xae\x24\xf2\x2f\x3a\x15\x96"
+			  "\xb4\x81\xa8\x6e\x26\xd1\x67\xaf"
+			  "\xc9\x8d\x40\x1c\x4e\xdb\xbe\x3f"
+			  "\x88\x73\x1b\x2c\x34\x8b\xc7\x9d"
+			  "\xa2\x5c\x6a\x9e\x02\x75\x5a\x38"
+			  "\x47\x34\x15\x83\x0a\x58\x11\xd8"
+			  "\x27\x99\x75\x0f\xdc\x62\x11\x7a"
+			  "\x35\xa6\xbc\xca\x68\xc8\xb6\x1e"
+			  "\x7c\x5d\xe5\x3d\xa6\xde\x8b\x2c"
+			  "\xba\x9b\x68\xa1\xee\x0a\xbc\x01"
+			  "\xf4\x71\x85\xeb\x98\x6c\x4e\xed"
+			  "\x84\x37\x24\x96\xe8\x77\xbe\xb0"
+			  "\xb4\x2d\x1a\xca\x47\x52\xe9\x47"
+			  "\x53\xa6\x3a\x85\x82\xf6\x24\x9e"
+			  "\xa5\xf9\x93\xe6\x03\xed\x80\x56"
+			  "\xbd\x79\x20\x15\xc6\xab\x36\x6d"
+			  "\xd8\x08\xc8\x0f\x0b\xd6\xee\x16"
+			  "\x7b\xbb\xa2\x95\x91\xca\x1e\x25"
+			  "\x85\x85\xdc\xbb\x01\xf3\xe2\xed"
+			  "\xae\xe9\xd9\x94\x0e\xa9\xa5\x2c"
+			  "\xf9\x27\xab\x42\x19\x3d\xbc\x86"
+			  "\x59\x2e\x66\x80\xab\xc9\x6c\x79"
+			  "\x83\x31\x78\x82\xd3\x8b\x03\x64"
+			  "\x8a\xb3\x8e\x8e\x1d\x79\x4c\x34"
+			  "\x99\x38\xf5\x21\x18\xb2\x10\x17"
+			  "\x13\xf1\xca\xeb\x7e\xc6\x4c\x03"
+			  "\xef\x7e\x35\xc6\x9b\x15\x1e\x89"
+			  "\x56\x00\xdb\x41\x97\x68\x06\x11"
+			  "\xc8\x0c\x32\xad\x20\x3f\xd4\x3c"
+			  "\xa8\x9b\x64\xdb\x9d\x62\xf8\x97"
+			  "\x0a\x35\x0f\xf2\x27\x74\x60\x1b"
+			  "\x7c\xe0\x56\x9f\xab\x26\xe7\x4b"
+			  "\x35\x62\x72\x84\x55\xcd\x8a\xac"
+			  "\xf5\x52\x24\xc6\x17\xbe\x81\x4f"
+			  "\x90\x7a\xc2\x1f\x8a\x7c\x90\x6f"
+			  "\xd6\x6b\xc2\xf3\xc5\xe8\xfd\x53"
+			  "\xaa\xbe\x7e\x0d\xa9\xfc\xed\x1c"
+			  "\xfa\xb9\xb3\x5b\x9f\x6f\xbe\x4e"
+			  "\x2d\x31\xcc\x6c\x78\x94\x56\x0c"
+			  "\x39\xa5\x65\x13\xa9\x8f\x46\x0e"
+			  "\x95\x03\xec\x79\x21\x1d\x8a\xa5"
+			  "\x97\xc0\x3c\xe0\x23\xee\x65\xf3"
+			  "\x89\x44\x91\x6e\x11\xcc\x6a\xeb"
+			  "\xe9\xc9\x78\x18\x72\xea\x7b\x4b"
+			  "\x4f\xb5\x10\x9d\x48\xf1\x2a\x3b"
+			  "\x08\x22\xf6\xfd\xa4\x37\x7e\x3d"
+			  "\xc7\xce\xf2\xc1\xc0\xd3\xe4\xb9"
+			  "\x68\x7d\x37\x77\x03\xae\xd3\x65"
+			  "\xcf\xe5\x06\xab\x26\x10\x90\x56"
+			  "\x1f\x4b\xaa\x36\x7f\x5a\x6b\xa8"
+			  "\xbb\x85\xa4\x1c\xf0\xdb\xa8\xc4"
+			  "\xd6\x4d\xae\xe4\xa1\x5f\x31\x0b"
+			  "\x50\x78\x52\x1d\xcc\x26\x13\xa0"
+			  "\x39\x15\xce\x47\x7e\xfc\x54\x97"
+			  "\x7a\x8b\xe3\x4e\x59\x1e\x8a\x11"
+			  "\xd1\x6b\x61\x98\x0c\x4b\x07\x36"
+			  "\xe9\x61\xa8\xa3\x71\x69\x5c\x7a"
+			  "\xe9\x96\x00\x44\xb0\x93\xa5\xa7"
+			  "\x0b\x09\x5c\xfd\x31\xe8\x35\xa9"
+			  "\xe0\xa4\xfc\x18\x3d\xa6\x4a\x80"
+			  "\x72\x5e\xba\xab\x8a\xa9\xcc\xba"
+			  "\xf3\x45\x14\xee\xc8\x62\xc7\xa4"
+			  "\x6a\x37\xf9\x20\x3c\x11\x6f\x20"
+			  "\x42\xf4\x1a\x7a\xb3\x97\x88\xce"
+			  "\xa3\x7e\xd4\x0a\xeb\x12\xdb\x56"
+			  "\xd8\x7a\x48\x4b\xb3\x8f\x02\xee"
+			  "\xef\x80\x62\xa4\x09\xc1\x6c\x30"
+			  "\x0a\x48\xbe\x6f\x72\xa8\x4c\x23"
+			  "\x10\x4f\x1b\x0f\xfa\x79\xa4\xdb"
+			  "\x14\x31\x41\x37\x61\x59\xda\xa4"
+			  "\x08\x4b\xd5\x92\xba\x8e\x2c\x1b"
+			  "\x08\x01\x93\xd0\xec\x04\x44\x24"
+			  "\x57\xa9\x5a\xa5\x84\x16\x0b\x9d"
+			  "\x13\xa9\x80\x6a\x90\xd3\xc1\xbd"
+			  "\x37\x78\xb4\x3f\x83\xec\x11\x60"
+			  "\x3c\x75\x6b\x04\x3c\x37\xf1\x56"
+			  "\xec\xd5\x5e\x2d\x03\xcb\x2e\x83"
+			  "\xae\x7a\xc2\xa9\xbb\x7d\x31\x45"
+			  "\xfe\x6d\x80\x4b\xc3\x65\x6c\x68"
+			  "\x24\x38\xce\xee\x2a\x8f\xa3\x9a"
+			  "\x90\xa6\xef\x8f\xe6\xe8\xfa\xa5"
+			  "\x96\xe1\x3a\xdd\x2f\xc5\x1a\x7b"
+			  "\x0a\xf1\xbf\x96\xbc\x6f\x65\x5d"
+			  "\x5b\x21\x82\x69\x94\xb6\x53\xee"
+			  "\xa9\xfb\xc7\x6c\xe8\xde\x6b\xc7"
+			  "\x22\x9d\xc0\x25\x7b\xf9\x90\xda",
+		.len	= 2048,
+	}, { /* 2 units of 4096 bytes */
+		.key	= "\x03\x0e\x19\x24\x2f\x3a\x45\x50"
+			  "\x5b\x66\x71\x7c\x87\x92\x9d\xa8"
+			  "\xb3\xbe\xc9\xd4\xdf\xea\xf5\x00"
+			  "\x0b\x16\x21\x2c\x37\x42\x4d\x58",
+		.klen	= 32,
+		.iv	= "\xef\xbe\xad\xde\x00\x00\x00\x00"
+			  "\x0c\x00\x00\x00\x00\x00\x00\x00",
+		.ptext	= "\x00\x11\x22\x33\x44\x55\x66\x77"
+			  "\x88\x99\xaa\xbb\xcc\xdd\xee\xff"
+			  "\x10\x21\x32\x43\x54\x65\x76\x87"
+			  "\x98\xa9\xba\xcb\xdc\xed\xfe\x0f"
+			  "\x20\x31\x42\x53\x64\x75\x86\x97"
+			  "\xa8\xb9\xca\xdb\xec\xfd\x0e\x1f"
+			  "\x30\x41\x52\x63\x74\x85\x96\xa7"
+			  "\xb8\xc9\xda\xeb\xfc\x0d\x1e\x2f"
+			  "\x40\x51\x62\x73\x84\x95\xa6\xb7"
+			  "\xc8\xd9\xea\xfb\x0c\x1d\x2e\x3f"
+			  "\x50\x61\x72\x83\x94\xa5\xb6\xc7"
+			  "\xd8\xe9\xfa\x0b\x1c\x2d\x3e\x4f"
+			  "\x60\x71\x82\x93\xa4\xb5\xc6\xd7"
+			  "\xe8\xf9\x0a\x1b\x2c\x3d\x4e\x5f"
+			  "\x70\x81\x92\xa3\xb4\xc5\xd6\xe7"
+			  "\xf8\x09\x1a\x2b\x3c\x4d\x5e\x6f"
+			  "\x80\x91\xa2\xb3\xc4\xd5\xe6\xf7"
+			  "\x08\x19\x2a\x3b\x4c\x5d\x6e\x7f"
+			  "\x90\xa1\xb2\xc3\xd4\xe5\xf6\x07"
+			  "\x18\x29\x3a\x4b\x5c\x6d\x7e\x8f"
+			  "\xa0\xb1\xc2\xd3\xe4\xf5\x06\x17"
+			  "\x28\x39\x4a\x5b\x6c\x7d\x8e\x9f"
+			  "\xb0\xc1\xd2\xe3\xf4\x05\x16\x27"
+			  "\x38\x49\x5a\x6b\x7c\x8d\x9e\xaf"
+			  "\xc0\xd1\xe2\xf3\x04\x15\x26\x37"
+			  "\x48\x59\x6a\x7b\x8c\x9d\xae\xbf"
+			  "\xd0\xe1\xf2\x03\x14\x25\x36\x47"
+			  "\x58\x69\x7a\x8b\x9c\xad\xbe\xcf"
+			  "\xe0\xf1\x02\x13\x24\x35\x46\x57"
+			  "\x68\x79\x8a\x9b\xac\xbd\xce\xdf"
+			  "\xf0\x01\x12\x23\x34\x45\x56\x67"
+			  "\x78\x89\x9a\xab\xbc\xcd\xde\xef"
+			  "\x00\x11\x22\x33\x44\x55\x66\x77"
+			  "\x88\x99\xaa\xbb\xcc\xdd\xee\xff"
+			  "\x10\x21\x32\x43\x54\x65\x76\x87"
+			  "\x98\xa9\xba\xcb\xdc\xed\xfe\x0f"
+			  "\x20\x31\x42\x53\x64\x75\x86\x97"
+			  "\xa8\xb9\xca\xdb\xec\xfd\x0e\x1f"
+			  "\x30\x41\x52\x63\x74\x85\x96\xa7"
+			  "\xb8\xc9\xda\xeb\xfc\x0d\x1e\x2f"
+			  "\x40\x51\x62\x73\x84\x95\xa6\xb7"
+			  "\xc8\xd9\xea\xfb\x0c\x1d\x2e\x3f"
+			  "\x50\x61\x72\x83\x94\xa5\xb6\xc7"
+			  "\xd8\xe9\xfa\x0b\x1c\x2d\x3e\x4f"
+			  "\x60\x71\x82\x93\xa4\xb5\xc6\xd7"
+			  "\xe8\xf9\x0a\x1b\x2c\x3d\x4e\x5f"
+			  "\x70\x81\x92\xa3\xb4\xc5\xd6\xe7"
+			  "\xf8\x09\x1a\x2b\x3c\x4d\x5e\x6f"
+			  "\x80\x91\xa2\xb3\xc4\xd5\xe6\xf7"
+			  "\x08\x19\x2a\x3b\x4c\x5d\x6e\x7f"
+			  "\x90\xa1\xb2\xc3\xd4\xe5\xf6\x07"
+			  "\x18\x29\x3a\x4b\x5c\x6d\x7e\x8f"
+			  "\xa0\xb1\xc2\xd3\xe4\xf5\x06\x17"
+			  "\x28\x39\x4a\x5b\x6c\x7d\x8e\x9f"
+			  "\xb0\xc1\xd2\xe3\xf4\x05\x16\x27"
+			  "\x38\x49\x5a\x6b\x7c\x8d\x9e\xaf"
+			  "\xc0\xd1\xe2\xf3\x04\x15\x26\x37"
+			  "\x48\x59\x6a\x7b\x8c\x9d\xae\xbf"
+			  "\xd0\xe1\xf2\x03\x14\x25\x36\x47"
+			  "\x58\x69\x7a\x8b\x9c\xad\xbe\xcf"
+			  "\xe0\xf1\x02\x13\x24\x35\x46\x57"
+			  "\x68\x79\x8a\x9b\xac\xbd\xce\xdf"
+			  "\xf0\x01\x12\x23\x34\x45\x56\x67"
+			  "\x78\x89\x9a\xab\xbc\xcd\xde\xef"
+			  "\x01\x12\x23\x34\x45\x56\x67\x78"
+			  "\x89\x9a\xab\xbc\xcd\xde\xef\x00"
+			  "\x11\x22\x33\x44\x55\x66\x77\x88"
+			  "\x99\xaa\xbb\xcc\xdd\xee\xff\x10"
+			  "\x21\x32\x43\x54\x65\x76\x87\x98"
+			  "\xa9\xba\xcb\xdc\xed\xfe\x0f\x20"
+			  "\x31\x42\x53\x64\x75\x86\x97\xa8"
+			  "\xb9\xca\xdb\xec\xfd\x0e\x1f\x30"
+			  "\x41\x52\x63\x74\x85\x96\xa7\xb8"
+			  "\xc9\xda\xeb\xfc\x0d\x1e\x2f\x40"
+			  "\x51\x62\x73\x84\x95\xa6\xb7\xc8"
+			  "\xd9\xea\xfb\x0c\x1d\x2e\x3f\x50"
+			  "\x61\x72\x83\x94\xa5\xb6\xc7\xd8"
+			  "\xe9\xfa\x0b\x1c\x2d\x3e\x4f\x60"
+			  "\x71\x82\x93\xa4\xb5\xc6\xd7\xe8"
+			  "\xf9\x0a\x1b\x2c\x3d\x4e\x5f\x70"
+			  "\x81\x92\xa3\xb4\xc5\xd6\xe7\xf8"
+			  "\x09\x1a\x2b\x3c\x4d\x5e\x6f\x80"
+			  "\x91\xa2\xb3\xc4\xd5\xe6\xf7\x08"
+			  "\x19\x2a\x3b\x4c\x5d\x6e\x7f\x90"
+			  "\xa1\xb2\xc3\xd4\xe5\xf6\x07\x18"
+			  "\x29\x3a\x4b\x5c\x6d\x7e\x8f\xa0"
+			  "\xb1\xc2\xd3\xe4\xf5\x06\x17\x28"
+			  "\x39\x4a\x5b\x6c\x7d\x8e\x9f\xb0"
+			  "\xc1\xd2\xe3\xf4\x05\x16\x27\x38"
+			  "\x49\x5a\x6b\x7c\x8d\x9e\xaf\xc0"
+			  "\xd1\xe2\xf3\x04\x15\x26\x37\x48"
+			  "\x59\x6a\x7b\x8c\x9d\xae\xbf\xd0"
+			  "\xe1\xf2\x03\x14\x25\x36\x47\x58"
+			  "\x69\x7a\x8b\x9c\xad\xbe\xcf\xe0"
+			  "\xf1\x02\x13\x24\x35\x46\x57\x68"
+			  "\x79\x8a\x9b\xac\xbd\xce\xdf\xf0"
+			  "\x01\x12\x23\x34\x45\x56\x67\x78"
+			  "\x89\x9a\xab\xbc\xcd\xde\xef\x00"
+			  "\x11\x22\x33\x44\x55\x66\x77\x88"
+			  "\x99\xaa\xbb\xcc\xdd\xee\xff\x10"
+			  "\x21\x32\x43\x54\x65\x76\x87\x98"
+			  "\xa9\xba\xcb\xdc\xed\xfe\x0f\x20"
+			  "\x31\x42\x53\x64\x75\x86\x97\xa8"
+			  "\xb9\xca\xdb\xec\xfd\x0e\x1f\x30"
+			  "\x41\x52\x63\x74\x85\x96\xa7\xb8"
+			  "\xc9\xda\xeb\xfc\x0d\x1e\x2f\x40"
+			  "\x51\x62\x73\x84\x95\xa6\xb7\xc8"
+			  "\xd9\xea\xfb\x0c\x1d\x2e\x3f\x50"
+			  "\x61\x72\x83\x94\xa5\xb6\xc7\xd8"
+			  "\xe9\xfa\x0b\x1c\x2d\x3e\x4f\x60"
+			  "\x71\x82\x93\xa4\xb5\xc6\xd7\xe8"
+			  "\xf9\x0a\x1b\x2c\x3d\x4e\x5f\x70"
+			  "\x81\x92\xa3\xb4\xc5\xd6\xe7\xf8"
+			  "\x09\x1a\x2b\x3c\x4d\x5e\x6f\x80"
+			  "\x91\xa2\xb3\xc4\xd5\xe6\xf7\x08"
+			  "\x19\x2a\x3b\x4c\x5d\x6e\x7f\x90"
+			  "\xa1\xb2\xc3\xd4\xe5\xf6\x07\x18"
+			  "\x29\x3a\x4b\x5c\x6d\x7e\x8f\xa0"
+			  "\xb1\xc2\xd3\xe4\xf5\x06\x17\x28"
+			  "\x39\x4a\x5b\x6c\x7d\x8e\x9f\xb0"
+			  "\xc1\xd2\xe3\xf4\x05\x16\x27\x38"
+			  "\x49\x5a\x6b\x7c\x8d\x9e\xaf\xc0"
+			  "\xd1\xe2\xf3\x04\x15\x26\x37\x48"
+			  "\x59\x6a\x7b\x8c\x9d\xae\xbf\xd0"
+			  "\xe1\xf2\x03\x14\x25\x36\x47\x58"
+			  "\x69\x7a\x8b\x9c\xad\xbe\xcf\xe0"
+			  "\xf1\x02\x13\x24\x35\x46\x57\x68"
+			  "\x79\x8a\x9b\xac\xbd\xce\xdf\xf0"
+			  "\x02\x13\x24\x35\x46\x57\x68\x79"
+			  "\x8a\x9b\xac\xbd\xce\xdf\xf0\x01"
+			  "\x12\x23\x34\x45\x56\x67\x78\x89"
+			  "\x9a\xab\xbc\xcd\xde\xef\x00\x11"
+			  "\x22\x33\x44\x55\x66\x77\x88\x99"
+			  "\xaa\xbb\xcc\xdd\xee\xff\x10\x21"
+			  "\x32\x43\x54\x65\x76\x87\x98\xa9"
+			  "\xba\xcb\xdc\xed\xfe\x0f\x20\x31"
+			  "\x42\x53\x64\x75\x86\x97\xa8\xb9"
+			  "\xca\xdb\xec\xfd\x0e\x1f\x30\x41"
+			  "\x52\x63\x74\x85\x96\xa7\xb8\xc9"
+			  "\xda\xeb\xfc\x0d\x1e\x2f\x40\x51"
+			  "\x62\x73\x84\x95\xa6\xb7\xc8\xd9"
+			  "\xea\xfb\x0c\x1d\x2e\x3f\x50\x61"
+			  "\x72\x83\x94\xa5\xb6\xc7\xd8\xe9"
+			  "\xfa\x0b\x1c\x2d\x3e\x4f\x60\x71"
+			  "\x82\x93\xa4\xb5\xc6\xd7\xe8\xf9"
+			  "\x0a\x1b\x2c\x3d\x4e\x5f\x70\x81"
+			  "\x92\xa3\xb4\xc5\xd6\xe7\xf8\x09"
+			  "\x1a\x2b\x3c\x4d\x5e\x6f\x80\x91"
+			  "\xa2\xb3\xc4\xd5\xe6\xf7\x08\x19"
+			  "\x2a\x3b\x4c\x5d\x6e\x7f\x90\xa1"
+			  "\xb2\xc3\xd4\xe5\xf6\x07\x18\x29"
+			  "\x3a\x4b\x5c\x6d\x7e\x8f\xa0\xb1"
+			  "\xc2\xd3\xe4\xf5\x06\x17\x28\x39"
+			  "\x4a\x5b\x6c\x7d\x8e\x9f\xb0\xc1"
+			  "\xd2\xe3\xf4\x05\x16\x27\x38\x49"
+			  "\x5a\x6b\x7c\x8d\x9e\xaf\xc0\xd1"
+			  "\xe2\xf3\x04\x15\x26\x37\x48\x59"
+			  "\x6a\x7b\x8c\x9d\xae\xbf\xd0\xe1"
+			  "\xf2\x03\x14\x25\x36\x47\x58\x69"
+			  "\x7a\x8b\x9c\xad\xbe\xcf\xe0\xf1"
+			  "\x02\x13\x24\x35\x46\x57\x68\x79"
+			  "\x8a\x9b\xac\xbd\xce\xdf\xf0\x01"
+			  "\x12\x23\x34\x45\x56\x67\x78\x89"
+			  "\x9a\xab\xbc\xcd\xde\xef\x00\x11"
+			  "\x22\x33\x44\x55\x66\x77\x88\x99"
+			  "\xaa\xbb\xcc\xdd\xee\xff\x10\x21"
+			  "\x32\x43\x54\x65\x76\x87\x98\xa9"
+			  "\xba\xcb\xdc\xed\xfe\x0f\x20\x31"
+			  "\x42\x53\x64\x75\x86\x97\xa8\xb9"
+			  "\xca\xdb\xec\xfd\x0e\x1f\x30\x41"
+			  "\x52\x63\x74\x85\x96\xa7\xb8\xc9"
+			  "\xda\xeb\xfc\x0d\x1e\x2f\x40\x51"
+			  "\x62\x73\x84\x95\xa6\xb7\xc8\xd9"
+			  "\xea\xfb\x0c\x1d\x2e\x3f\x50\x61"
+			  "\x72\x83\x94\xa5\xb6\xc7\xd8\xe9"
+			  "\xfa\x0b\x1c\x2d\x3e\x4f\x60\x71"
+			  "\x82\x93\xa4\xb5\xc6\xd7\xe8\xf9"
+			  "\x0a\x1b\x2c\x3d\x4e\x5f\x70\x81"
+			  "\x92\xa3\xb4\xc5\xd6\xe7\xf8\x09"
+			  "\x1a\x2b\x3c\x4d\x5e\x6f\x80\x91"
+			  "\xa2\xb3\xc4\xd5\xe6\xf7\x08\x19"
+			  "\x2a\x3b\x4c\x5d\x6e\x7f\x90\xa1"
+			  "\xb2\xc3\xd4\xe5\xf6\x07\x18\x29"
+			  "\x3a\x4b\x5c\x6d\x7e\x8f\xa0\xb1"
+			  "\xc2\xd3\xe4\xf5\x06\x17\x28\x39"
+			  "\x4a\x5b\x6c\x7d\x8e\x9f\xb0\xc1"
+			  "\xd2\xe3\xf4\x05\x16\x27\x38\x49"
+			  "\x5a\x6b\x7c\x8d\x9e\xaf\xc0\xd1"
+			  "\xe2\xf3\x04\x15\x26\x37\x48\x59"
+			  "\x6a\x7b\x8c\x9d\xae\xbf\xd0\xe1"
+			  "\xf2\x03\x14\x25\x36\x47\x58\x69"
+			  "\x7a\x8b\x9c\xad\xbe\xcf\xe0\xf1"
+			  "\x03\x14\x25\x36\x47\x58\x69\x7a"
+			  "\x8b\x9c\xad\xbe\xcf\xe0\xf1\x02"
+			  "\x13\x24\x35\x46\x57\x68\x79\x8a"
+			  "\x9b\xac\xbd\xce\xdf\xf0\x01\x12"
+			  "\x23\x34\x45\x56\x67\x78\x89\x9a"
+			  "\xab\xbc\xcd\xde\xef\x00\x11\x22"
+			  "\x33\x44\x55\x66\x77\x88\x99\xaa"
+			  "\xbb\xcc\xdd\xee\xff\x10\x21\x32"
+			  "\x43\x54\x65\x76\x87\x98\xa9\xba"
+			  "\xcb\xdc\xed\xfe\x0f\x20\x31\x42"
+			  "\x53\x64\x75\x86\x97\xa8\xb9\xca"
+			  "\xdb\xec\xfd\x0e\x1f\x30\x41\x52"
+			  "\x63\x74\x85\x96\xa7\xb8\xc9\xda"
+			  "\xeb\xfc\x0d\x1e\x2f\x40\x51\x62"
+			  "\x73\x84\x95\xa6\xb7\xc8\xd9\xea"
+			  "\xfb\x0c\x1d\x2e\x3f\x50\x61\x72"
+			  "\x83\x94\xa5\xb6\xc7\xd8\xe9\xfa"
+			  "\x0b\x1c\x2d\x3e\x4f\x60\x71\x82"
+			  "\x93\xa4\xb5\xc6\xd7\xe8\xf9\x0a"
+			  "\x1b\x2c\x3d\x4e\x5f\x70\x81\x92"
+			  "\xa3\xb4\xc5\xd6\xe7\xf8\x09\x1a"
+			  "\x2b\x3c\x4d\x5e\x6f\x80\x91\xa2"
+			  "\xb3\xc4\xd5\xe6\xf7\x08\x19\x2a"
+			  "\x3b\x4c\x5d\x6e\x7f\x90\xa1\xb2"
+			  "\xc3\xd4\xe5\xf6\x07\x18\x29\x3a"
+			  "\x4b\x5c\x6d\x7e\x8f\xa0\xb1\xc2"
+			  "\xd3\xe4\xf5\x06\x17\x28\x39\x4a"
+			  "\x5b\x6c\x7d\x8e\x9f\xb0\xc1\xd2"
+			  "\xe3\xf4\x05\x16\x27\x38\x49\x5a"
+			  "\x6b\x7c\x8d\x9e\xaf\xc0\xd1\xe2"
+			  "\xf3\x04\x15\x26\x37\x48\x59\x6a"
+			  "\x7b\x8c\x9d\xae\xbf\xd0\xe1\xf2"
+			  "\x03\x14\x25\x36\x47\x58\x69\x7a"
+			  "\x8b\x9c\xad\xbe\xcf\xe0\xf1\x02"
+			  "\x13\x24\x35\x46\x57\x68\x79\x8a"
+			  "\x9b\xac\xbd\xce\xdf\xf0\x01\x12"
+			  "\x23\x34\x45\x56\x67\x78\x89\x9a"
+			  "\xab\xbc\xcd\xde\xef\x00\x11\x22"
+			  "\x33\x44\x55\x66\x77\x88\x99\xaa"
+			  "\xbb\xcc\xdd\xee\xff\x10\x21\x32"
+			  "\x43\x54\x65\x76\x87\x98\xa9\xba"
+			  "\xcb\xdc\xed\xfe\x0f\x20\x31\x42"
+			  "\x53\x64\x75\x86\x97\xa8\xb9\xca"
+			  "\xdb\xec\xfd\x0e\x1f\x30\x41\x52"
+			  "\x63\x74\x85\x96\xa7\xb8\xc9\xda"
+			  "\xeb\xfc\x0d\x1e\x2f\x40\x51\x62"
+			  "\x73\x84\x95\xa6\xb7\xc8\xd9\xea"
+			  "\xfb\x0c\x1d\x2e\x3f\x50\x61\x72"
+			  "\x83\x94\xa5\xb6\xc7\xd8\xe9\xfa"
+			  "\x0b\x1c\x2d\x3e\x4f\x60\x71\x82"
+			  "\x93\xa4\xb5\xc6\xd7\xe8\xf9\x0a"
+			  "\x1b\x2c\x3d\x4e\x5f\x70\x81\x92"
+			  "\xa3\xb4\xc5\xd6\xe7\xf8\x09\x1a"
+			  "\x2b\x3c\x4d\x5e\x6f\x80\x91\xa2"
+			  "\xb3\xc4\xd5\xe6\xf7\x08\x19\x2a"
+			  "\x3b\x4c\x5d\x6e\x7f\x90\xa1\xb2"
+			  "\xc3\xd4\xe5\xf6\x07\x18\x29\x3a"
+			  "\x4b\x5c\x6d\x7e\x8f\xa0\xb1\xc2"
+			  "\xd3\xe4\xf5\x06\x17\x28\x39\x4a"
+			  "\x5b\x6c\x7d\x8e\x9f\xb0\xc1\xd2"
+			  "\xe3\xf4\x05\x16\x27\x38\x49\x5a"
+			  "\x6b\x7c\x8d\x9e\xaf\xc0\xd1\xe2"
+			  "\xf3\x04\x15\x26\x37\x48\x59\x6a"
+			  "\x7b\x8c\x9d\xae\xbf\xd0\xe1\xf2"
+			  "\x04\x15\x26\x37\x48\x59\x6a\x7b"
+			  "\x8c\x9d\xae\xbf\xd0\xe1\xf2\x03"
+			  "\x14\x25\x36\x47\x58\x69\x7a\x8b"
+			  "\x9c\xad\xbe\xcf\xe0\xf1\x02\x13"
+			  "\x24\x35\x46\x57\x68\x79\x8a\x9b"
+			  "\xac\xbd\xce\xdf\xf0\x01\x12\x23"
+			  "\x34\x45\x56\x67\x78\x89\x9a\xab"
+			  "\xbc\xcd\xde\xef\x00\x11\x22\x33"
+			  "\x44\x55\x66\x77\x88\x99\xaa\xbb"
+			  "\xcc\xdd\xee\xff\x10\x21\x32\x43"
+			  "\x54\x65\x76\x87\x98\xa9\xba\xcb"
+			  "\xdc\xed\xfe\x0f\x20\x31\x42\x53"
+			  "\x64\x75\x86\x97\xa8\xb9\xca\xdb"
+			  "\xec\xfd\x0e\x1f\x30\x41\x52\x63"
+			  "\x74\x85\x96\xa7\xb8\xc9\xda\xeb"
+			  "\xfc\x0d\x1e\x2f\x40\x51\x62\x73"
+			  "\x84\x95\xa6\xb7\xc8\xd9\xea\xfb"
+			  "\x0c\x1d\x2e\x3f\x50\x61\x72\x83"
+			  "\x94\xa5\xb6\xc7\xd8\xe9\xfa\x0b"
+			  "\x1c\x2d\x3e\x4f\x60\x71\x82\x93"
+			  "\xa4\xb5\xc6\xd7\xe8\xf9\x0a\x1b"
+			  "\x2c\x3d\x4e\x5f\x70\x81\x92\xa3"
+			  "\xb4\xc5\xd6\xe7\xf8\x09\x1a\x2b"
+			  "\x3c\x4d\x5e\x6f\x80\x91\xa2\xb3"
+			  "\xc4\xd5\xe6\xf7\x08\x19\x2a\x3b"
+			  "\x4c\x5d\x6e\x7f\x90\xa1\xb2\xc3"
+			  "\xd4\xe5\xf6\x07\x18\x29\x3a\x4b"
+			  "\x5c\x6d\x7e\x8f\xa0\xb1\xc2\xd3"
+			  "\xe4\xf5\x06\x17\x28\x39\x4a\x5b"
+			  "\x6c\x7d\x8e\x9f\xb0\xc1\xd2\xe3"
+			  "\xf4\x05\x16\x27\x38\x49\x5a\x6b"
+			  "\x7c\x8d\x9e\xaf\xc0\xd1\xe2\xf3"
+			  "\x04\x15\x26\x37\x48\x59\x6a\x7b"
+			  "\x8c\x9d\xae\xbf\xd0\xe1\xf2\x03"
+			  "\x14\x25\x36\x47\x58\x69\x7a\x8b"
+			  "\x9c\xad\xbe\xcf\xe0\xf1\x02\x13"
+			  "\x24\x35\x46\x57\x68\x79\x8a\x9b"
+			  "\xac\xbd\xce\xdf\xf0\x01\x12\x23"
+			  "\x34\x45\x56\x67\x78\x89\x9a\xab"
+			  "\xbc\xcd\xde\xef\x00\x11\x22\x33"
+			  "\x44\x55\x66\x77\x88\x99\xaa\xbb"
+			  "\xcc\xdd\xee\xff\x10\x21\x32\x43"
+			  "\x54\x65\x76\x87\x98\xa9\xba\xcb"
+			  "\xdc\xed\xfe\x0f\x20\x31\x42\x53"
+			  "\x64\x75\x86\x97\xa8\xb9\xca\xdb"
+			  "\xec\xfd\x0e\x1f\x30\x41\x52\x63"
+			  "\x74\x85\x96\xa7\xb8\xc9\xda\xeb"
+			  "\xfc\x0d\x1e\x2f\x40\x51\x62\x73"
+			  "\x84\x95\xa6\xb7\xc8\xd9\xea\xfb"
+			  "\x0c\x1d\x2e\x3f\x50\x61\x72\x83"
+			  "\x94\xa5\xb6\xc7\xd8\xe9\xfa\x0b"
+			  "\x1c\x2d\x3e\x4f\x60\x71\x82\x93"
+			  "\xa4\xb5\xc6\xd7\xe8\xf9\x0a\x1b"
+			  "\x2c\x3d\x4e\x5f\x70\x81\x92\xa3"
+			  "\xb4\xc5\xd6\xe7\xf8\x09\x1a\x2b"
+			  "\x3c\x4d\x5e\x6f\x80\x91\xa2\xb3"
+			  "\xc4\xd5\xe6\xf7\x08\x19\x2a\x3b"
+			  "\x4c\x5d\x6e\x7f\x90\xa1\xb2\xc3"
+			  "\xd4\xe5\xf6\x07\x18\x29\x3a\x4b"
+			  "\x5c\x6d\x7e\x8f\xa0\xb1\xc2\xd3"
+			  "\xe4\xf5\x06\x17\x28\x39\x4a\x5b"
+			  "\x6c\x7d\x8e\x9f\xb0\xc1\xd2\xe3"
+			  "\xf4\x05\x16\x27\x38\x49\x5a\x6b"
+			  "\x7c\x8d\x9e\xaf\xc0\xd1\xe2\xf3"
+			  "\x05\x16\x27\x38\x49\x5a\x6b\x7c"
+			  "\x8d\x9e\xaf\xc0\xd1\xe2\xf3\x04"
+			  "\x15\x26\x37\x48\x59\x6a\x7b\x8c"
+			  "\x9d\xae\xbf\xd0\xe1\xf2\x03\x14"
+			  "\x25\x36\x47\x58\x69\x7a\x8b\x9c"
+			  "\xad\xbe\xcf\xe0\xf1\x02\x13\x24"
+			  "\x35\x46\x57\x68\x79\x8a\x9b\xac"
+			  "\xbd\xce\xdf\xf0\x01\x12\x23\x34"
+			  "\x45\x56\x67\x78\x89\x9a\xab\xbc"
+			  "\xcd\xde\xef\x00\x11\x22\x33\x44"
+			  "\x55\x66\x77\x88\x99\xaa\xbb\xcc"
+			  "\xdd\xee\xff\x10\x21\x32\x43\x54"
+			  "\x65\x76\x87\x98\xa9\xba\xcb\xdc"
+			  "\xed\xfe\x0f\x20\x31\x42\x53\x64"
+			  "\x75\x86\x97\xa8\xb9\xca\xdb\xec"
+			  "\xfd\x0e\x1f\x30\x41\x52\x63\x74"
+			  "\x85\x96\xa7\xb8\xc9\xda\xeb\xfc"
+			  "\x0d\x1e\x2f\x40\x51\x62\x73\x84"
+			  "\x95\xa6\xb7\xc8\xd9\xea\xfb\x0c"
+			  "\x1d\x2e\x3f\x50\x61\x72\x83\x94"
+			  "\xa5\xb6\xc7\xd8\xe9\xfa\x0b\x1c"
+			  "\x2d\x3e\x4f\x60\x71\x82\x93\xa4"
+			  "\xb5\xc6\xd7\xe8\xf9\x0a\x1b\x2c"
+			  "\x3d\x4e\x5f\x70\x81\x92\xa3\xb4"
+			  "\xc5\xd6\xe7\xf8\x09\x1a\x2b\x3c"
+			  "\x4d\x5e\x6f\x80\x91\xa2\xb3\xc4"
+			  "\xd5\xe6\xf7\x08\x19\x2a\x3b\x4c"
+			  "\x5d\x6e\x7f\x90\xa1\xb2\xc3\xd4"
+			  "\xe5\xf6\x07\x18\x29\x3a\x4b\x5c"
+			  "\x6d\x7e\x8f\xa0\xb1\xc2\xd3\xe4"
+			  "\xf5\x06\x17\x28\x39\x4a\x5b\x6c"
+			  "\x7d\x8e\x9f\xb0\xc1\xd2\xe3\xf4"
+			  "\x05\x16\x27\x38\x49\x5a\x6b\x7c"
+			  "\x8d\x9e\xaf\xc0\xd1\xe2\xf3\x04"
+			  "\x15\x26\x37\x48\x59\x6a\x7b\x8c"
+			  "\x9d\xae\xbf\xd0\xe1\xf2\x03\x14"
+			  "\x25\x36\x47\x58\x69\x7a\x8b\x9c"
+			  "\xad\xbe\xcf\xe0\xf1\x02\x13\x24"
+			  "\x35\x46\x57\x68\x79\x8a\x9b\xac"
+			  "\xbd\xce\xdf\xf0\x01\x12\x23\x34"
+			  "\x45\x56\x67\x78\x89\x9a\xab\xbc"
+			  "\xcd\xde\xef\x00\x11\x22\x33\x44"
+			  "\x55\x66\x77\x88\x99\xaa\xbb\xcc"
+			  "\xdd\xee\xff\x10\x21\x32\x43\x54"
+			  "\x65\x76\x87\x98\xa9\xba\xcb\xdc"
+			  "\xed\xfe\x0f\x20\x31\x42\x53\x64"
+			  "\x75\x86\x97\xa8\xb9\xca\xdb\xec"
+			  "\xfd\x0e\x1f\x30\x41\x52\x63\x74"
+			  "\x85\x96\xa7\xb8\xc9\xda\xeb\xfc"
+			  "\x0d\x1e\x2f\x40\x51\x62\x73\x84"
+			  "\x95\xa6\xb7\xc8\xd9\xea\xfb\x0c"
+			  "\x1d\x2e\x3f\x50\x61\x72\x83\x94"
+			  "\xa5\xb6\xc7\xd8\xe9\xfa\x0b\x1c"
+			  "\x2d\x3e\x4f\x60\x71\x82\x93\xa4"
+			  "\xb5\xc6\xd7\xe8\xf9\x0a\x1b\x2c"
+			  "\x3d\x4e\x5f\x70\x81\x92\xa3\xb4"
+			  "\xc5\xd6\xe7\xf8\x09\x1a\x2b\x3c"
+			  "\x4d\x5e\x6f\x80\x91\xa2\xb3\xc4"
+			  "\xd5\xe6\xf7\x08\x19\x2a\x3b\x4c"
+			  "\x5d\x6e\x7f\x90\xa1\xb2\xc3\xd4"
+			  "\xe5\xf6\x07\x18\x29\x3a\x4b\x5c"
+			  "\x6d\x7e\x8f\xa0\xb1\xc2\xd3\xe4"
+			  "\xf5\x06\x17\x28\x39\x4a\x5b\x6c"
+			  "\x7d\x8e\x9f\xb0\xc1\xd2\xe3\xf4"
+			  "\x06\x17\x28\x39\x4a\x5b\x6c\x7d"
+			  "\x8e\x9f\xb0\xc1\xd2\xe3\xf4\x05"
+			  "\x16\x27\x38\x49\x5a\x6b\x7c\x8d"
+			  "\x9e\xaf\xc0\xd1\xe2\xf3\x04\x15"
+			  "\x26\x37\x48\x59\x6a\x7b\x8c\x9d"
+			  "\xae\xbf\xd0\xe1\xf2\x03\x14\x25"
+			  "\x36\x47\x58\x69\x7a\x8b\x9c\xad"
+			  "\xbe\xcf\xe0\xf1\x02\x13\x24\x35"
+			  "\x46\x57\x68\x79\x8a\x9b\xac\xbd"
+			  "\xce\xdf\xf0\x01\x12\x23\x34\x45"
+			  "\x56\x67\x78\x89\x9a\xab\xbc\xcd"
+			  "\xde\xef\x00\x11\x22\x33\x44\x55"
+			  "\x66\x77\x88\x99\xaa\xbb\xcc\xdd"
+			  "\xee\xff\x10\x21\x32\x43\x54\x65"
+			  "\x76\x87\x98\xa9\xba\xcb\xdc\xed"
+			  "\xfe\x0f\x20\x31\x42\x53\x64\x75"
+			  "\x86\x97\xa8\xb9\xca\xdb\xec\xfd"
+			  "\x0e\x1f\x30\x41\x52\x63\x74\x85"
+			  "\x96\xa7\xb8\xc9\xda\xeb\xfc\x0d"
+			  "\x1e\x2f\x40\x51\x62\x73\x84\x95"
+			  "\xa6\xb7\xc8\xd9\xea\xfb\x0c\x1d"
+			  "\x2e\x3f\x50\x61\x72\x83\x94\xa5"
+			  "\xb6\xc7\xd8\xe9\xfa\x0b\x1c\x2d"
+			  "\x3e\x4f\x60\x71\x82\x93\xa4\xb5"
+			  "\xc6\xd7\xe8\xf9\x0a\x1b\x2c\x3d"
+			  "\x4e\x5f\x70\x81\x92\xa3\xb4\xc5"
+			  "\xd6\xe7\xf8\x09\x1a\x2b\x3c\x4d"
+			  "\x5e\x6f\x80\x91\xa2\xb3\xc4\xd5"
+			  "\xe6\xf7\x08\x19\x2a\x3b\x4c\x5d"
+			  "\x6e\x7f\x90\xa1\xb2\xc3\xd4\xe5"
+			  "\xf6\x07\x18\x29\x3a\x4b\x5c\x6d"
+			  "\x7e\x8f\xa0\xb1\xc2\xd3\xe4\xf5"
+			  "\x06\x17\x28\x39\x4a\x5b\x6c\x7d"
+			  "\x8e\x9f\xb0\xc1\xd2\xe3\xf4\x05"
+			  "\x16\x27\x38\x49\x5a\x6b\x7c\x8d"
+			  "\x9e\xaf\xc0\xd1\xe2\xf3\x04\x15"
+			  "\x26\x37\x48\x59\x6a\x7b\x8c\x9d"
+			  "\xae\xbf\xd0\xe1\xf2\x03\x14\x25"
+			  "\x36\x47\x58\x69\x7a\x8b\x9c\xad"
+			  "\xbe\xcf\xe0\xf1\x02\x13\x24\x35"
+			  "\x46\x57\x68\x79\x8a\x9b\xac\xbd"
+			  "\xce\xdf\xf0\x01\x12\x23\x34\x45"
+			  "\x56\x67\x78\x89\x9a\xab\xbc\xcd"
+			  "\xde\xef\x00\x11\x22\x33\x44\x55"
+			  "\x66\x77\x88\x99\xaa\xbb\xcc\xdd"
+			  "\xee\xff\x10\x21\x32\x43\x54\x65"
+			  "\x76\x87\x98\xa9\xba\xcb\xdc\xed"
+			  "\xfe\x0f\x20\x31\x42\x53\x64\x75"
+			  "\x86\x97\xa8\xb9\xca\xdb\xec\xfd"
+			  "\x0e\x1f\x30\x41\x52\x63\x74\x85"
+			  "\x96\xa7\xb8\xc9\xda\xeb\xfc\x0d"
+			  "\x1e\x2f\x40\x51\x62\x73\x84\x95"
+			  "\xa6\xb7\xc8\xd9\xea\xfb\x0c\x1d"
+			  "\x2e\x3f\x50\x61\x72\x83\x94\xa5"
+			  "\xb6\xc7\xd8\xe9\xfa\x0b\x1c\x2d"
+			  "\x3e\x4f\x60\x71\x82\x93\xa4\xb5"
+			  "\xc6\xd7\xe8\xf9\x0a\x1b\x2c\x3d"
+			  "\x4e\x5f\x70\x81\x92\xa3\xb4\xc5"
+			  "\xd6\xe7\xf8\x09\x1a\x2b\x3c\x4d"
+			  "\x5e\x6f\x80\x91\xa2\xb3\xc4\xd5"
+			  "\xe6\xf7\x08\x19\x2a\x3b\x4c\x5d"
+			  "\x6e\x7f\x90\xa1\xb2\xc3\xd4\xe5"
+			  "\xf6\x07\x18\x29\x3a\x4b\x5c\x6d"
+			  "\x7e\x8f\xa0\xb1\xc2\xd3\xe4\xf5"
+			  "\x07\x18\x29\x3a\x4b\x5c\x6d\x7e"
+			  "\x8f\xa0\xb1\xc2\xd3\xe4\xf5\x06"
+			  "\x17\x28\x39\x4a\x5b\x6c\x7d\x8e"
+			  "\x9f\xb0\xc1\xd2\xe3\xf4\x05\x16"
+			  "\x27\x38\x49\x5a\x6b\x7c\x8d\x9e"
+			  "\xaf\xc0\xd1\xe2\xf3\x04\x15\x26"
+			  "\x37\x48\x59\x6a\x7b\x8c\x9d\xae"
+			  "\xbf\xd0\xe1\xf2\x03\x14\x25\x36"
+			  "\x47\x58\x69\x7a\x8b\x9c\xad\xbe"
+			  "\xcf\xe0\xf1\x02\x13\x24\x35\x46"
+			  "\x57\x68\x79\x8a\x9b\xac\xbd\xce"
+			  "\xdf\xf0\x01\x12\x23\x34\x45\x56"
+			  "\x67\x78\x89\x9a\xab\xbc\xcd\xde"
+			  "\xef\x00\x11\x22\x33\x44\x55\x66"
+			  "\x77\x88\x99\xaa\xbb\xcc\xdd\xee"
+			  "\xff\x10\x21\x32\x43\x54\x65\x76"
+			  "\x87\x98\xa9\xba\xcb\xdc\xed\xfe"
+			  "\x0f\x20\x31\x42\x53\x64\x75\x86"
+			  "\x97\xa8\xb9\xca\xdb\xec\xfd\x0e"
+			  "\x1f\x30\x41\x52\x63\x74\x85\x96"
+			  "\xa7\xb8\xc9\xda\xeb\xfc\x0d\x1e"
+			  "\x2f\x40\x51\x62\x73\x84\x95\xa6"
+			  "\xb7\xc8\xd9\xea\xfb\x0c\x1d\x2e"
+			  "\x3f\x50\x61\x72\x83\x94\xa5\xb6"
+			  "\xc7\xd8\xe9\xfa\x0b\x1c\x2d\x3e"
+			  "\x4f\x60\x71\x82\x93\xa4\xb5\xc6"
+			  "\xd7\xe8\xf9\x0a\x1b\x2c\x3d\x4e"
+			  "\x5f\x70\x81\x92\xa3\xb4\xc5\xd6"
+			  "\xe7\xf8\x09\x1a\x2b\x3c\x4d\x5e"
+			  "\x6f\x80\x91\xa2\xb3\xc4\xd5\xe6"
+			  "\xf7\x08\x19\x2a\x3b\x4c\x5d\x6e"
+			  "\x7f\x90\xa1\xb2\xc3\xd4\xe5\xf6"
+			  "\x07\x18\x29\x3a\x4b\x5c\x6d\x7e"
+			  "\x8f\xa0\xb1\xc2\xd3\xe4\xf5\x06"
+			  "\x17\x28\x39\x4a\x5b\x6c\x7d\x8e"
+			  "\x9f\xb0\xc1\xd2\xe3\xf4\x05\x16"
+			  "\x27\x38\x49\x5a\x6b\x7c\x8d\x9e"
+			  "\xaf\xc0\xd1\xe2\xf3\x04\x15\x26"
+			  "\x37\x48\x59\x6a\x7b\x8c\x9d\xae"
+			  "\xbf\xd0\xe1\xf2\x03\x14\x25\x36"
+			  "\x47\x58\x69\x7a\x8b\x9c\xad\xbe"
+			  "\xcf\xe0\xf1\x02\x13\x24\x35\x46"
+			  "\x57\x68\x79\x8a\x9b\xac\xbd\xce"
+			  "\xdf\xf0\x01\x12\x23\x34\x45\x56"
+			  "\x67\x78\x89\x9a\xab\xbc\xcd\xde"
+			  "\xef\x00\x11\x22\x33\x44\x55\x66"
+			  "\x77\x88\x99\xaa\xbb\xcc\xdd\xee"
+			  "\xff\x10\x21\x32\x43\x54\x65\x76"
+			  "\x87\x98\xa9\xba\xcb\xdc\xed\xfe"
+			  "\x0f\x20\x31\x42\x53\x64\x75\x86"
+			  "\x97\xa8\xb9\xca\xdb\xec\xfd\x0e"
+			  "\x1f\x30\x41\x52\x63\x74\x85\x96"
+			  "\xa7\xb8\xc9\xda\xeb\xfc\x0d\x1e"
+			  "\x2f\x40\x51\x62\x73\x84\x95\xa6"
+			  "\xb7\xc8\xd9\xea\xfb\x0c\x1d\x2e"
+			  "\x3f\x50\x61\x72\x83\x94\xa5\xb6"
+			  "\xc7\xd8\xe9\xfa\x0b\x1c\x2d\x3e"
+			  "\x4f\x60\x71\x82\x93\xa4\xb5\xc6"
+			  "\xd7\xe8\xf9\x0a\x1b\x2c\x3d\x4e"
+			  "\x5f\x70\x81\x92\xa3\xb4\xc5\xd6"
+			  "\xe7\xf8\x09\x1a\x2b\x3c\x4d\x5e"
+			  "\x6f\x80\x91\xa2\xb3\xc4\xd5\xe6"
+			  "\xf7\x08\x19\x2a\x3b\x4c\x5d\x6e"
+			  "\x7f\x90\xa1\xb2\xc3\xd4\xe5\xf6"
+			  "\x08\x19\x2a\x3b\x4c\x5d\x6e\x7f"
+			  "\x90\xa1\xb2\xc3\xd4\xe5\xf6\x07"
+			  "\x18\x29\x3a\x4b\x5c\x6d\x7e\x8f"
+			  "\xa0\xb1\xc2\xd3\xe4\xf5\x06\x17"
+			  "\x28\x39\x4a\x5b\x6c\x7d\x8e\x9f"
+			  "\xb0\xc1\xd2\xe3\xf4\x05\x16\x27"
+			  "\x38\x49\x5a\x6b\x7c\x8d\x9e\xaf"
+			  "\xc0\xd1\xe2\xf3\x04\x15\x26\x37"
+			  "\x48\x59\x6a\x7b\x8c\x9d\xae\xbf"
+			  "\xd0\xe1\xf2\x03\x14\x25\x36\x47"
+			  "\x58\x69\x7a\x8b\x9c\xad\xbe\xcf"
+			  "\xe0\xf1\x02\x13\x24\x35\x46\x57"
+			  "\x68\x79\x8a\x9b\xac\xbd\xce\xdf"
+			  "\xf0\x01\x12\x23\x34\x45\x56\x67"
+			  "\x78\x89\x9a\xab\xbc\xcd\xde\xef"
+			  "\x00\x11\x22\x33\x44\x55\x66\x77"
+			  "\x88\x99\xaa\xbb\xcc\xdd\xee\xff"
+			  "\x10\x21\x32\x43\x54\x65\x76\x87"
+			  "\x98\xa9\xba\xcb\xdc\xed\xfe\x0f"
+			  "\x20\x31\x42\x53\x64\x75\x86\x97"
+			  "\xa8\xb9\xca\xdb\xec\xfd\x0e\x1f"
+			  "\x30\x41\x52\x63\x74\x85\x96\xa7"
+			  "\xb8\xc9\xda\xeb\xfc\x0d\x1e\x2f"
+			  "\x40\x51\x62\x73\x84\x95\xa6\xb7"
+			  "\xc8\xd9\xea\xfb\x0c\x1d\x2e\x3f"
+			  "\x50\x61\x72\x83\x94\xa5\xb6\xc7"
+			  "\xd8\xe9\xfa\x0b\x1c\x2d\x3e\x4f"
+			  "\x60\x71\x82\x93\xa4\xb5\xc6\xd7"
+			  "\xe8\xf9\x0a\x1b\x2c\x3d\x4e\x5f"
+			  "\x70\x81\x92\xa3\xb4\xc5\xd6\xe7"
+			  "\xf8\x09\x1a\x2b\x3c\x4d\x5e\x6f"
+			  "\x80\x91\xa2\xb3\xc4\xd5\xe6\xf7"
+			  "\x08\x19\x2a\x3b\x4c\x5d\x6e\x7f"
+			  "\x90\xa1\xb2\xc3\xd4\xe5\xf6\x07"
+			  "\x18\x29\x3a\x4b\x5c\x6d\x7e\x8f"
+			  "\xa0\xb1\xc2\xd3\xe4\xf5\x06\x17"
+			  "\x28\x39\x4a\x5b\x6c\x7d\x8e\x9f"
+			  "\xb0\xc1\xd2\xe3\xf4\x05\x16\x27"
+			  "\x38\x49\x5a\x6b\x7c\x8d\x9e\xaf"
+			  "\xc0\xd1\xe2\xf3\x04\x15\x26\x37"
+			  "\x48\x59\x6a\x7b\x8c\x9d\xae\xbf"
+			  "\xd0\xe1\xf2\x03\x14\x25\x36\x47"
+			  "\x58\x69\x7a\x8b\x9c\xad\xbe\xcf"
+			  "\xe0\xf1\x02\x13\x24\x35\x46\x57"
+			  "\x68\x79\x8a\x9b\xac\xbd\xce\xdf"
+			  "\xf0\x01\x12\x23\x34\x45\x56\x67"
+			  "\x78\x89\x9a\xab\xbc\xcd\xde\xef"
+			  "\x00\x11\x22\x33\x44\x55\x66\x77"
+			  "\x88\x99\xaa\xbb\xcc\xdd\xee\xff"
+			  "\x10\x21\x32\x43\x54\x65\x76\x87"
+			  "\x98\xa9\xba\xcb\xdc\xed\xfe\x0f"
+			  "\x20\x31\x42\x53\x64\x75\x86\x97"
+			  "\xa8\xb9\xca\xdb\xec\xfd\x0e\x1f"
+			  "\x30\x41\x52\x63\x74\x85\x96\xa7"
+			  "\xb8\xc9\xda\xeb\xfc\x0d\x1e\x2f"
+			  "\x40\x51\x62\x73\x84\x95\xa6\xb7"
+			  "\xc8\xd9\xea\xfb\x0c\x1d\x2e\x3f"
+			  "\x50\x61\x72\x83\x94\xa5\xb6\xc7"
+			  "\xd8\xe9\xfa\x0b\x1c\x2d\x3e\x4f"
+			  "\x60\x71\x82\x93\xa4\xb5\xc6\xd7"
+			  "\xe8\xf9\x0a\x1b\x2c\x3d\x4e\x5f"
+			  "\x70\x81\x92\xa3\xb4\xc5\xd6\xe7"
+			  "\xf8\x09\x1a\x2b\x3c\x4d\x5e\x6f"
+			  "\x80\x91\xa2\xb3\xc4\xd5\xe6\xf7"
+			  "\x09\x1a\x2b\x3c\x4d\x5e\x6f\x80"
+			  "\x91\xa2\xb3\xc4\xd5\xe6\xf7\x08"
+			  "\x19\x2a\x3b\x4c\x5d\x6e\x7f\x90"
+			  "\xa1\xb2\xc3\xd4\xe5\xf6\x07\x18"
+			  "\x29\x3a\x4b\x5c\x6d\x7e\x8f\xa0"
+			  "\xb1\xc2\xd3\xe4\xf5\x06\x17\x28"
+			  "\x39\x4a\x5b\x6c\x7d\x8e\x9f\xb0"
+			  "\xc1\xd2\xe3\xf4\x05\x16\x27\x38"
+			  "\x49\x5a\x6b\x7c\x8d\x9e\xaf\xc0"
+			  "\xd1\xe2\xf3\x04\x15\x26\x37\x48"
+			  "\x59\x6a\x7b\x8c\x9d\xae\xbf\xd0"
+			  "\xe1\xf2\x03\x14\x25\x36\x47\x58"
+			  "\x69\x7a\x8b\x9c\xad\xbe\xcf\xe0"
+			  "\xf1\x02\x13\x24\x35\x46\x57\x68"
+			  "\x79\x8a\x9b\xac\xbd\xce\xdf\xf0"
+			  "\x01\x12\x23\x34\x45\x56\x67\x78"
+			  "\x89\x9a\xab\xbc\xcd\xde\xef\x00"
+			  "\x11\x22\x33\x44\x55\x66\x77\x88"
+			  "\x99\xaa\xbb\xcc\xdd\xee\xff\x10"
+			  "\x21\x32\x43\x54\x65\x76\x87\x98"
+			  "\xa9\xba\xcb\xdc\xed\xfe\x0f\x20"
+			  "\x31\x42\x53\x64\x75\x86\x97\xa8"
+			  "\xb9\xca\xdb\xec\xfd\x0e\x1f\x30"
+			  "\x41\x52\x63\x74\x85\x96\xa7\xb8"
+			  "\xc9\xda\xeb\xfc\x0d\x1e\x2f\x40"
+			  "\x51\x62\x73\x84\x95\xa6\xb7\xc8"
+			  "\xd9\xea\xfb\x0c\x1d\x2e\x3f\x50"
+			  "\x61\x72\x83\x94\xa5\xb6\xc7\xd8"
+			  "\xe9\xfa\x0b\x1c\x2d\x3e\x4f\x60"
+			  "\x71\x82\x93\xa4\xb5\xc6\xd7\xe8"
+			  "\xf9\x0a\x1b\x2c\x3d\x4e\x5f\x70"
+			  "\x81\x92\xa3\xb4\xc5\xd6\xe7\xf8"
+			  "\x09\x1a\x2b\x3c\x4d\x5e\x6f\x80"
+			  "\x91\xa2\xb3\xc4\xd5\xe6\xf7\x08"
+			  "\x19\x2a\x3b\x4c\x5d\x6e\x7f\x90"
+			  "\xa1\xb2\xc3\xd4\xe5\xf6\x07\x18"
+			  "\x29\x3a\x4b\x5c\x6d\x7e\x8f\xa0"
+			  "\xb1\xc2\xd3\xe4\xf5\x06\x17\x28"
+			  "\x39\x4a\x5b\x6c\x7d\x8e\x9f\xb0"
+			  "\xc1\xd2\xe3\xf4\x05\x16\x27\x38"
+			  "\x49\x5a\x6b\x7c\x8d\x9e\xaf\xc0"
+			  "\xd1\xe2\xf3\x04\x15\x26\x37\x48"
+			  "\x59\x6a\x7b\x8c\x9d\xae\xbf\xd0"
+			  "\xe1\xf2\x03\x14\x25\x36\x47\x58"
+			  "\x69\x7a\x8b\x9c\xad\xbe\xcf\xe0"
+			  "\xf1\x02\x13\x24\x35\x46\x57\x68"
+			  "\x79\x8a\x9b\xac\xbd\xce\xdf\xf0"
+			  "\x01\x12\x23\x34\x45\x56\x67\x78"
+			  "\x89\x9a\xab\xbc\xcd\xde\xef\x00"
+			  "\x11\x22\x33\x44\x55\x66\x77\x88"
+			  "\x99\xaa\xbb\xcc\xdd\xee\xff\x10"
+			  "\x21\x32\x43\x54\x65\x76\x87\x98"
+			  "\xa9\xba\xcb\xdc\xed\xfe\x0f\x20"
+			  "\x31\x42\x53\x64\x75\x86\x97\xa8"
+			  "\xb9\xca\xdb\xec\xfd\x0e\x1f\x30"
+			  "\x41\x52\x63\x74\x85\x96\xa7\xb8"
+			  "\xc9\xda\xeb\xfc\x0d\x1e\x2f\x40"
+			  "\x51\x62\x73\x84\x95\xa6\xb7\xc8"
+			  "\xd9\xea\xfb\x0c\x1d\x2e\x3f\x50"
+			  "\x61\x72\x83\x94\xa5\xb6\xc7\xd8"
+			  "\xe9\xfa\x0b\x1c\x2d\x3e\x4f\x60"
+			  "\x71\x82\x93\xa4\xb5\xc6\xd7\xe8"
+			  "\xf9\x0a\x1b\x2c\x3d\x4e\x5f\x70"
+			  "\x81\x92\xa3\xb4\xc5\xd6\xe7\xf8"
+			  "\x0a\x1b\x2c\x3d\x4e\x5f\x70\x81"
+			  "\x92\xa3\xb4\xc5\xd6\xe7\xf8\x09"
+			  "\x1a\x2b\x3c\x4d\x5e\x6f\x80\x91"
+			  "\xa2\xb3\xc4\xd5\xe6\xf7\x08\x19"
+			  "\x2a\x3b\x4c\x5d\x6e\x7f\x90\xa1"
+			  "\xb2\xc3\xd4\xe5\xf6\x07\x18\x29"
+			  "\x3a\x4b\x5c\x6d\x7e\x8f\xa0\xb1"
+			  "\xc2\xd3\xe4\xf5\x06\x17\x28\x39"
+			  "\x4a\x5b\x6c\x7d\x8e\x9f\xb0\xc1"
+			  "\xd2\xe3\xf4\x05\x16\x27\x38\x49"
+			  "\x5a\x6b\x7c\x8d\x9e\xaf\xc0\xd1"
+			  "\xe2\xf3\x04\x15\x26\x37\x48\x59"
+			  "\x6a\x7b\x8c\x9d\xae\xbf\xd0\xe1"
+			  "\xf2\x03\x14\x25\x36\x47\x58\x69"
+			  "\x7a\x8b\x9c\xad\xbe\xcf\xe0\xf1"
+			  "\x02\x13\x24\x35\x46\x57\x68\x79"
+			  "\x8a\x9b\xac\xbd\xce\xdf\xf0\x01"
+			  "\x12\x23\x34\x45\x56\x67\x78\x89"
+			  "\x9a\xab\xbc\xcd\xde\xef\x00\x11"
+			  "\x22\x33\x44\x55\x66\x77\x88\x99"
+			  "\xaa\xbb\xcc\xdd\xee\xff\x10\x21"
+			  "\x32\x43\x54\x65\x76\x87\x98\xa9"
+			  "\xba\xcb\xdc\xed\xfe\x0f\x20\x31"
+			  "\x42\x53\x64\x75\x86\x97\xa8\xb9"
+			  "\xca\xdb\xec\xfd\x0e\x1f\x30\x41"
+			  "\x52\x63\x74\x85\x96\xa7\xb8\xc9"
+			  "\xda\xeb\xfc\x0d\x1e\x2f\x40\x51"
+			  "\x62\x73\x84\x95\xa6\xb7\xc8\xd9"
+			  "\xea\xfb\x0c\x1d\x2e\x3f\x50\x61"
+			  "\x72\x83\x94\xa5\xb6\xc7\xd8\xe9"
+			  "\xfa\x0b\x1c\x2d\x3e\x4f\x60\x71"
+			  "\x82\x93\xa4\xb5\xc6\xd7\xe8\xf9"
+			  "\x0a\x1b\x2c\x3d\x4e\x5f\x70\x81"
+			  "\x92\xa3\xb4\xc5\xd6\xe7\xf8\x09"
+			  "\x1a\x2b\x3c\x4d\x5e\x6f\x80\x91"
+			  "\xa2\xb3\xc4\xd5\xe6\xf7\x08\x19"
+			  "\x2a\x3b\x4c\x5d\x6e\x7f\x90\xa1"
+			  "\xb2\xc3\xd4\xe5\xf6\x07\x18\x29"
+			  "\x3a\x4b\x5c\x6d\x7e\x8f\xa0\xb1"
+			  "\xc2\xd3\xe4\xf5\x06\x17\x28\x39"
+			  "\x4a\x5b\x6c\x7d\x8e\x9f\xb0\xc1"
+			  "\xd2\xe3\xf4\x05\x16\x27\x38\x49"
+			  "\x5a\x6b\x7c\x8d\x9e\xaf\xc0\xd1"
+			  "\xe2\xf3\x04\x15\x26\x37\x48\x59"
+			  "\x6a\x7b\x8c\x9d\xae\xbf\xd0\xe1"
+			  "\xf2\x03\x14\x25\x36\x47\x58\x69"
+			  "\x7a\x8b\x9c\xad\xbe\xcf\xe0\xf1"
+			  "\x02\x13\x24\x35\x46\x57\x68\x79"
+			  "\x8a\x9b\xac\xbd\xce\xdf\xf0\x01"
+			  "\x12\x23\x34\x45\x56\x67\x78\x89"
+			  "\x9a\xab\xbc\xcd\xde\xef\x00\x11"
+			  "\x22\x33\x44\x55\x66\x77\x88\x99"
+			  "\xaa\xbb\xcc\xdd\xee\xff\x10\x21"
+			  "\x32\x43\x54\x65\x76\x87\x98\xa9"
+			  "\xba\xcb\xdc\xed\xfe\x0f\x20\x31"
+			  "\x42\x53\x64\x75\x86\x97\xa8\xb9"
+			  "\xca\xdb\xec\xfd\x0e\x1f\x30\x41"
+			  "\x52\x63\x74\x85\x96\xa7\xb8\xc9"
+			  "\xda\xeb\xfc\x0d\x1e\x2f\x40\x51"
+			  "\x62\x73\x84\x95\xa6\xb7\xc8\xd9"
+			  "\xea\xfb\x0c\x1d\x2e\x3f\x50\x61"
+			  "\x72\x83\x94\xa5\xb6\xc7\xd8\xe9"
+			  "\xfa\x0b\x1c\x2d\x3e\x4f\x60\x71"
+			  "\x82\x93\xa4\xb5\xc6\xd7\xe8\xf9"
+			  "\x0b\x1c\x2d\x3e\x4f\x60\x71\x82"
+			  "\x93\xa4\xb5\xc6\xd7\xe8\xf9\x0a"
+			  "\x1b\x2c\x3d\x4e\x5f\x70\x81\x92"
+			  "\xa3\xb4\xc5\xd6\xe7\xf8\x09\x1a"
+			  "\x2b\x3c\x4d\x5e\x6f\x80\x91\xa2"
+			  "\xb3\xc4\xd5\xe6\xf7\x08\x19\x2a"
+			  "\x3b\x4c\x5d\x6e\x7f\x90\xa1\xb2"
+			  "\xc3\xd4\xe5\xf6\x07\x18\x29\x3a"
+			  "\x4b\x5c\x6d\x7e\x8f\xa0\xb1\xc2"
+			  "\xd3\xe4\xf5\x06\x17\x28\x39\x4a"
+			  "\x5b\x6c\x7d\x8e\x9f\xb0\xc1\xd2"
+			  "\xe3\xf4\x05\x16\x27\x38\x49\x5a"
+			  "\x6b\x7c\x8d\x9e\xaf\xc0\xd1\xe2"
+			  "\xf3\x04\x15\x26\x37\x48\x59\x6a"
+			  "\x7b\x8c\x9d\xae\xbf\xd0\xe1\xf2"
+			  "\x03\x14\x25\x36\x47\x58\x69\x7a"
+			  "\x8b\x9c\xad\xbe\xcf\xe0\xf1\x02"
+			  "\x13\x24\x35\x46\x57\x68\x79\x8a"
+			  "\x9b\xac\xbd\xce\xdf\xf0\x01\x12"
+			  "\x23\x34\x45\x56\x67\x78\x89\x9a"
+			  "\xab\xbc\xcd\xde\xef\x00\x11\x22"
+			  "\x33\x44\x55\x66\x77\x88\x99\xaa"
+			  "\xbb\xcc\xdd\xee\xff\x10\x21\x32"
+			  "\x43\x54\x65\x76\x87\x98\xa9\xba"
+			  "\xcb\xdc\xed\xfe\x0f\x20\x31\x42"
+			  "\x53\x64\x75\x86\x97\xa8\xb9\xca"
+			  "\xdb\xec\xfd\x0e\x1f\x30\x41\x52"
+			  "\x63\x74\x85\x96\xa7\xb8\xc9\xda"
+			  "\xeb\xfc\x0d\x1e\x2f\x40\x51\x62"
+			  "\x73\x84\x95\xa6\xb7\xc8\xd9\xea"
+			  "\xfb\x0c\x1d\x2e\x3f\x50\x61\x72"
+			  "\x83\x94\xa5\xb6\xc7\xd8\xe9\xfa"
+			  "\x0b\x1c\x2d\x3e\x4f\x60\x71\x82"
+			  "\x93\xa4\xb5\xc6\xd7\xe8\xf9\x0a"
+			  "\x1b\x2c\x3d\x4e\x5f\x70\x81\x92"
+			  "\xa3\xb4\xc5\xd6\xe7\xf8\x09\x1a"
+			  "\x2b\x3c\x4d\x5e\x6f\x80\x91\xa2"
+			  "\xb3\xc4\xd5\xe6\xf7\x08\x19\x2a"
+			  "\x3b\x4c\x5d\x6e\x7f\x90\xa1\xb2"
+			  "\xc3\xd4\xe5\xf6\x07\x18\x29\x3a"
+			  "\x4b\x5c\x6d\x7e\x8f\xa0\xb1\xc2"
+			  "\xd3\xe4\xf5\x06\x17\x28\x39\x4a"
+			  "\x5b\x6c\x7d\x8e\x9f\xb0\xc1\xd2"
+			  "\xe3\xf4\x05\x16\x27\x38\x49\x5a"
+			  "\x6b\x7c\x8d\x9e\xaf\xc0\xd1\xe2"
+			  "\xf3\x04\x15\x26\x37\x48\x59\x6a"
+			  "\x7b\x8c\x9d\xae\xbf\xd0\xe1\xf2"
+			  "\x03\x14\x25\x36\x47\x58\x69\x7a"
+			  "\x8b\x9c\xad\xbe\xcf\xe0\xf1\x02"
+			  "\x13\x24\x35\x46\x57\x68\x79\x8a"
+			  "\x9b\xac\xbd\xce\xdf\xf0\x01\x12"
+			  "\x23\x34\x45\x56\x67\x78\x89\x9a"
+			  "\xab\xbc\xcd\xde\xef\x00\x11\x22"
+			  "\x33\x44\x55\x66\x77\x88\x99\xaa"
+			  "\xbb\xcc\xdd\xee\xff\x10\x21\x32"
+			  "\x43\x54\x65\x76\x87\x98\xa9\xba"
+			  "\xcb\xdc\xed\xfe\x0f\x20\x31\x42"
+			  "\x53\x64\x75\x86\x97\xa8\xb9\xca"
+			  "\xdb\xec\xfd\x0e\x1f\x30\x41\x52"
+			  "\x63\x74\x85\x96\xa7\xb8\xc9\xda"
+			  "\xeb\xfc\x0d\x1e\x2f\x40\x51\x62"
+			  "\x73\x84\x95\xa6\xb7\xc8\xd9\xea"
+			  "\xfb\x0c\x1d\x2e\x3f\x50\x61\x72"
+			  "\x83\x94\xa5\xb6\xc7\xd8\xe9\xfa"
+			  "\x0c\x1d\x2e\x3f\x50\x61\x72\x83"
+			  "\x94\xa5\xb6\xc7\xd8\xe9\xfa\x0b"
+			  "\x1c\x2d\x3e\x4f\x60\x71\x82\x93"
+			  "\xa4\xb5\xc6\xd7\xe8\xf9\x0a\x1b"
+			  "\x2c\x3d\x4e\x5f\x70\x81\x92\xa3"
+			  "\xb4\xc5\xd6\xe7\xf8\x09\x1a\x2b"
+			  "\x3c\x4d\x5e\x6f\x80\x91\xa2\xb3"
+			  "\xc4\xd5\xe6\xf7\x08\x19\x2a\x3b"
+			  "\x4c\x5d\x6e\x7f\x90\xa1\xb2\xc3"
+			  "\xd4\xe5\xf6\x07\x18\x29\x3a\x4b"
+			  "\x5c\x6d\x7e\x8f\xa0\xb1\xc2\xd3"
+			  "\xe4\xf5\x06\x17\x28\x39\x4a\x5b"
+			  "\x6c\x7d\x8e\x9f\xb0\xc1\xd2\xe3"
+			  "\xf4\x05\x16\x27\x38\x49\x5a\x6b"
+			  "\x7c\x8d\x9e\xaf\xc0\xd1\xe2\xf3"
+			  "\x04\x15\x26\x37\x48\x59\x6a\x7b"
+			  "\x8c\x9d\xae\xbf\xd0\xe1\xf2\x03"
+			  "\x14\x25\x36\x47\x58\x69\x7a\x8b"
+			  "\x9c\xad\xbe\xcf\xe0\xf1\x02\x13"
+			  "\x24\x35\x46\x57\x68\x79\x8a\x9b"
+			  "\xac\xbd\xce\xdf\xf0\x01\x12\x23"
+			  "\x34\x45\x56\x67\x78\x89\x9a\xab"
+			  "\xbc\xcd\xde\xef\x00\x11\x22\x33"
+			  "\x44\x55\x66\x77\x88\x99\xaa\xbb"
+			  "\xcc\xdd\xee\xff\x10\x21\x32\x43"
+			  "\x54\x65\x76\x87\x98\xa9\xba\xcb"
+			  "\xdc\xed\xfe\x0f\x20\x31\x42\x53"
+			  "\x64\x75\x86\x97\xa8\xb9\xca\xdb"
+			  "\xec\xfd\x0e\x1f\x30\x41\x52\x63"
+			  "\x74\x85\x96\xa7\xb8\xc9\xda\xeb"
+			  "\xfc\x0d\x1e\x2f\x40\x51\x62\x73"
+			  "\x84\x95\xa6\xb7\xc8\xd9\xea\xfb"
+			  "\x0c\x1d\x2e\x3f\x50\x61\x72\x83"
+			  "\x94\xa5\xb6\xc7\xd8\xe9\xfa\x0b"
+			  "\x1c\x2d\x3e\x4f\x60\x71\x82\x93"
+			  "\xa4\xb5\xc6\xd7\xe8\xf9\x0a\x1b"
+			  "\x2c\x3d\x4e\x5f\x70\x81\x92\xa3"
+			  "\xb4\xc5\xd6\xe7\xf8\x09\x1a\x2b"
+			  "\x3c\x4d\x5e\x6f\x80\x91\xa2\xb3"
+			  "\xc4\xd5\xe6\xf7\x08\x19\x2a\x3b"
+			  "\x4c\x5d\x6e\x7f\x90\xa1\xb2\xc3"
+			  "\xd4\xe5\xf6\x07\x18\x29\x3a\x4b"
+			  "\x5c\x6d\x7e\x8f\xa0\xb1\xc2\xd3"
+			  "\xe4\xf5\x06\x17\x28\x39\x4a\x5b"
+			  "\x6c\x7d\x8e\x9f\xb0\xc1\xd2\xe3"
+			  "\xf4\x05\x16\x27\x38\x49\x5a\x6b"
+			  "\x7c\x8d\x9e\xaf\xc0\xd1\xe2\xf3"
+			  "\x04\x15\x26\x37\x48\x59\x6a\x7b"
+			  "\x8c\x9d\xae\xbf\xd0\xe1\xf2\x03"
+			  "\x14\x25\x36\x47\x58\x69\x7a\x8b"
+			  "\x9c\xad\xbe\xcf\xe0\xf1\x02\x13"
+			  "\x24\x35\x46\x57\x68\x79\x8a\x9b"
+			  "\xac\xbd\xce\xdf\xf0\x01\x12\x23"
+			  "\x34\x45\x56\x67\x78\x89\x9a\xab"
+			  "\xbc\xcd\xde\xef\x00\x11\x22\x33"
+			  "\x44\x55\x66\x77\x88\x99\xaa\xbb"
+			  "\xcc\xdd\xee\xff\x10\x21\x32\x43"
+			  "\x54\x65\x76\x87\x98\xa9\xba\xcb"
+			  "\xdc\xed\xfe\x0f\x20\x31\x42\x53"
+			  "\x64\x75\x86\x97\xa8\xb9\xca\xdb"
+			  "\xec\xfd\x0e\x1f\x30\x41\x52\x63"
+			  "\x74\x85\x96\xa7\xb8\xc9\xda\xeb"
+			  "\xfc\x0d\x1e\x2f\x40\x51\x62\x73"
+			  "\x84\x95\xa6\xb7\xc8\xd9\xea\xfb"
+			  "\x0d\x1e\x2f\x40\x51\x62\x73\x84"
+			  "\x95\xa6\xb7\xc8\xd9\xea\xfb\x0c"
+			  "\x1d\x2e\x3f\x50\x61\x72\x83\x94"
+			  "\xa5\xb6\xc7\xd8\xe9\xfa\x0b\x1c"
+			  "\x2d\x3e\x4f\x60\x71\x82\x93\xa4"
+			  "\xb5\xc6\xd7\xe8\xf9\x0a\x1b\x2c"
+			  "\x3d\x4e\x5f\x70\x81\x92\xa3\xb4"
+			  "\xc5\xd6\xe7\xf8\x09\x1a\x2b\x3c"
+			  "\x4d\x5e\x6f\x80\x91\xa2\xb3\xc4"
+			  "\xd5\xe6\xf7\x08\x19\x2a\x3b\x4c"
+			  "\x5d\x6e\x7f\x90\xa1\xb2\xc3\xd4"
+			  "\xe5\xf6\x07\x18\x29\x3a\x4b\x5c"
+			  "\x6d\x7e\x8f\xa0\xb1\xc2\xd3\xe4"
+			  "\xf5\x06\x17\x28\x39\x4a\x5b\x6c"
+			  "\x7d\x8e\x9f\xb0\xc1\xd2\xe3\xf4"
+			  "\x05\x16\x27\x38\x49\x5a\x6b\x7c"
+			  "\x8d\x9e\xaf\xc0\xd1\xe2\xf3\x04"
+			  "\x15\x26\x37\x48\x59\x6a\x7b\x8c"
+			  "\x9d\xae\xbf\xd0\xe1\xf2\x03\x14"
+			  "\x25\x36\x47\x58\x69\x7a\x8b\x9c"
+			  "\xad\xbe\xcf\xe0\xf1\x02\x13\x24"
+			  "\x35\x46\x57\x68\x79\x8a\x9b\xac"
+			  "\xbd\xce\xdf\xf0\x01\x12\x23\x34"
+			  "\x45\x56\x67\x78\x89\x9a\xab\xbc"
+			  "\xcd\xde\xef\x00\x11\x22\x33\x44"
+			  "\x55\x66\x77\x88\x99\xaa\xbb\xcc"
+			  "\xdd\xee\xff\x10\x21\x32\x43\x54"
+			  "\x65\x76\x87\x98\xa9\xba\xcb\xdc"
+			  "\xed\xfe\x0f\x20\x31\x42\x53\x64"
+			  "\x75\x86\x97\xa8\xb9\xca\xdb\xec"
+			  "\xfd\x0e\x1f\x30\x41\x52\x63\x74"
+			  "\x85\x96\xa7\xb8\xc9\xda\xeb\xfc"
+			  "\x0d\x1e\x2f\x40\x51\x62\x73\x84"
+			  "\x95\xa6\xb7\xc8\xd9\xea\xfb\x0c"
+			  "\x1d\x2e\x3f\x50\x61\x72\x83\x94"
+			  "\xa5\xb6\xc7\xd8\xe9\xfa\x0b\x1c"
+			  "\x2d\x3e\x4f\x60\x71\x82\x93\xa4"
+			  "\xb5\xc6\xd7\xe8\xf9\x0a\x1b\x2c"
+			  "\x3d\x4e\x5f\x70\x81\x92\xa3\xb4"
+			  "\xc5\xd6\xe7\xf8\x09\x1a\x2b\x3c"
+			  "\x4d\x5e\x6f\x80\x91\xa2\xb3\xc4"
+			  "\xd5\xe6\xf7\x08\x19\x2a\x3b\x4c"
+			  "\x5d\x6e\x7f\x90\xa1\xb2\xc3\xd4"
+			  "\xe5\xf6\x07\x18\x29\x3a\x4b\x5c"
+			  "\x6d\x7e\x8f\xa0\xb1\xc2\xd3\xe4"
+			  "\xf5\x06\x17\x28\x39\x4a\x5b\x6c"
+			  "\x7d\x8e\x9f\xb0\xc1\xd2\xe3\xf4"
+			  "\x05\x16\x27\x38\x49\x5a\x6b\x7c"
+			  "\x8d\x9e\xaf\xc0\xd1\xe2\xf3\x04"
+			  "\x15\x26\x37\x48\x59\x6a\x7b\x8c"
+			  "\x9d\xae\xbf\xd0\xe1\xf2\x03\x14"
+			  "\x25\x36\x47\x58\x69\x7a\x8b\x9c"
+			  "\xad\xbe\xcf\xe0\xf1\x02\x13\x24"
+			  "\x35\x46\x57\x68\x79\x8a\x9b\xac"
+			  "\xbd\xce\xdf\xf0\x01\x12\x23\x34"
+			  "\x45\x56\x67\x78\x89\x9a\xab\xbc"
+			  "\xcd\xde\xef\x00\x11\x22\x33\x44"
+			  "\x55\x66\x77\x88\x99\xaa\xbb\xcc"
+			  "\xdd\xee\xff\x10\x21\x32\x43\x54"
+			  "\x65\x76\x87\x98\xa9\xba\xcb\xdc"
+			  "\xed\xfe\x0f\x20\x31\x42\x53\x64"
+			  "\x75\x86\x97\xa8\xb9\xca\xdb\xec"
+			  "\xfd\x0e\x1f\x30\x41\x52\x63\x74"
+			  "\x85\x96\xa7\xb8\xc9\xda\xeb\xfc"
+			  "\x0e\x1f\x30\x41\x52\x63\x74\x85"
+			  "\x96\xa7\xb8\xc9\xda\xeb\xfc\x0d"
+			  "\x1e\x2f\x40\x51\x62\x73\x84\x95"
+			  "\xa6\xb7\xc8\xd9\xea\xfb\x0c\x1d"
+			  "\x2e\x3f\x50\x61\x72\x83\x94\xa5"
+			  "\xb6\xc7\xd8\xe9\xfa\x0b\x1c\x2d"
+			  "\x3e\x4f\x60\x71\x82\x93\xa4\xb5"
+			  "\xc6\xd7\xe8\xf9\x0a\x1b\x2c\x3d"
+			  "\x4e\x5f\x70\x81\x92\xa3\xb4\xc5"
+			  "\xd6\xe7\xf8\x09\x1a\x2b\x3c\x4d"
+			  "\x5e\x6f\x80\x91\xa2\xb3\xc4\xd5"
+			  "\xe6\xf7\x08\x19\x2a\x3b\x4c\x5d"
+			  "\x6e\x7f\x90\xa1\xb2\xc3\xd4\xe5"
+			  "\xf6\x07\x18\x29\x3a\x4b\x5c\x6d"
+			  "\x7e\x8f\xa0\xb1\xc2\xd3\xe4\xf5"
+			  "\x06\x17\x28\x39\x4a\x5b\x6c\x7d"
+			  "\x8e\x9f\xb0\xc1\xd2\xe3\xf4\x05"
+			  "\x16\x27\x38\x49\x5a\x6b\x7c\x8d"
+			  "\x9e\xaf\xc0\xd1\xe2\xf3\x04\x15"
+			  "\x26\x37\x48\x59\x6a\x7b\x8c\x9d"
+			  "\xae\xbf\xd0\xe1\xf2\x03\x14\x25"
+			  "\x36\x47\x58\x69\x7a\x8b\x9c\xad"
+			  "\xbe\xcf\xe0\xf1\x02\x13\x24\x35"
+			  "\x46\x57\x68\x79\x8a\x9b\xac\xbd"
+			  "\xce\xdf\xf0\x01\x12\x23\x34\x45"
+			  "\x56\x67\x78\x89\x9a\xab\xbc\xcd"
+			  "\xde\xef\x00\x11\x22\x33\x44\x55"
+			  "\x66\x77\x88\x99\xaa\xbb\xcc\xdd"
+			  "\xee\xff\x10\x21\x32\x43\x54\x65"
+			  "\x76\x87\x98\xa9\xba\xcb\xdc\xed"
+			  "\xfe\x0f\x20\x31\x42\x53\x64\x75"
+			  "\x86\x97\xa8\xb9\xca\xdb\xec\xfd"
+			  "\x0e\x1f\x30\x41\x52\x63\x74\x85"
+			  "\x96\xa7\xb8\xc9\xda\xeb\xfc\x0d"
+			  "\x1e\x2f\x40\x51\x62\x73\x84\x95"
+			  "\xa6\xb7\xc8\xd9\xea\xfb\x0c\x1d"
+			  "\x2e\x3f\x50\x61\x72\x83\x94\xa5"
+			  "\xb6\xc7\xd8\xe9\xfa\x0b\x1c\x2d"
+			  "\x3e\x4f\x60\x71\x82\x93\xa4\xb5"
+			  "\xc6\xd7\xe8\xf9\x0a\x1b\x2c\x3d"
+			  "\x4e\x5f\x70\x81\x92\xa3\xb4\xc5"
+			  "\xd6\xe7\xf8\x09\x1a\x2b\x3c\x4d"
+			  "\x5e\x6f\x80\x91\xa2\xb3\xc4\xd5"
+			  "\xe6\xf7\x08\x19\x2a\x3b\x4c\x5d"
+			  "\x6e\x7f\x90\xa1\xb2\xc3\xd4\xe5"
+			  "\xf6\x07\x18\x29\x3a\x4b\x5c\x6d"
+			  "\x7e\x8f\xa0\xb1\xc2\xd3\xe4\xf5"
+			  "\x06\x17\x28\x39\x4a\x5b\x6c\x7d"
+			  "\x8e\x9f\xb0\xc1\xd2\xe3\xf4\x05"
+			  "\x16\x27\x38\x49\x5a\x6b\x7c\x8d"
+			  "\x9e\xaf\xc0\xd1\xe2\xf3\x04\x15"
+			  "\x26\x37\x48\x59\x6a\x7b\x8c\x9d"
+			  "\xae\xbf\xd0\xe1\xf2\x03\x14\x25"
+			  "\x36\x47\x58\x69\x7a\x8b\x9c\xad"
+			  "\xbe\xcf\xe0\xf1\x02\x13\x24\x35"
+			  "\x46\x57\x68\x79\x8a\x9b\xac\xbd"
+			  "\xce\xdf\xf0\x01\x12\x23\x34\x45"
+			  "\x56\x67\x78\x89\x9a\xab\xbc\xcd"
+			  "\xde\xef\x00\x11\x22\x33\x44\x55"
+			  "\x66\x77\x88\x99\xaa\xbb\xcc\xdd"
+			  "\xee\xff\x10\x21\x32\x43\x54\x65"
+			  "\x76\x87\x98\xa9\xba\xcb\xdc\xed"
+			  "\xfe\x0f\x20\x31\x42\x53\x64\x75"
+			  "\x86\x97\xa8\xb9\xca\xdb\xec\xfd"
+			  "\x0f\x20\x31\x42\x53\x64\x75\x86"
+			  "\x97\xa8\xb9\xca\xdb\xec\xfd\x0e"
+			  "\x1f\x30\x41\x52\x63\x74\x85\x96"
+			  "\xa7\xb8\xc9\xda\xeb\xfc\x0d\x1e"
+			  "\x2f\x40\x51\x62\x73\x84\x95\xa6"
+			  "\xb7\xc8\xd9\xea\xfb\x0c\x1d\x2e"
+			  "\x3f\x50\x61\x72\x83\x94\xa5\xb6"
+			  "\xc7\xd8\xe9\xfa\x0b\x1c\x2d\x3e"
+			  "\x4f\x60\x71\x82\x93\xa4\xb5\xc6"
+			  "\xd7\xe8\xf9\x0a\x1b\x2c\x3d\x4e"
+			  "\x5f\x70\x81\x92\xa3\xb4\xc5\xd6"
+			  "\xe7\xf8\x09\x1a\x2b\x3c\x4d\x5e"
+			  "\x6f\x80\x91\xa2\xb3\xc4\xd5\xe6"
+			  "\xf7\x08\x19\x2a\x3b\x4c\x5d\x6e"
+			  "\x7f\x90\xa1\xb2\xc3\xd4\xe5\xf6"
+			  "\x07\x18\x29\x3a\x4b\x5c\x6d\x7e"
+			  "\x8f\xa0\xb1\xc2\xd3\xe4\xf5\x06"
+			  "\x17\x28\x39\x4a\x5b\x6c\x7d\x8e"
+			  "\x9f\xb0\xc1\xd2\xe3\xf4\x05\x16"
+			  "\x27\x38\x49\x5a\x6b\x7c\x8d\x9e"
+			  "\xaf\xc0\xd1\xe2\xf3\x04\x15\x26"
+			  "\x37\x48\x59\x6a\x7b\x8c\x9d\xae"
+			  "\xbf\xd0\xe1\xf2\x03\x14\x25\x36"
+			  "\x47\x58\x69\x7a\x8b\x9c\xad\xbe"
+			  "\xcf\xe0\xf1\x02\x13\x24\x35\x46"
+			  "\x57\x68\x79\x8a\x9b\xac\xbd\xce"
+			  "\xdf\xf0\x01\x12\x23\x34\x45\x56"
+			  "\x67\x78\x89\x9a\xab\xbc\xcd\xde"
+			  "\xef\x00\x11\x22\x33\x44\x55\x66"
+			  "\x77\x88\x99\xaa\xbb\xcc\xdd\xee"
+			  "\xff\x10\x21\x32\x43\x54\x65\x76"
+			  "\x87\x98\xa9\xba\xcb\xdc\xed\xfe"
+			  "\x0f\x20\x31\x42\x53\x64\x75\x86"
+			  "\x97\xa8\xb9\xca\xdb\xec\xfd\x0e"
+			  "\x1f\x30\x41\x52\x63\x74\x85\x96"
+			  "\xa7\xb8\xc9\xda\xeb\xfc\x0d\x1e"
+			  "\x2f\x40\x51\x62\x73\x84\x95\xa6"
+			  "\xb7\xc8\xd9\xea\xfb\x0c\x1d\x2e"
+			  "\x3f\x50\x61\x72\x83\x94\xa5\xb6"
+			  "\xc7\xd8\xe9\xfa\x0b\x1c\x2d\x3e"
+			  "\x4f\x60\x71\x82\x93\xa4\xb5\xc6"
+			  "\xd7\xe8\xf9\x0a\x1b\x2c\x3d\x4e"
+			  "\x5f\x70\x81\x92\xa3\xb4\xc5\xd6"
+			  "\xe7\xf8\x09\x1a\x2b\x3c\x4d\x5e"
+			  "\x6f\x80\x91\xa2\xb3\xc4\xd5\xe6"
+			  "\xf7\x08\x19\x2a\x3b\x4c\x5d\x6e"
+			  "\x7f\x90\xa1\xb2\xc3\xd4\xe5\xf6"
+			  "\x07\x18\x29\x3a\x4b\x5c\x6d\x7e"
+			  "\x8f\xa0\xb1\xc2\xd3\xe4\xf5\x06"
+			  "\x17\x28\x39\x4a\x5b\x6c\x7d\x8e"
+			  "\x9f\xb0\xc1\xd2\xe3\xf4\x05\x16"
+			  "\x27\x38\x49\x5a\x6b\x7c\x8d\x9e"
+			  "\xaf\xc0\xd1\xe2\xf3\x04\x15\x26"
+			  "\x37\x48\x59\x6a\x7b\x8c\x9d\xae"
+			  "\xbf\xd0\xe1\xf2\x03\x14\x25\x36"
+			  "\x47\x58\x69\x7a\x8b\x9c\xad\xbe"
+			  "\xcf\xe0\xf1\x02\x13\x24\x35\x46"
+			  "\x57\x68\x79\x8a\x9b\xac\xbd\xce"
+			  "\xdf\xf0\x01\x12\x23\x34\x45\x56"
+			  "\x67\x78\x89\x9a\xab\xbc\xcd\xde"
+			  "\xef\x00\x11\x22\x33\x44\x55\x66"
+			  "\x77\x88\x99\xaa\xbb\xcc\xdd\xee"
+			  "\xff\x10\x21\x32\x43\x54\x65\x76"
+			  "\x87\x98\xa9\xba\xcb\xdc\xed\xfe",
+		.ctext	= "\x32\x09\x47\x2c\x3e\x2a\xc5\x16"
+			  "\xa2\x64\x1e\xc8\xff\xaf\xb1\x5a"
+			  "\x73\x0f\x88\xd1\x2c\x63\xf7\x0e"
+			  "\x98\xda\x63\x83\x8e\x65\xcc\xe1"
+			  "\xe1\x91\x09\xb6\x79\xe5\x18\x29"
+			  "\x77\x45\xf0\x2f\x75\xbd\xbe\x44"
+			  "\x05\x69\xd9\xed\x85\xa9\x7a\xfc"
+			  "\x2f\x6a\x4f\x51\xcb\xb5\x48\x58"
+			  "\xaf\xdb\x26\x6b\x08\x51\xaa\x2f"
+			  "\xf0\x97\x75\x18\xe2\xfa\xe6\x7f"
+			  "\xe5\x19\xde\x18\xa5\x47\x75\x37"
+			  "\xa6\x2f\x54\xe7\xf6\x5e\x45\x76"
+			  "\xf4\x57\x4a\xee\x6f\x2a\xee\xa2"
+			  "\x84\x56\x8a\xc1\x77\x71\x30\x91"
+			  "\xeb\x73\x5f\xd1\x60\x3d\xdc\xac"
+			  "\xae\xf9\xde\x61\xc3\x7b\x98\x1f"
+			  "\xb0\x1e\xc3\xe7\x7b\x13\xc0\x8f"
+			  "\x74\xd0\x1d\xc3\xe4\x1c\x67\xc4"
+			  "\xd7\xc4\xb0\xcd\x39\xbf\xeb\x5b"
+			  "\x4c\xbf\xd7\x62\x68\xc5\x33\x48"
+			  "\x65\xfe\x85\x41\x72\x74\x31\x11"
+			  "\x75\x90\x6e\x39\x99\x29\x80\xc4"
+			  "\xd0\x98\xdb\xd9\x76\x4f\x15\x80"
+			  "\x6b\xd4\x80\xfe\x76\x46\x68\xe8"
+			  "\x93\x72\xe2\x21\x5d\x65\x80\x27"
+			  "\x77\x21\x7d\xc6\x7a\x3c\xb1\x12"
+			  "\x61\x08\xc4\xc0\x57\x5d\x4f\xc6"
+			  "\x2c\x3c\x6d\x89\x2a\xea\xa1\x84"
+			  "\x89\xf4\x14\x5b\xcd\x32\x77\x1c"
+			  "\xbd\x2c\xf8\x49\x61\x69\x76\x41"
+			  "\x24\x31\x5c\xfb\x17\x28\x6f\x93"
+			  "\x57\xc3\xa7\xa4\x41\xd2\xb3\xc3"
+			  "\xae\x9d\x6c\x6c\x63\xd0\x5b\x16"
+			  "\xfd\x93\x13\xd3\x15\x5a\x32\x72"
+			  "\xc0\xfb\x68\x62\x20\x79\x19\xfd"
+			  "\xb0\x8b\x0b\x97\xca\xd6\x34\x5d"
+			  "\x35\xc9\xec\xf5\xf7\x8d\x89\x9c"
+			  "\x92\x37\x5d\x5f\x70\xa2\xf5\x22"
+			  "\x05\xc3\x48\xf9\x49\x55\xbe\x11"
+			  "\x41\x33\xc6\x7d\xfe\x64\x1f\xda"
+			  "\x4d\x96\x4e\x3a\x6e\xd7\x07\xf9"
+			  "\x7e\x2a\xab\x0e\x31\xdd\x78\x3c"
+			  "\x60\x13\x28\x57\xd2\x3b\x47\x4b"
+			  "\xc4\x68\x61\xa7\x8c\xf0\x6a\x35"
+			  "\xeb\x49\x84\x8a\x6b\x1b\xe9\x2c"
+			  "\x6b\xf3\x51\x94\x4b\x8b\x05\x3a"
+			  "\x6f\x15\x5e\xde\x30\x7b\xf8\x6d"
+			  "\x0b\xcc\x46\x57\x9b\x23\x62\x53"
+			  "\x0a\x2f\xc3\x21\xa0\xdf\x1e\xeb"
+			  "\xc1\xd3\x40\x7b\xf8\x09\x9d\x4d"
+			  "\x75\x0b\x48\x92\x7a\x83\xa2\xe2"
+			  "\x3b\xa3\xb1\x09\x4e\xb6\xc6\x89"
+			  "\xd1\xa4\x43\x00\x9d\x3b\x5e\x2f"
+			  "\xd9\x10\x3a\x31\xa9\x8f\x35\x3e"
+			  "\xd6\x69\xb3\x69\x5d\xa9\xd5\x22"
+			  "\x4a\xf7\x38\x15\x5f\x74\xf1\xef"
+			  "\x3b\x07\x8b\x28\xf4\xb0\x7c\x4d"
+			  "\x55\x38\x1f\x3d\x8a\xaa\x76\x79"
+			  "\x71\x2d\x9e\x0f\x51\xdf\x1d\xca"
+			  "\x84\xd0\x00\xb4\x8c\xb3\x3c\xac"
+			  "\x17\xea\xa0\xf0\xcd\x3b\xa8\xed"
+			  "\xbb\xc2\xe8\xd0\xa5\xa0\x6e\x52"
+			  "\x14\x15\xaa\x4d\x60\x01\x8f\xdd"
+			  "\x29\x9b\x70\x08\x51\x81\xa7\x3a"
+			  "\x54\xb9\x92\xdb\xd1\xc8\x09\x46"
+			  "\x9a\x19\xf3\xd0\x9b\x51\xcb\xd8"
+			  "\xad\xe7\xd7\x9f\x77\x7a\x26\x8b"
+			  "\xf4\x51\x4a\x64\x01\x86\x03\x12"
+			  "\xc0\x4f\x9e\x75\xbf\xeb\x96\x63"
+			  "\xf3\x37\x32\xdb\xca\xe6\x14\xe0"
+			  "\xf3\x29\xc2\x9e\x1c\x67\x8a\xa0"
+			  "\xe0\x8e\x9e\xb7\x82\xe7\xf6\x62"
+			  "\x29\x04\x25\x7c\x2b\xeb\xf5\x87"
+			  "\x23\xd1\xa9\xd4\x60\x49\x22\xa6"
+			  "\xb0\x84\x6f\xe2\x9e\x9e\x29\xfb"
+			  "\x10\x3f\xb0\x09\x23\x1c\x2f\xf0"
+			  "\x2c\xd5\xf2\xc1\x6c\xf9\x78\xc2"
+			  "\xe2\x3b\x44\x74\x31\xc2\x0d\x95"
+			  "\xae\xe9\x10\x6b\x75\x8e\x98\xa5"
+			  "\xbf\xb1\x24\xbc\xf6\xb3\xdf\x16"
+			  "\x9e\x0c\xb3\x11\x34\x81\x56\xc7"
+			  "\xff\x21\x2c\xb7\xe7\x40\x50\xc9"
+			  "\xb1\xfd\x89\xc1\x76\x23\xa0\xa3"
+			  "\xe0\x7b\x75\xf5\xb6\x93\xc4\x28"
+			  "\xcf\x1c\x43\x2d\xc6\xce\x94\xfd"
+			  "\xa9\xf9\xa9\xe5\x38\xce\x6e\x22"
+			  "\x83\x2e\xb0\x24\x42\x20\x47\x73"
+			  "\x21\x21\x10\xaf\x5c\x62\x24\x7b"
+			  "\xe9\x8c\xb5\xaf\x09\x0c\x05\x52"
+			  "\x56\x69\x0c\x9d\x35\x46\x3c\xfc"
+			  "\x37\x3b\x2e\xf2\x39\xdc\x6b\x86"
+			  "\x27\xf9\x20\x9b\x17\x56\xfa\xfe"
+			  "\xdc\x9b\xa3\xdb\x12\x2a\x9a\x5c"
+			  "\x51\x82\x32\x04\x2a\x8d\xde\x76"
+			  "\xd4\x68\x3a\xe9\xd7\xd7\xf1\xbd"
+			  "\xfd\x55\xf6\xbb\x75\xae\x81\x5d"
+			  "\xf6\xe5\xcc\xe5\x37\xb5\x20\x3d"
+			  "\x70\x05\x88\xd4\x51\x0f\x17\x8f"
+			  "\x5a\xe0\x87\xe9\x7e\x07\x75\xe8"
+			  "\x06\x95\xab\x20\xa2\x99\x3c\x03"
+			  "\x32\x96\xd3\xf5\x80\xf7\x7d\xfc"
+			  "\x55\x9e\x5b\xf6\x74\x9b\xdb\x54"
+			  "\xac\x85\x9e\x06\xe4\xcd\x65\x41"
+			  "\xd9\x91\xa4\x5d\xa4\x71\xb7\xde"
+			  "\x1c\x5f\x41\x48\x00\xb1\x15\x8e"
+			  "\x77\x54\x5a\x2f\x1a\xfc\x3f\x21"
+			  "\xfd\x5c\xac\x94\xc5\x7c\x29\xae"
+			  "\x28\x2d\x74\xfd\x65\x93\x5f\xc7"
+			  "\x22\x9a\xc6\xaa\xb3\x4a\x1a\xb6"
+			  "\x64\x50\x0e\xd2\x04\x21\x0c\x02"
+			  "\x25\xf3\x1a\x5f\x6b\xaf\x2e\x58"
+			  "\xa0\x3e\xc5\xc5\x17\x11\xae\x39"
+			  "\x9d\xea\xd1\x5a\xd1\x84\xcd\x82"
+			  "\x90\x53\x3e\xb4\x33\x87\xef\x02"
+			  "\x04\xdc\x27\x2a\xca\x0e\xbb\x25"
+			  "\x1f\xa1\xd4\xf0\xca\xe4\x0d\xd7"
+			  "\xed\x22\x4a\x96\x8f\x8c\xc9\x3a"
+			  "\xe0\x50\x20\x9a\xff\xf2\xe8\x93"
+			  "\x8c\x19\x6a\xbd\xe2\xe6\x0e\x00"
+			  "\x85\x26\xc8\x17\x2c\xd0\x23\x10"
+			  "\xf6\xba\x98\x44\xc6\x53\xd3\xc7"
+			  "\xc9\x55\x0c\x68\x75\x76\xea\x73"
+			  "\x07\x7b\xb3\xf2\xdb\x76\xee\x47"
+			  "\xb8\x48\xcd\xdf\xa3\xed\xe3\xe2"
+			  "\x1e\x8d\xab\x89\x87\x94\xdd\x62"
+			  "\x21\x30\xe8\xaa\x0d\xcd\x8a\x75"
+			  "\xd3\x49\xa0\x3a\xc7\x81\x46\x92"
+			  "\x48\xdf\xc6\x5e\xe9\xc7\x93\x32"
+			  "\xab\xb8\x74\xac\x35\x0e\x1f\x00"
+			  "\x1b\x44\xdc\x17\x55\xd0\xdc\xd8"
+			  "\x5d\x05\xee\x49\x37\x46\x2a\x9a"
+			  "\x8d\x98\xb8\x11\x91\x30\x58\x89"
+			  "\xd9\x39\xa1\xb9\x4d\x03\xe1\x57"
+			  "\x2f\xc3\x0c\xc7\xa3\xd8\x84\x7b"
+			  "\xa4\xd2\x78\x7d\xc9\x80\x14\xbd"
+			  "\xd6\xee\x91\x40\xa3\xe5\xd6\xeb"
+			  "\x79\xe1\xa9\xba\x70\x66\x51\x19"
+			  "\x70\x38\x6b\xfd\xb6\x45\x87\xe1"
+			  "\xce\xa4\x54\x81\x34\x82\x2a\xf9"
+			  "\xba\xcc\x6f\x93\x4e\x0d\x2e\x2a"
+			  "\x8f\x53\x90\x3b\x09\x41\x6b\x7f"
+			  "\x59\xb0\x87\x33\xe4\x1a\x88\x21"
+			  "\x71\xd6\x5b\xd0\x2e\x07\x84\xc8"
+			  "\x97\x87\x95\x78\xce\x5c\x72\xd2"
+			  "\x61\x1e\xc1\x8c\x65\x67\x23\x13"
+			  "\xd5\x26\xfb\xff\x56\x59\xdb\x71"
+			  "\x22\x1d\xcb\x29\x53\x7e\x69\x67"
+			  "\x17\xea\xe6\xb9\xde\x9e\xa9\xb8"
+			  "\x04\x8a\xa8\x82\x4a\x49\xb0\x82"
+			  "\xa8\x4e\x5a\xca\x00\xe1\xfa\xa4"
+			  "\xc2\xa8\xcb\x31\x16\x8e\x43\x1f"
+			  "\x74\x9b\xca\x88\x06\xab\x03\x78"
+			  "\x21\x3c\xdd\x6c\x69\xae\xc5\xfa"
+			  "\x3f\x2d\x45\x18\x31\xe4\x98\xfe"
+			  "\xc8\x5d\x6f\xb8\x4e\x64\x89\x07"
+			  "\xb4\x90\x35\x83\x0b\xc2\x03\xe9"
+			  "\x0d\x1a\xa4\x2a\x4d\x79\xe2\x08"
+			  "\xcf\x53\x8d\x82\xd8\x71\xea\x34"
+			  "\x24\x80\x74\xa7\xa7\x93\x58\x54"
+			  "\x17\x45\x8f\xea\xac\xa2\x6b\x93"
+			  "\x70\x0e\x23\x22\xc9\xcf\x11\x5a"
+			  "\xac\xd7\x86\x48\x84\x6b\x24\x62"
+			  "\x11\x32\x74\xe2\x6e\x5d\xe2\x0f"
+			  "\xfa\xf5\xcf\xf2\x92\x9e\xac\xbe"
+			  "\x6a\xc1\x76\xd8\x19\x4e\xac\xd4"
+			  "\xf2\xdc\x6c\x2f\xf4\x51\x1b\x1f"
+			  "\x47\x89\x8c\xe9\x36\x3c\x06\xa6"
+			  "\xd7\x1e\x60\xa3\xca\xe7\x0c\x44"
+			  "\xed\x8b\xdb\x1e\x05\xaa\xfd\x66"
+			  "\xab\x07\x13\x2b\xfc\x84\xd7\xed"
+			  "\xcf\x47\x3d\x8b\x0f\x74\x76\x47"
+			  "\x19\x4c\x77\x2f\xde\xf4\x12\xf0"
+			  "\xbb\xee\x77\xe3\x7b\x6d\x18\x78"
+			  "\xb0\x0a\x77\xb9\xb0\x7c\x07\x52"
+			  "\xc2\x72\x09\x48\xa3\x17\x53\x17"
+			  "\x0d\xcf\xdd\xb2\x41\x78\xdf\xb7"
+			  "\x8c\xca\xd7\x49\xb0\x3b\xc0\x82"
+			  "\xd7\x58\x4f\x5e\xf1\x34\xf2\xc5"
+			  "\x20\x8c\xd7\x79\xe3\xf4\x7e\xbe"
+			  "\x6f\xb7\xeb\x70\x81\xdb\x5b\x7b"
+			  "\x92\x56\xbf\xf9\xf9\x30\xf8\x38"
+			  "\x5a\x35\x12\xc3\xca\x95\xf8\x79"
+			  "\x10\xd2\x56\x00\x60\x19\xa7\xb7"
+			  "\xe6\xab\x35\x47\x9a\x33\x41\x86"
+			  "\x38\x7f\x24\xc2\x03\x74\x43\x15"
+			  "\x78\xd0\x58\xd9\x31\x11\x1d\x59"
+			  "\x18\xc1\x2a\xa1\x7d\x88\xc2\x8e"
+			  "\x69\x61\x4d\x6b\xc7\x37\x7f\x18"
+			  "\x4e\xb1\x27\x7f\x79\x65\x96\x1d"
+			  "\xac\x3f\x31\x74\xe4\x9d\x14\xed"
+			  "\xf2\x3b\x2a\x4d\xbb\x8e\x12\x03"
+			  "\xb8\xf5\x8d\x5f\x61\xa7\xcf\xe7"
+			  "\x07\x9b\xef\x0a\x05\xef\x73\xe9"
+			  "\xc1\x53\xaa\x35\x19\xe2\xb7\xdd"
+			  "\xa9\x7e\x2e\x3c\xc3\x48\x81\x32"
+			  "\x14\xd5\xef\x77\xbc\x69\xa8\x2a"
+			  "\x97\xac\xe9\x4f\x5a\x78\x65\x1b"
+			  "\xca\xc5\xdf\x86\x66\xd5\x83\xd1"
+			  "\x46\xb9\xf4\x04\xe3\xb5\x45\xfd"
+			  "\x74\x52\x28\x28\x26\x96\xd2\x8c"
+			  "\xe2\x27\x91\xa9\x94\x93\x65\xc3"
+			  "\xf4\x38\xa6\xda\x64\xdf\x07\xef"
+			  "\xc4\x2d\x82\xca\x70\x3b\x2f\xb0"
+			  "\x24\x82\x5d\x14\x33\x6f\x99\xed"
+			  "\xea\x87\x58\x7d\xaf\xac\x94\x6f"
+			  "\xbb\xcb\x9f\xaa\x08\xa0\x30\x70"
+			  "\xac\x22\x72\x73\x7c\x92\x46\x0d"
+			  "\xd3\xb3\xf4\x71\xc7\x1e\xed\xa9"
+			  "\x2e\x39\x6d\xee\xff\x37\x10\x1b"
+			  "\x8e\xf1\x23\x57\xff\x93\x1f\xe1"
+			  "\xa3\x43\xaf\xee\x2a\x70\xff\x99"
+			  "\x52\x0e\x96\x95\x3d\xc3\xba\x5e"
+			  "\xde\xeb\x4d\xf9\x19\x15\x51\x76"
+			  "\xe9\x36\x83\xbc\xdc\xca\x83\x1f"
+			  "\x4d\xf0\x84\x13\x04\xdc\xa2\xda"
+			  "\x47\x0d\x7c\xf3\x77\xa1\xfd\x7a"
+			  "\x54\x6e\xbc\xb9\xa4\xe2\x68\x57"
+			  "\x45\xac\xbb\x97\xb0\xbe\x29\x30"
+			  "\x1d\x2b\xd7\xeb\x87\x58\x72\xc8"
+			  "\xf7\x24\x61\x30\x54\x98\x49\x93"
+			  "\x2e\xd3\xcd\x18\xa9\x4c\xa3\xf7"
+			  "\x1a\xbb\xff\x57\x11\x37\xce\xa7"
+			  "\xfe\x59\x68\x7a\x8b\xb6\x02\xb2"
+			  "\xaa\x27\x81\x2e\xcf\x61\xca\xe5"
+			  "\xa3\x8e\x19\x16\x4d\xeb\x72\x06"
+			  "\xdf\x60\x4f\x58\xb2\x15\x71\xb2"
+			  "\x0a\x72\xb5\x7d\xbb\x7e\x7e\x78"
+			  "\xff\x36\xf5\xb6\x04\x10\x22\x31"
+			  "\x08\x72\xef\xd8\x04\x05\xe0\xba"
+			  "\x2d\x3e\xab\x69\x00\xcd\xc0\x15"
+			  "\x54\x13\xae\x14\x74\x5b\xa1\xd9"
+			  "\x1f\x71\x7d\x26\xaf\x28\x66\xbf"
+			  "\x19\x22\xb9\xf3\x2a\x87\xf4\x8f"
+			  "\x8a\xc4\xf0\x9b\x98\x7e\x9d\x2a"
+			  "\x48\x87\xd6\x52\x6a\x79\x31\x0c"
+			  "\x09\xb9\x0e\xfa\x28\xff\xc6\x59"
+			  "\x0f\x8e\x7e\x34\x74\xab\xf4\xaa"
+			  "\x2f\x5a\x6d\xfe\x4b\x52\x90\xd6"
+			  "\x77\x42\x0f\x6e\x8c\x12\x3c\xb4"
+			  "\x28\x6e\xa5\x33\xf6\x34\x7e\xc2"
+			  "\x2d\x57\xf9\x78\x32\x05\x5c\x06"
+			  "\x22\x7f\x5f\x58\xf9\x54\xfc\xe8"
+			  "\xf3\x58\xbd\x70\x3c\xaa\x90\xac"
+			  "\xc3\x2b\x2e\x05\xcf\x7d\xa1\x81"
+			  "\x7f\xee\x59\x25\x6f\x16\x47\x75"
+			  "\xe0\x96\x92\xd6\xea\x4c\x42\x2d"
+			  "\x9b\x6d\xd5\xe7\x15\x64\x8f\x71"
+			  "\x28\x8d\x71\x35\xf0\x8d\x74\xc3"
+			  "\x37\xad\xfd\x93\x2b\x6c\x8b\x2e"
+			  "\xa4\x4a\xe2\xf1\x3c\xbf\xa9\xaf"
+			  "\xe4\xf2\x36\x07\xb9\x89\x94\x7a"
+			  "\xc3\x31\x11\x17\xd5\xf7\xef\xe8"
+			  "\x99\xc9\x1d\x82\x70\xaf\xb2\x7c"
+			  "\x4f\x4f\x23\x09\xd0\xb5\x98\x18"
+			  "\x53\x8c\x12\xf2\x4a\x5f\x43\x1e"
+			  "\xe0\x22\x20\xc8\x54\x7c\x0e\x27"
+			  "\xa4\xfb\x9d\xe2\x77\xfb\xbb\xc7"
+			  "\x5e\xa3\xc0\x9f\x99\x4d\x8e\x91"
+			  "\x0d\xe2\x7d\xe0\xad\xac\x4a\x2a"
+			  "\x6b\x6c\xb8\x01\x4a\x5c\x4b\xce"
+			  "\x2e\xab\x39\x57\x35\x83\x40\xb8"
+			  "\xef\xc7\x5e\xda\x39\xa3\x22\x4d"
+			  "\x67\x1a\xdb\x39\xc7\x4b\x2d\x38"
+			  "\x8f\x14\x3d\xc8\xef\x38\xf1\x68"
+			  "\x92\x19\xc4\xa4\x1d\x7b\xd2\xd9"
+			  "\x59\xb7\xc8\xf2\x81\x98\x11\xfc"
+			  "\x95\x6b\x78\x76\x2f\xfc\x3e\x86"
+			  "\x30\x38\x1c\x85\xfc\x40\xbd\x6a"
+			  "\x9a\x5b\x1b\x40\xab\x83\xa5\x7d"
+			  "\xcd\xa1\x13\x2f\xe2\xb0\xe1\xbb"
+			  "\x4a\xfd\x1c\xc3\x56\x1d\x97\xa0"
+			  "\x1e\x38\x64\x28\x97\xd0\x91\xae"
+			  "\xa4\x97\x01\x49\x3d\xb1\x4a\x6d"
+			  "\x0d\x52\x41\x84\xb9\xc3\x14\x64"
+			  "\xc0\x5d\xa2\xea\xcd\x27\xe6\xfd"
+			  "\x3e\x62\x04\xbd\x7d\x5c\x5d\x36"
+			  "\xd8\x71\x9a\x0d\xa0\x66\xcb\x33"
+			  "\x2a\xfe\x7a\x17\x19\x9d\x1c\x8e"
+			  "\x19\x99\xd3\x51\x0c\xdd\x2d\xc3"
+			  "\x39\x8b\x10\x8e\x7a\xc6\x5f\x25"
+			  "\x47\x1c\xe6\xa6\x1c\xbd\x6d\x23"
+			  "\x17\x28\x8a\x19\xa2\x14\xb1\x49"
+			  "\x42\x02\x50\x41\xae\x83\x41\xbd"
+			  "\x10\xea\x09\x32\x0d\x51\xa2\xcd"
+			  "\x7e\xbb\x8d\x6c\x67\xf3\x1d\x62"
+			  "\x1d\x19\xbc\x3c\xdb\x70\xba\x17"
+			  "\x10\x55\xd4\xd0\x90\xaf\x55\x5a"
+			  "\x83\xe9\x80\x60\x34\x2e\x2b\x70"
+			  "\xd8\xde\x37\x9c\xd7\x67\xa8\x1d"
+			  "\xbd\x9c\x6f\xc9\x20\x8d\x06\xc2"
+			  "\xe8\x49\x5c\x33\xe3\xa3\x91\x66"
+			  "\x34\xc9\x49\xb3\x35\xf6\x98\xa8"
+			  "\x16\xa4\x5e\x4e\x93\x03\x2f\x6f"
+			  "\xce\xb9\x82\xf5\xca\x5c\x85\x6c"
+			  "\x07\x7b\xa1\xaf\xed\x06\xde\x6f"
+			  "\x79\x5c\xcf\x1c\xdd\xbc\x8e\xb3"
+			  "\x0d\xa3\x10\x99\x78\x90\x27\x41"
+			  "\x08\x60\xdd\x8e\xc5\x56\x18\xf4"
+			  "\x9d\xa4\x46\xa4\x03\x7f\xc4\x2d"
+			  "\x1f\x47\xaa\xdb\x47\x1b\xe1\x25"
+			  "\x0f\xe1\x4e\x3d\x48\x15\x95\x9e"
+			  "\xb7\xea\xe6\xc1\x58\x69\x07\x79"
+			  "\x9d\x98\x3c\x3c\x7c\x4c\xa5\x68"
+			  "\xea\x7c\xe8\x06\x8c\xbf\x32\x8f"
+			  "\x67\xf8\x61\xb3\x6d\xae\x71\x32"
+			  "\x4d\x6b\x8d\xd9\x70\x09\x42\x77"
+			  "\x06\x39\x9b\x6b\xec\x7a\xa8\x9d"
+			  "\x08\x91\xb6\xa3\xe4\xd9\xb0\x5f"
+			  "\xd7\x52\x71\x7d\x02\x3a\xe2\x05"
+			  "\x17\x26\xd2\x2a\x65\x1f\x48\x6c"
+			  "\x4e\x31\x31\x2c\xd2\x8e\xbb\x03"
+			  "\x3f\x43\x64\xa3\xb3\x25\x12\xde"
+			  "\x26\x22\x93\xcb\x1c\x74\x19\x25"
+			  "\x0b\x23\x56\xff\xf6\x96\xd8\x9f"
+			  "\x34\xd0\x51\x8f\xec\x83\xc9\x10"
+			  "\xa1\x72\xee\xe3\x81\xf6\x78\xfd"
+			  "\x63\x33\xfd\x7e\x71\x0d\x31\xa7"
+			  "\x6d\x6b\x09\x14\xd5\x94\xa6\x74"
+			  "\xbd\xb9\x33\x3c\x8a\x67\x84\x93"
+			  "\xc4\x13\xf0\x4e\x7e\xa8\x1a\xe9"
+			  "\xed\x17\x13\xf0\x3c\x33\x5a\x85"
+			  "\xc6\xdb\x24\x15\xf6\xf7\xa1\xd6"
+			  "\xaf\xf7\xf4\x16\xe7\xa9\xf1\x99"
+			  "\x27\xea\xee\xd9\x76\x29\xc4\x79"
+			  "\x5a\x1b\x43\x1c\x71\xac\xc5\xe2"
+			  "\x00\xe8\x93\x47\x22\xfb\x01\xdd"
+			  "\x7a\x62\x14\xe1\xac\x28\xb3\x84"
+			  "\x29\xbc\x71\x5a\x08\x39\xd4\x52"
+			  "\x55\x31\x1d\x1f\xf4\xc2\x26\x2c"
+			  "\xf2\xa9\x5f\x15\xb2\x0a\x51\x43"
+			  "\x65\x08\xc1\x66\x9b\x47\xa9\x63"
+			  "\x8a\xf8\xc9\xfc\xd4\x39\x5f\x1c"
+			  "\xcc\xca\x28\x5d\xc1\xcc\xc8\xc8"
+			  "\x2a\x87\x27\x0b\x15\x39\x5c\xed"
+			  "\xc0\xf8\xb4\x9e\x9a\x01\xd8\x0d"
+			  "\xe2\xa9\xa4\xb4\x8a\xe1\xed\x9d"
+			  "\x2c\x92\xfc\x92\x58\xdd\xa8\x24"
+			  "\x5c\x3b\x6e\x0d\x18\x9b\x1f\x85"
+			  "\x9c\xd2\xe4\x37\x07\xb7\xff\x3b"
+			  "\xf5\xa8\x39\x34\x70\x29\xd5\x18"
+			  "\x16\xc2\x6a\xc4\xfc\xc3\xe8\x9d"
+			  "\xed\xf8\x05\x1b\x17\x5d\x9e\x18"
+			  "\x9b\xee\x08\xdb\x8a\xe2\xcd\x51"
+			  "\x97\xb2\xd3\xd7\x91\xac\x1a\xe7"
+			  "\xdc\xdd\xa2\x66\x51\x05\xba\x6a"
+			  "\xeb\x54\x60\xe3\xd9\xfe\x43\xaf"
+			  "\x2a\x7a\xc9\xa2\xe5\x12\xe0\xc3"
+			  "\xb8\xc9\xb2\x8b\x57\xe4\x52\x4f"
+			  "\xec\xad\xd1\x4a\xd9\x9f\x94\x64"
+			  "\xc8\x5d\x3e\x38\xd6\x61\xca\x98"
+			  "\xa6\x21\x54\xd1\x4a\x94\x8d\x70"
+			  "\x55\x8c\x3d\x5f\x7a\xdd\x6c\xc9"
+			  "\x9b\xd5\x8d\x7b\x8d\x1b\x62\x4c"
+			  "\xe5\xaa\x74\x3a\x54\x61\x3c\xa2"
+			  "\x35\xff\xb6\x15\xf5\x37\x34\x58"
+			  "\xb2\x37\x59\xbb\x42\xee\x13\x56"
+			  "\x77\xbe\x6e\x74\x39\x5e\x04\x96"
+			  "\x72\x1b\x48\xdc\x1e\x57\x05\xbd"
+			  "\xe3\x95\x81\xe6\xec\x07\x5e\x23"
+			  "\x97\x27\x00\xdc\xbf\x00\xd8\x99"
+			  "\xbc\x96\xd1\xf7\x4a\x8e\x77\x12"
+			  "\x3e\x4f\x1a\xc2\xd6\x5b\x26\xad"
+			  "\x0d\x73\xf4\x79\x3f\x4d\x9e\x29"
+			  "\x86\x86\x19\xe0\xf1\xdb\x11\xce"
+			  "\x99\x30\xea\x3a\x01\xa8\x4f\x1f"
+			  "\xc4\x88\x10\x81\xcf\x82\xa9\x6a"
+			  "\xe3\x9f\xf7\x12\x68\x9a\x13\xf1"
+			  "\x02\x72\x4d\x5c\x54\x64\x2b\x55"
+			  "\x52\xfa\xad\x71\x84\x66\x70\x3e"
+			  "\x80\xab\x89\xd4\x43\xc0\xa4\x6d"
+			  "\x5c\x6b\x5d\xf8\xc1\x88\x03\xf5"
+			  "\xc5\x39\x8e\x97\xa1\x8a\x68\x2c"
+			  "\x2c\x68\x2c\xf5\xd4\xe7\x2e\xd6"
+			  "\xff\xd2\x9c\xa4\x15\xa1\xbd\x0e"
+			  "\xb8\x31\x6f\x7f\x5d\x4f\x92\xf9"
+			  "\x91\x4f\x43\xa7\x68\x8a\x9e\x56"
+			  "\x2e\x13\x47\xa9\x55\xb7\x9f\x74"
+			  "\x48\x60\x3a\x6a\xb8\x51\xd7\x79"
+			  "\x9e\xff\x5e\xbf\xb4\x84\x57\x1a"
+			  "\xaf\x3b\x8d\x66\x30\x1a\x4a\xa4"
+			  "\x3a\x1a\xbf\x40\x8d\xc9\x62\x3f"
+			  "\xff\xa3\x58\x0c\x55\xe8\x7b\xf3"
+			  "\x08\xc5\xb6\x3d\xa6\xd5\x70\xcf"
+			  "\x2c\xa1\xc5\x2f\x6c\x05\xa7\x10"
+			  "\x27\x55\xa5\x16\xc2\xf7\xad\x17"
+			  "\x30\x4e\xd2\xad\xf3\xb3\x8b\xb2"
+			  "\x01\x47\x94\x4d\x29\xc6\xe9\x53"
+			  "\x43\xd2\x22\x4c\x0f\xbd\xfd\x8b"
+			  "\x8d\x96\x5b\x8d\xb1\x12\x12\x93"
+			  "\x74\x9c\x09\x79\xcb\x72\xfb\x86"
+			  "\x3d\x83\x5c\x0f\xfc\xe3\x2e\x24"
+			  "\xcb\x3a\xa7\xc5\x59\x28\x81\xa0"
+			  "\xb7\xd1\xaf\x66\x0b\x6c\xb8\x6c"
+			  "\xb7\x67\x1f\xaf\xd0\x3c\x4f\x4a"
+			  "\x6f\x9d\xd8\x78\x15\x03\xd2\x0f"
+			  "\xd0\xc7\xb0\x93\xb2\x7c\x75\x37"
+			  "\x09\x87\x5e\xb9\x66\xdb\x6d\x78"
+			  "\x26\xf8\x46\xd9\x99\x2d\xb8\x4e"
+			  "\x1b\xe0\x02\xfe\x87\xd6\xb3\xe3"
+			  "\xfb\x24\x24\x5a\x93\x5b\x74\x4f"
+			  "\x7d\x9d\xb5\x89\x65\x59\xe2\xe2"
+			  "\xd2\x45\x4c\x29\x39\x66\xad\xab"
+			  "\xdd\xbd\xae\x0f\x9b\x84\x1b\xd9"
+			  "\x58\x10\xbb\x63\x2e\xa4\xbf\x22"
+			  "\x80\x31\x3f\xed\x14\xd0\x85\x18"
+			  "\xf2\x22\x99\xb4\x60\xbc\x97\x73"
+			  "\x03\x9c\x3c\x56\x0d\x14\xdd\xfd"
+			  "\x50\x64\x7a\xb9\xd7\xed\xc9\x7b"
+			  "\x31\xba\xcd\x34\xe7\xd0\xe1\x58"
+			  "\xbe\x55\xf3\xe8\x60\xa1\x22\x4a"
+			  "\x2e\x7f\x2e\x23\x20\x4c\x09\x00"
+			  "\x0e\xc6\x6b\x26\xe1\xdf\x3c\xc0"
+			  "\xed\xdd\x3d\xee\x07\x40\x80\x7a"
+			  "\xdc\x65\x38\xac\xd6\xb0\x13\xac"
+			  "\x49\xa7\xc7\xa2\x48\xab\x22\xf9"
+			  "\xf2\xba\x54\x01\x3f\x2f\xb2\xbd"
+			  "\x45\x42\xf9\xd0\x54\xbb\x18\x00"
+			  "\xf9\xa0\x84\xb2\x60\x94\x48\x7e"
+			  "\x64\x15\x8a\x8a\x48\x62\xae\xc1"
+			  "\x2b\x64\x08\x87\x5a\xed\x50\x50"
+			  "\xd4\x80\xee\x55\x70\x19\x21\x6b"
+			  "\x93\x93\x58\x9c\x4f\x45\xb1\x58"
+			  "\x65\xc1\x05\x8c\xce\x65\x96\xe9"
+			  "\x05\xcf\x16\xba\x04\x90\x20\xd1"
+			  "\x05\x84\x8e\x8f\xee\xb0\x25\x2d"
+			  "\xce\x1e\x7a\x40\x12\xc0\x21\x98"
+			  "\xe2\x3b\x7a\x74\x46\x2d\xcc\x1c"
+			  "\xd5\x2e\x2b\x22\xf2\xc8\x01\x08"
+			  "\xf1\x2b\x29\x70\x54\x3f\x3d\x50"
+			  "\xbf\xcf\x36\x72\x1d\x77\x95\x85"
+			  "\x65\x50\xf9\x6a\x7d\xfb\x2c\x22"
+			  "\xd7\x9a\x6b\x8f\x3c\x01\x2c\x17"
+			  "\x3e\xe1\x74\xf3\xa7\x40\x26\x89"
+			  "\xf4\x61\xaf\x3f\x5a\xee\x56\x3f"
+			  "\xd8\x80\x42\x0e\x62\x26\xef\xe1"
+			  "\x05\xa2\x77\xa8\x42\x89\xe9\x5b"
+			  "\xd1\x5f\x0d\xeb\x70\x11\xdb\x6f"
+			  "\x53\x77\xc2\x0e\xed\x35\xdc\x61"
+			  "\x47\x6d\xf1\xac\xc6\x77\x9d\x83"
+			  "\x56\xdc\x8a\x9d\x8a\x38\xf4\x93"
+			  "\x03\x8c\xea\xfe\x20\x1d\x78\x06"
+			  "\xa7\xd3\x01\xad\x3c\x6a\xb8\x38"
+			  "\x70\xbb\xc0\x97\x52\x21\x53\xd9"
+			  "\xdf\x40\x1a\xfc\x4e\x1b\x0b\x65"
+			  "\x8f\xc7\x26\x7b\x79\x21\x5b\xd6"
+			  "\xf7\xcc\x79\xfd\xaf\xea\x80\x44"
+			  "\x23\xb3\xad\x77\xfa\xfc\xdf\x01"
+			  "\x5e\xe0\x4f\x64\xc0\x97\x27\x5a"
+			  "\xc8\xf9\x82\x9e\x0a\xab\x71\x24"
+			  "\x5d\xf4\x5b\x6b\x5b\x7b\x9c\x3d"
+			  "\x4b\x00\x6b\xaf\x9a\x8f\x87\x42"
+			  "\x6d\x38\x5b\x35\xbd\x32\x9b\x7c"
+			  "\x33\xa6\x7b\x73\x73\x2e\x48\xcb"
+			  "\xdc\xf0\x03\x8e\xa6\x20\xfe\xb3"
+			  "\xa1\x1b\x41\x43\x14\x18\x9b\x75"
+			  "\x2c\xfb\xa0\xc8\x7e\x3a\xa7\xbf"
+			  "\x45\x97\x5a\x48\x90\xb1\x73\x84"
+			  "\xef\x17\x3e\x5f\x33\xbe\xc8\x04"
+			  "\x5f\xb5\x1d\x81\x80\x3b\x8e\x01"
+			  "\x3c\x11\x60\x73\x27\xb0\x57\x2e"
+			  "\x05\x1e\x0e\xc1\x12\xe8\xa2\x57"
+			  "\xfa\x30\x3d\x08\x69\xda\xe0\xfc"
+			  "\x6b\xbf\xaa\x9e\xaf\x50\x2e\x01"
+			  "\x0a\x29\xe3\x18\x23\x06\xc2\x34"
+			  "\x28\x50\x6e\xc8\x5a\x5b\x6f\x70"
+			  "\x22\xb0\x42\x59\x13\xae\xf1\xce"
+			  "\xfe\x77\x3e\x56\xb0\xe8\xf4\xcd"
+			  "\x10\x06\x5a\x2b\x0b\xa9\x19\xcc"
+			  "\x20\x82\x7e\x7a\x2a\x2c\x47\x4d"
+			  "\x21\xd5\x39\xec\x3a\x6c\x9a\x29"
+			  "\x8c\x1c\x7c\x71\x4d\x44\x52\x2d"
+			  "\xaa\x2c\xf4\x08\x32\x00\xa9\x5a"
+			  "\x29\x78\xec\xa4\xf0\x7e\x23\xdd"
+			  "\x31\x00\x8b\xff\x60\xc1\x32\x72"
+			  "\x4c\x04\xc6\xad\x9b\x27\x7f\xca"
+			  "\xe0\xe0\xa3\xd5\x61\x40\xae\x35"
+			  "\x2a\x73\xb0\x27\x5b\x31\xec\x8e"
+			  "\x82\x5d\xab\x55\xb6\xa4\xa4\xa5"
+			  "\x5c\x4c\x22\x41\x36\x0b\x6a\x6d"
+			  "\x72\x9c\xd3\xf3\xe2\x49\xd0\x0d"
+			  "\x41\xb1\xd9\x38\x25\x78\xad\x77"
+			  "\xcc\x1e\x98\x3b\x0c\xa8\x95\x9e"
+			  "\xd1\x4a\x76\x41\x69\x31\x4b\xb0"
+			  "\x3e\xc0\xe7\x34\x02\x4a\xc1\x19"
+			  "\x37\x64\x58\x1b\x33\xf2\x65\x58"
+			  "\xfd\xb1\xd5\x2d\xbb\x54\xaa\x54"
+			  "\xcf\x4d\x36\x67\x5a\x35\x6f\xc8"
+			  "\xa0\xe8\x6e\x9d\x9c\x59\x46\xa5"
+			  "\xc6\xb4\x53\x99\xad\x15\xa9\xbc"
+			  "\x38\x77\x1f\xbd\x37\x0a\xf3\x9a"
+			  "\x4b\x77\x2f\x44\xe1\x13\x60\x99"
+			  "\x8d\xc0\x75\x71\x0c\xee\xc5\x25"
+			  "\x17\x97\x16\x70\x51\x6a\xc6\x49"
+			  "\x13\x98\x1e\xbf\xc8\xd2\xab\x63"
+			  "\xfa\x7b\xbf\x6e\xcc\xdb\xae\x76"
+			  "\xb9\x39\xe6\xee\x5e\x42\x7b\x63"
+			  "\x25\xb3\x23\x8c\x94\xcb\x04\x85"
+			  "\x75\xcb\x76\xb1\xef\xcb\xf5\xe9"
+			  "\xd3\x77\xfe\xf8\x8b\x95\x83\x48"
+			  "\xc7\xa9\xe6\xa9\xa0\xa6\xca\x5f"
+			  "\x7f\x6c\xe3\x9a\xa5\x4b\xda\x2a"
+			  "\xff\x53\xde\x22\x23\x37\xc9\xf2"
+			  "\xa0\xc9\xc2\x06\x5f\x05\x6e\xea"
+			  "\x73\x9d\x6b\x07\x51\xc6\x75\x43"
+			  "\x86\xb8\xe5\xb9\x29\xa9\xe7\xbe"
+			  "\xfd\x90\x1c\x5b\x68\xf1\x4a\xcd"
+			  "\x99\xd4\x49\x75\x87\x90\x08\x9e"
+			  "\x8f\xcb\x65\xa7\xf0\x72\xfc\x4a"
+			  "\x1b\xab\xaf\x9e\x52\xb1\xd3\xc8"
+			  "\xdc\x45\x74\x87\x8f\xff\x83\x1f"
+			  "\x36\x89\xc5\x15\x08\xe6\x17\x2d"
+			  "\x1d\xb5\x59\x8e\x0e\x98\x35\x5c"
+			  "\x54\x20\xdc\x95\xc0\xf6\xee\x0e"
+			  "\x0b\xbc\xbc\x1f\x78\xb1\x54\xab"
+			  "\x07\x9c\xf0\xb6\x5a\xa2\xa8\xc2"
+			  "\xc2\x0b\x17\xb6\x7d\x75\xc4\xfb"
+			  "\x74\x70\xdb\x89\xcd\x8e\xed\x22"
+			  "\x3a\x83\x38\xf8\x1a\xb7\x52\x3a"
+			  "\xcb\x14\xe8\x9c\x5e\x53\xcf\x94"
+			  "\x9a\x5e\xfc\xe2\x6e\xee\x5b\xf8"
+			  "\xa4\xbd\x16\x29\xf2\xc0\x1e\xf6"
+			  "\x27\x04\x43\x60\xb7\xcc\x8b\xe1"
+			  "\xa5\x43\x75\xf3\xfd\xca\x3b\x63"
+			  "\xc3\xe6\x58\x2d\x80\x50\xbc\x1f"
+			  "\x18\xae\x9a\xe2\x3f\xf0\x4e\x56"
+			  "\x93\x28\xd5\x55\xf5\x52\x58\xef"
+			  "\x07\x09\x55\xc3\x8b\xa0\xe7\x54"
+			  "\x2e\x63\xe6\x4a\x76\x17\x92\x68"
+			  "\xbe\x7e\xf9\xc6\x2b\x2b\xb7\x7d"
+			  "\xdf\xad\x0b\x62\x57\xbb\xe0\x4b"
+			  "\x0f\x16\xf8\xc5\x57\xd2\xd7\xb7"
+			  "\x8a\x32\x3c\xba\x31\xec\xa0\xb5"
+			  "\x48\xb9\xa3\x9f\xb0\x7f\x2e\x15"
+			  "\xe5\xd6\x5d\xfe\x53\xb8\xf9\x52"
+			  "\xe1\x2a\xf6\xc8\x07\x0a\x7a\xa7"
+			  "\x7c\x9f\xca\x37\x68\xdf\x56\xbd"
+			  "\x35\x77\x9c\xc7\x27\x98\xce\x6f"
+			  "\xb2\x2d\xb5\x6a\xa8\x94\x05\x0a"
+			  "\x63\xe2\xad\x50\xd8\x7b\x59\x82"
+			  "\xc2\x1e\x6d\x45\x25\x18\x28\x2f"
+			  "\x78\x35\x75\xed\x0e\x67\x26\xbe"
+			  "\xde\xf7\x88\x17\xc2\x37\x1c\x80"
+			  "\x5b\xa9\xd2\x8e\xbe\x7d\x8e\xb1"
+			  "\x64\x7a\x9f\xa2\x0c\x9b\x66\x19"
+			  "\x05\x84\x95\x61\xc3\x4c\xad\xb2"
+			  "\x47\xff\xc5\x6e\xdb\x78\x23\xba"
+			  "\x60\x5d\x5a\xbb\xf4\xca\x8a\xc2"
+			  "\x28\xec\xb4\xca\xd4\x80\x19\x67"
+			  "\xb8\x8f\xc4\x87\x95\xc6\x51\xa4"
+			  "\xc3\x9f\x17\xd8\xc8\x41\x14\x61"
+			  "\xaf\xa1\x0e\x87\x3a\x8c\xa3\x1c"
+			  "\xee\x19\x9a\x01\x5f\xe8\xd5\xb2"
+			  "\xef\xc5\x55\x65\xe2\xc2\xcf\x5e"
+			  "\xa1\xd0\x25\x2a\xe6\x27\x3e\xfe"
+			  "\xb5\xad\x94\x68\x02\x0d\xd2\x8e"
+			  "\xaa\xe0\x0a\xbe\xeb\xf5\x24\x57"
+			  "\x39\x57\xfe\xd6\x0a\x05\x86\x28"
+			  "\x14\xca\x15\x4e\x45\xfd\x61\xad"
+			  "\x2b\x9e\xe4\x41\xa5\x3c\x1b\x0b"
+			  "\x7a\xc3\x8c\xc8\xaa\x40\x49\x39"
+			  "\x7b\x98\x7d\x7f\xaf\x08\x1b\x5f"
+			  "\xe0\xa4\xea\x7d\x69\xeb\x58\x32"
+			  "\x60\x83\x92\x94\x5c\x58\x5e\xc0"
+			  "\x2d\xa9\xe6\x3f\xed\xf3\x91\xe3"
+			  "\x38\xc1\x4e\x7c\xff\x62\x46\x2b"
+			  "\x72\xe9\xe3\x36\x19\x03\x0d\x20"
+			  "\xb2\xb1\xee\x9f\xbe\x01\x7c\xdb"
+			  "\x22\x15\xa9\xd8\x81\x45\xc9\x2b"
+			  "\x17\x82\x19\x3e\x4c\xfd\x78\x49"
+			  "\x2d\xc9\x24\x5f\xff\x73\xaf\x62"
+			  "\x59\x93\x1d\xe5\x0b\x97\x59\x51"
+			  "\xc2\x75\x5d\xa3\x24\x53\x60\x0b"
+			  "\xca\x0d\xbb\xbe\xa8\x8e\x99\xd7"
+			  "\x9f\x94\x5c\xa0\x67\xe3\x87\x22"
+			  "\x92\x6d\x36\xd8\x45\x64\x69\xf2"
+			  "\xf4\xe4\x4c\x37\x61\xbb\xe2\xd5"
+			  "\x64\x92\x37\x42\x26\x47\x5a\x81"
+			  "\xba\xe8\x91\xa1\x44\xf7\x09\x04"
+			  "\x12\xb8\xef\xdc\x5b\xd4\x53\x60"
+			  "\x1c\x70\x70\x28\x87\x23\xae\x39"
+			  "\x74\x69\x0c\x99\xa1\xa1\x4f\x09"
+			  "\x1c\xb9\x8f\x89\x77\x65\x52\x24"
+			  "\x6f\xd0\xd2\x85\x97\x2b\xc7\x31"
+			  "\x08\xc8\xa1\x09\xf4\xc7\xab\xfb"
+			  "\x0b\xa4\x16\xab\x67\x40\xf6\x42"
+			  "\x35\xe3\x58\xed\x3a\x53\xbf\x5f"
+			  "\x77\x3f\xfd\xd3\x53\x58\x1e\xeb"
+			  "\x13\x15\x80\xc1\xde\xa3\x1f\xf8"
+			  "\xf6\xfd\x0b\xab\xf8\xf6\x97\xc4"
+			  "\x4d\x9e\xb8\x26\x72\x2d\xb9\xc5"
+			  "\x0f\xdc\x73\x35\x2a\x60\xe6\x97"
+			  "\x07\x3d\x3a\xac\x9f\x29\x59\x18"
+			  "\xca\x4c\xcf\x1d\xfb\x2d\xd4\xbd"
+			  "\x81\x7d\xe0\x23\x32\xdc\x1e\x28"
+			  "\xca\xac\x86\xea\x1d\xd5\x5a\x89"
+			  "\x47\x34\xf9\xf8\x76\x70\x4d\x97"
+			  "\x20\xc7\x3a\x38\x5e\x47\x52\xfd"
+			  "\xff\x53\x6d\xd4\xa5\x92\xee\x90"
+			  "\xfe\x33\xfa\xe8\x94\xbf\xca\x2e"
+			  "\x10\xfc\xe6\x06\x38\x37\xda\x11"
+			  "\x69\x85\x14\xdc\xb8\xf9\xa8\x28"
+			  "\x5b\xfb\xeb\x37\x0b\x74\x1f\x64"
+			  "\x9c\xbe\xc4\xca\xda\x1e\x6d\x1a"
+			  "\x2d\x26\x92\xee\x04\x83\x88\xcc"
+			  "\xc0\xf7\x3c\x45\x60\x68\x73\x76"
+			  "\x3a\xb3\xc7\x70\x20\x47\x7f\x8b"
+			  "\x98\xd0\x92\xcf\x3c\x30\x6f\xe8"
+			  "\xca\x98\x83\x26\x66\x99\xde\x56"
+			  "\x84\x00\x1f\xf5\xa3\xcd\x50\xdf"
+			  "\xeb\x24\x78\xc0\xf1\xcd\xbc\x30"
+			  "\x9c\x7d\xa3\xdd\x9a\x98\x76\xe1"
+			  "\x45\x74\x74\x66\xef\x84\x0c\x65"
+			  "\xcd\x9b\x34\x85\x5c\xce\xbc\x22"
+			  "\xd3\x0c\xfc\x50\x79\xd8\x1a\x55"
+			  "\x27\x55\x1b\xe0\x12\x26\xa4\xa1"
+			  "\x7f\x20\x8d\x80\xcd\x20\xed\xa0"
+			  "\xc9\xd7\xc5\xe2\x4d\x99\x87\x8d"
+			  "\x81\x6e\x4f\xde\x72\xfb\xde\xbe"
+			  "\x14\xca\x51\x06\x71\xa2\x3b\x53"
+			  "\xc1\x63\xce\x7b\xac\x85\xb6\x38"
+			  "\xd3\x0f\x90\x9f\x71\x10\x05\xb8"
+			  "\x1d\x1d\x8a\xa7\x84\x2d\xb2\x2b"
+			  "\x0d\x7f\x3f\x97\x66\x46\x0b\x20"
+			  "\x9a\x6e\x66\x18\xd3\x38\x96\xa2"
+			  "\x24\xe3\x77\x97\xb8\x76\xe8\x62"
+			  "\x76\x41\xa4\x81\x05\x90\x30\x56"
+			  "\xa3\x11\x19\x04\x7c\x28\x44\xf8"
+			  "\xd8\xd8\x0d\xc7\x02\x80\x8f\xe9"
+			  "\x79\x1f\x38\xfd\x6d\x91\x8c\x5b"
+			  "\x35\x2e\x8b\x93\x5a\x8a\xce\xa3"
+			  "\xc1\x71\x3f\x44\xb0\x17\xfa\x8e"
+			  "\x99\x00\xe0\xc5\x1b\x94\x51\xfe"
+			  "\xd8\x60\x60\x61\xc7\xe8\x8b\x1b"
+			  "\xc6\x24\x29\x52\xa8\x9a\x6a\xd3"
+			  "\x74\xf6\x69\xe8\xc7\x95\xff\xcf"
+			  "\xc3\xb2\xce\x20\x67\x06\x65\x7e"
+			  "\xad\xe2\x47\x75\xf6\x77\xf3\x89"
+			  "\x24\x4a\xd5\x87\x08\x1c\x4d\x60"
+			  "\x7d\x95\x1d\xb2\x3d\x4f\xf1\xbf"
+			  "\x01\xb3\xca\x46\xd3\xa4\xce\xec"
+			  "\x5f\xd6\x3e\x6e\xe6\xb7\x1d\xfe"
+			  "\x72\x93\xc8\x08\x4b\x40\x32\x2b"
+			  "\x6b\x85\xda\xd8\x04\xa9\x5b\xdb"
+			  "\x76\x11\x1b\x9e\x8c\x4f\xa1\x9f"
+			  "\x50\x98\xfb\xbb\x9e\xcd\xe2\xa2"
+			  "\xcd\x2a\x29\xaf\x0d\xbf\xb1\x70"
+			  "\xf5\x57\xfc\x9a\xd1\xff\xe4\x21"
+			  "\x4c\xa4\xf1\x0d\x7f\x49\x18\x95"
+			  "\xe7\x10\x4e\x3c\x64\x7e\xd2\x81"
+			  "\xfb\x5b\x2e\x26\x75\x02\xf2\x7f"
+			  "\x4a\x45\xba\x1b\xa6\x53\x65\xd5"
+			  "\x84\x69\x66\x56\xef\xb8\x29\x03"
+			  "\xa1\xdb\xba\x91\x05\xf3\x7c\x41"
+			  "\xad\xa8\xc7\x93\xbb\x06\x2f\x68"
+			  "\x0b\xc4\xd0\x13\x2d\xf4\x70\xf8"
+			  "\xf7\x33\xd1\xf5\xe1\x6a\x81\xc7"
+			  "\x60\x29\xc8\x49\x19\x01\x12\xc0"
+			  "\x34\x24\x8f\x98\x5a\x55\x84\x29"
+			  "\xae\xd2\xb4\x0c\x84\xe1\x46\x4c"
+			  "\xce\xc0\xf1\x62\x8e\x86\x03\xfb"
+			  "\x20\xa0\x89\x19\xb4\x6b\xad\x29"
+			  "\xc9\xdc\xcc\xa6\xe4\x69\xf1\xed"
+			  "\xef\x0f\x75\xa7\x62\x63\xd8\xee"
+			  "\xdd\xd0\xca\x0f\x95\x28\xe4\x0b"
+			  "\x6e\x04\x30\x30\xca\x54\x07\x03"
+			  "\xa3\x1c\x2d\xbd\x92\xa6\xfc\xa1"
+			  "\xd5\x57\x62\x0c\xc6\x5e\x4b\x53"
+			  "\xbd\xd6\x19\x7b\x67\x2b\xf7\x0c"
+			  "\x04\x6a\x49\x54\x2b\x58\xc8\x0e"
+			  "\x9a\x7d\x94\xc5\xa5\xcb\xd9\x8b"
+			  "\x53\x51\xaf\x48\x1d\x43\xa0\x67"
+			  "\xec\x73\xc9\x57\x57\x48\xe7\x92"
+			  "\xca\x86\x22\x27\xd8\x6a\x90\xa4"
+			  "\x63\x5f\x16\x63\xa9\x4a\xc3\x6a"
+			  "\x90\x5c\xec\xfe\x0d\xa1\xff\x57"
+			  "\xf4\x53\x7c\x9f\x8e\x3c\xef\x29"
+			  "\x9d\x9e\x30\x30\xc0\x18\x4e\xd7"
+			  "\xd1\x8d\x14\x3b\x66\x6b\xb1\x36"
+			  "\x96\x02\x4b\x09\x2e\x24\x1c\x97"
+			  "\x9c\x3c\x69\xbc\x08\x37\x0d\x3d"
+			  "\x01\x52\x68\x8c\x28\xab\xb8\x75"
+			  "\x82\xf9\x42\xe0\x73\x97\xbf\xa8"
+			  "\x97\x84\xe1\x1e\xb0\x37\xfd\x87"
+			  "\xac\x5b\xf9\xe9\xea\x04\x4f\x67"
+			  "\x19\xfb\x07\x59\x39\xea\xae\xe0"
+			  "\x40\xde\xf2\x59\x1e\x1b\x90\x2f"
+			  "\x71\xa4\xa8\xfb\x3c\x56\xbd\xc8"
+			  "\xfb\xdd\x4f\x46\x6c\xe4\xef\xf7"
+			  "\x23\x22\x8e\xab\x50\x78\x35\xf8"
+			  "\xf7\xd5\x03\xf2\x4a\x69\xc8\xdf"
+			  "\x6c\x98\x20\xf9\x4f\xf1\x80\xb6"
+			  "\x43\x63\x87\xe8\x0c\x42\xb7\xbd"
+			  "\x85\xaf\x91\x9c\xc1\xfd\x30\xf4"
+			  "\x59\xd3\x94\x59\xfb\x22\xd9\x29"
+			  "\x4b\xf2\x89\x8d\x6f\xd7\xd4\x88"
+			  "\x30\xe5\x58\xe5\x10\xb3\x59\x28"
+			  "\x5a\x3f\xbe\x63\x24\xe4\xea\x59"
+			  "\xe5\x81\xc4\x21\xa7\x39\x37\x13"
+			  "\x00\x5b\xb6\x15\x94\xde\xe6\xa5"
+			  "\xbb\x1a\x47\x03\x9e\x81\x37\xca"
+			  "\xa7\xf7\x1b\x3d\x58\xc6\xfa\x99"
+			  "\xad\x76\x3e\x67\xf5\xd4\x75\xfd"
+			  "\x53\x7c\x03\x47\xe5\x7a\x14\xa2"
+			  "\x2f\x7a\x3e\xb9\x55\x28\xdd\x17"
+			  "\x56\x54\x7f\x4c\x70\x04\x07\xd6"
+			  "\x19\x0e\x59\x9a\xb8\x4c\xfc\xc7"
+			  "\xa8\xa4\x02\xe4\xdb\x08\xf1\x95"
+			  "\xf4\x21\xb4\x24\xd8\x9f\x26\xb6"
+			  "\xc7\x79\xed\x91\xce\x16\x62\x2d"
+			  "\xe1\xdf\xf8\xf3\x4d\x33\x83\x3b"
+			  "\x20\x29\x2c\xdd\x53\x30\x1b\xa2"
+			  "\x23\x0c\xe5\xf2\x9a\x2c\x56\x6e"
+			  "\x95\x50\x9c\x4a\xd0\x77\xa4\xcf"
+			  "\x5d\xde\xed\xa9\x3c\x46\x49\xec"
+			  "\xfb\x10\x5e\xac\x3f\x43\x4a\x75"
+			  "\x5c\xb8\x41\x6e\x1b\x68\xc1\xc9"
+			  "\xc8\x33\x41\x70\x55\x71\xe3\x03"
+			  "\x12\x9c\x81\xe7\xe8\xa5\xcf\x11"
+			  "\xa1\x41\x2f\xa2\x5d\x72\x4b\xab"
+			  "\x70\x2a\xd6\xc8\x99\xb5\x4a\x1d"
+			  "\xf3\xd4\x94\x1c\xe7\x61\x10\x43"
+			  "\xbe\x84\x51\x99\x87\x00\xd2\x16"
+			  "\x00\xe4\xa6\x19\xc8\xee\xef\x82"
+			  "\x78\x83\x72\xbb\x3c\x95\x0d\xac"
+			  "\xe5\xfe\x99\x2c\x50\xd9\xaf\x66"
+			  "\x22\x4e\xf1\x6a\x05\xda\xa3\x30"
+			  "\xa9\x7c\x74\x4e\x47\x02\xe5\x04"
+			  "\x16\x2b\x10\xf9\x9e\xd2\xf6\x3f"
+			  "\x16\x27\xca\x07\x00\x99\x6c\x1e"
+			  "\xb1\x1a\xe6\xb9\x1a\xa4\xcb\xce"
+			  "\x64\x07\x96\x95\x18\x12\x72\x9d"
+			  "\xd9\x42\x0f\xa6\x55\xf5\xb8\x42"
+			  "\x5a\x6d\xc3\xe2\x21\x8b\x93\x51"
+			  "\x24\x70\x09\x54\xd6\x71\x38\xfa"
+			  "\xb0\x06\x2a\x4c\x85\xa4\x28\xd2"
+			  "\x8f\xa4\x9f\x06\xfb\x71\x45\x2e"
+			  "\x6c\x2a\xcd\xde\x8b\x1b\x37\x71"
+			  "\x2f\x07\x60\x5c\xa8\x86\xb2\x73"
+			  "\x7e\x6d\x56\x33\x5a\xb5\x35\x2b"
+			  "\x70\xfd\x39\xec\x14\xc8\x0e\xd8"
+			  "\x80\xab\x63\xf4\x52\x53\x10\x72"
+			  "\x25\x23\x44\xbd\x58\x91\xa8\x2a"
+			  "\xb1\x91\x45\x06\xb6\xab\x98\x91"
+			  "\x3a\x5e\x95\x70\x94\xa4\xe8\xef"
+			  "\x5e\xf2\xb9\x5f\x04\xa3\x83\x92"
+			  "\x12\xbc\x4b\x80\xd8\xe4\x0a\xb3"
+			  "\x90\xc7\xb5\x84\x07\xc8\xc8\x9b"
+			  "\x29\x6c\x46\x4b\xdb\x3d\x3d\xb8"
+			  "\xc0\xc1\xc3\x89\xca\xf5\xd2\x81"
+			  "\x1f\x18\x0c\x3b\xd1\x4e\x2a\xbf"
+			  "\x91\xb4\x43\x6b\xcd\x2d\x47\xcf"
+			  "\x0f\xc0\xa4\x55\xe5\xbe\xfd\xc4"
+			  "\x51\xab\x65\xc7\x08\x51\x5a\x84"
+			  "\x99\xad\x46\x99\x3e\x8b\x43\xa8"
+			  "\x69\x76\x15\xd9\xd2\x75\x4e\x01"
+			  "\xd1\x17\xd5\xb0\x8c\xf6\x5a\xfe"
+			  "\x68\x79\xa9\x96\x7f\x05\xcd\xf2"
+			  "\x9c\xe6\xee\x5f\xc3\xf2\x96\x7e"
+			  "\x43\x74\x73\xe2\xa0\xe7\x17\x39"
+			  "\x20\x3b\x7c\xf5\x45\xb5\xf0\x67"
+			  "\x46\x7f\x23\xeb\x3b\x9b\x63\x82"
+			  "\x00\x19\xcd\x4e\xab\x9d\x64\xda"
+			  "\x49\x0a\xe5\xfa\x9d\x40\xcb\x27"
+			  "\x2d\x04\x2d\x44\x4b\x2c\x3b\xbd"
+			  "\x03\x33\x23\x0e\xa1\x66\x31\xad"
+			  "\x90\xee\xf0\x74\x4c\x53\x84\x32"
+			  "\x6c\xf7\xfa\x35\x10\x58\x36\x6c"
+			  "\x29\xfc\xc8\x29\x4b\xea\xae\xd4"
+			  "\x6a\x68\x6d\xa3\x49\xc4\x39\x60"
+			  "\x60\x14\xe2\x2e\x55\xc3\x9b\xea"
+			  "\xf5\xb1\x12\xd9\x5d\x22\x6a\x39"
+			  "\x7c\x20\xdc\x6d\xb0\x58\x03\xe3"
+			  "\x18\xe6\xa8\x69\x03\xfb\x51\x30"
+			  "\xf1\x51\xd6\xe4\xa6\xa2\x95\x8c"
+			  "\x06\x9f\x04\x50\x82\xbc\x9a\xfc"
+			  "\x8d\x31\x85\xbe\x56\xf8\xb2\xfe"
+			  "\x55\x05\xc5\xf0\x79\x33\x2a\x69"
+			  "\x52\xb0\x01\xde\x3e\xee\x93\x61"
+			  "\x61\x50\x36\x54\x22\x61\x09\x30"
+			  "\x7c\x1c\x15\xed\xc4\x2b\xc1\x08"
+			  "\xda\xd4\x08\x28\x82\xb2\xf9\x46"
+			  "\x27\x03\x78\x37\x54\x12\x83\x53"
+			  "\x36\x54\xe1\x91\x34\x17\xee\x5d"
+			  "\x59\x08\xed\xee\xc2\xd9\x70\x85"
+			  "\x02\xa3\xa9\xe9\x3b\xc9\x35\x55"
+			  "\x11\x04\xfd\x8d\x59\x79\x10\x8e"
+			  "\x64\x71\xfa\xf2\xd4\xc1\x5c\xdf"
+			  "\x4f\x3c\xfb\x91\x35\xe2\x50\xec"
+			  "\x5f\x48\x45\x16\xaa\x05\x6b\x8b"
+			  "\x84\x0a\x6e\x44\xc3\x1d\xaf\xff"
+			  "\x72\x02\x1d\x02\x86\x9f\xd7\xb2"
+			  "\xfe\x24\xe7\xcd\xe7\x27\xa5\xa3"
+			  "\x63\xeb\x6e\x7e\x6b\x8c\x20\x1b"
+			  "\xcf\x8c\x21\xdb\x22\x47\xe1\x03"
+			  "\xbf\xfe\x55\x76\xff\xff\x39\x9d"
+			  "\x73\x37\x79\x78\xb8\xe0\x5f\x9e"
+			  "\x4c\x31\xe3\x68\x76\x7e\x96\xd0"
+			  "\x57\x71\xce\x47\x8a\xdc\xe9\x9f"
+			  "\xc3\xae\xb7\x7a\x91\x91\x51\x55"
+			  "\x9f\x56\x2a\x15\x7c\xa6\x8b\xb4"
+			  "\xb1\x28\x9c\x2d\xdf\x05\xc2\x3d"
+			  "\xb1\xd2\x45\xd4\xa1\xa7\xc5\x67"
+			  "\xa9\x97\x15\xb1\xe6\xce\x5d\x75"
+			  "\xb8\x0c\x06\xe6\x06\xb2\x31\x94"
+			  "\xe6\x81\x1c\xaa\x65\xd3\x22\xfd"
+			  "\x1e\x8f\x92\x28\x69\x57\x5e\xfc"
+			  "\x02\x4b\x10\x7a\xc4\xa8\x7a\x74"
+			  "\x48\x1d\xa6\xb4\xf4\x9e\x79\xfe"
+			  "\x5a\x22\x5d\x67\x4a\x6b\x7d\x5c"
+			  "\x14\x61\xe2\xf4\xdd\x8f\x68\x22"
+			  "\x95\xc4\x78\xbe\x60\x03\x9f\x87"
+			  "\xd3\x5b\x1b\x1d\x48\xd8\x98\x03"
+			  "\x4e\x2c\x3b\x27\xfa\xb8\x49\x57"
+			  "\x9c\xd6\xde\xc6\xde\x5f\x5c\xc9"
+			  "\x08\x4b\xea\x2c\xf6\x0d\x89\xfb"
+			  "\xe3\x4a\x3b\x4e\xd9\x7a\xc3\xf7"
+			  "\x4d\x0f\xec\xd6\x1a\xcd\xea\x18"
+			  "\xd1\x8e\x9d\xe2\xba\x36\x3e\xb6"
+			  "\xe7\x8e\xec\x73\x17\x77\xe3\x7e"
+			  "\xb5\x75\x1a\x91\x2d\x97\x01\x5e"
+			  "\x73\x14\x6d\x06\x55\xec\x31\x87"
+			  "\x62\xda\x44\x31\x2e\x17\x6d\x66"
+			  "\x9a\x56\xf8\xf2\xdb\x18\x77\xca"
+			  "\x98\x7d\xd3\x5e\x27\x83\x1b\x2d"
+			  "\x60\xf7\x9a\xdd\xcd\xa4\xba\x98"
+			  "\x4a\x93\x33\xf3\x78\xdc\x9f\x48"
+			  "\xfc\x68\x96\xa9\x27\x59\x4a\x71"
+			  "\x88\x7a\x98\x5f\x13\xb5\x6f\xa2"
+			  "\x8e\x2d\xa2\x99\x42\x51\x49\x0a"
+			  "\x12\x9f\x1e\x28\x94\xda\x0f\x3e"
+			  "\xaf\x42\x51\xf0\xc8\x25\xe8\x95"
+			  "\xc5\x85\xec\x59\x00\xae\x1d\x19"
+			  "\xe9\x42\x85\x9b\x86\xd6\x4b\xdd"
+			  "\x52\x88\x96\x4a\xcc\x5c\x29\x3c"
+			  "\x72\xee\x3e\xd1\x6c\x59\xcb\x69"
+			  "\x85\x33\x80\x2d\xc2\x7f\xb8\xef"
+			  "\x40\xf9\x1e\xf0\x18\xd2\xae\x87"
+			  "\xab\x4a\x86\x85\xf7\x8b\x0e\x1f"
+			  "\xc6\x3b\xbc\x5b\x4b\xa1\x55\x91"
+			  "\xa1\x72\x36\x5d\xcf\x95\x18\x59"
+			  "\x39\x12\xfd\x96\x4a\xdd\x54\xb5"
+			  "\x7f\xb4\x43\xf8\x30\xf3\x85\x0b"
+			  "\xe4\x2a\x48\x18\x21\x6f\x5c\x98"
+			  "\xe7\x6a\x1d\x5c\xae\x20\x88\xda"
+			  "\x68\x48\x44\x24\x72\x67\x81\x88"
+			  "\xa2\x46\x4f\x94\xa4\x3a\x0a\xf7"
+			  "\xb9\xc3\x45\xdb\x21\xe1\x10\x08"
+			  "\xf0\xfe\x3a\x5d\x0a\x52\x30\x0f"
+			  "\xac\x5e\xa3\x9f\xe0\x74\xae\x0a"
+			  "\x27\x44\x45\xec\xbf\xa5\x4b\x57"
+			  "\x7c\xe6\x34\xec\x72\x5e\xc6\x6e"
+			  "\x9b\x59\x40\xcb\x4b\x5e\xbf\xff"
+			  "\xb1\xbb\x51\x6a\x34\xf2\x92\x38"
+			  "\xd7\xa9\x67\x20\xe8\x2f\xb4\x92"
+			  "\x91\xd8\x17\x19\x17\x6d\xf0\xe8"
+			  "\x9e\xe4\x35\xaf\xae\x88\x0b\x0c"
+			  "\xbd\x63\xaa\xcf\x05\x9c\x22\x2d"
+			  "\xa2\xc8\x9e\xd5\xb3\xb6\x5a\x18"
+			  "\xbb\x52\x7d\x93\x11\xf9\xf4\xb6"
+			  "\xb8\x59\x82\x8e\x48\x8d\x72\x11"
+			  "\xdf\x64\xb8\x91\xdf\x10\x19\x7f"
+			  "\x91\x0b\x28\x8b\x95\x59\xdf\x82"
+			  "\x62\x3c\x23\xc2\xc1\x5e\xee\x90"
+			  "\x0c\x62\x96\xba\xda\xa3\x4b\x29"
+			  "\x3d\xfc\xbb\x0f\xfc\x62\x9f\x0a"
+			  "\x3e\xa1\xe7\x26\x95\xa9\x0b\xf4"
+			  "\xb8\x4d\x3c\x59\xef\x8b\x25\xa3"
+			  "\x40\x94\x12\xc9\xca\x33\xc5\x63"
+			  "\x35\x60\xb7\x60\x49\x6a\x44\x0f"
+			  "\xa6\x98\xcc\xb5\x9b\x34\x45\x64"
+			  "\xee\x56\x5a\x0e\x23\x34\x6b\x13"
+			  "\x87\xa4\xea\xba\x49\x6d\x33\x6f"
+			  "\xe7\xb6\xbc\x59\x88\x01\x18\x4c"
+			  "\xf6\x62\xe4\x82\x9f\xef\x47\xcb"
+			  "\x7a\x64\x47\xf5\x78\x2d\x35\x21"
+			  "\x1b\x7b\xba\x4b\x5e\x02\x64\x1e"
+			  "\xc9\x40\x14\xe2\x5f\x10\x02\xe7"
+			  "\xad\x15\xa8\x1f\x70\xcd\xad\x41"
+			  "\xb1\xcd\xa2\x5a\x29\x99\x5e\x6b"
+			  "\x87\x10\x3b\x0b\xb6\x55\x92\xea"
+			  "\x1f\x02\x0a\xde\x75\xb4\xd2\xf7"
+			  "\x6f\x70\xbb\x51\x44\xcd\x87\xcf"
+			  "\x37\x33\x43\x88\xbc\xc3\x57\xc8"
+			  "\x8f\x8d\xed\x3b\x0e\x04\xba\x28"
+			  "\xd8\x75\x56\x84\xcf\xc4\xd1\x0b"
+			  "\xbf\x1e\x76\xbd\xc6\xe4\xcb\xfe"
+			  "\x6b\x8e\x07\x5b\x29\x8b\xd7\xef"
+			  "\xbc\xa0\xee\xc8\xcc\x39\xf3\x43"
+			  "\x34\x6d\x7f\x74\x09\x0a\x8f\xfc"
+			  "\xda\x60\xb8\x2d\x31\x54\x70\xa1"
+			  "\xec\x16\x60\x81\x4a\xd4\x95\x15"
+			  "\x3a\x16\xb0\xd5\x45\x22\x94\x86"
+			  "\x1d\x31\xd7\x9d\xa0\x6d\x88\xbf"
+			  "\xa6\x13\x85\xd6\x09\x6c\x4c\xb1"
+			  "\x04\xf0\x4e\x4e\x22\xa2\xc4\x40"
+			  "\xf8\xc7\xe8\xb4\xa0\x0a\x9f\x9f"
+			  "\x50\x2c\xf7\x84\x0b\x70\x46\x2d"
+			  "\x9c\x0e\xc3\x98\x68\x64\x80\xa0"
+			  "\x09\x34\x6b\x79\x6a\x61\x38\x4f"
+			  "\x89\x06\xca\x7f\x4d\x24\xe3\x25"
+			  "\xcf\x64\x97\x8d\xef\x51\x55\x66"
+			  "\xab\x13\xda\x95\xfb\xfa\x51\x9d"
+			  "\x04\xe8\x57\x3f\x71\xf9\xe0\x05"
+			  "\x97\x57\x07\x23\x2e\x1c\x21\xfc"
+			  "\xe9\x88\x8c\xb8\x28\x61\x23\xb5"
+			  "\xad\x04\x74\xa8\x47\x6d\x6a\xa4"
+			  "\xda\x3c\x3f\x4c\x35\xde\xd3\x75"
+			  "\xc1\x4e\xb2\x74\xb2\x7d\xe0\xff"
+			  "\xe9\x7b\x2e\x5d\x74\xde\x4d\x74"
+			  "\xec\x23\xdc\xb8\x6f\xf2\x67\xc5"
+			  "\xcc\xf7\x95\xfe\xef\x7b\x4a\x75"
+			  "\xec\xc9\x23\xd9\x58\x3f\x21\x30"
+			  "\x13\x8c\x9a\x41\xac\x59\x36\xd6"
+			  "\x14\xbd\xb3\x6a\x45\x1a\x05\xb6"
+			  "\x2b\xc3\x12\xbb\x5e\xf8\x6f\x1f"
+			  "\x10\x50\x2c\xe1\x42\x55\x84\xb6"
+			  "\x4e\x01\x20\xfd\x83\x02\x98\x8b"
+			  "\xfc\xa8\xe2\xab\xae\xbb\x8b\xf8"
+			  "\xb0\x7a\xca\xea\xfc\xad\x24\x42"
+			  "\xc6\xa2\x68\x84\x71\xa5\x28\xb2"
+			  "\x4d\xd5\xc0\x0f\x37\xbf\x01\x7a"
+			  "\x10\x44\x18\x4e\x98\xe7\x41\x64"
+			  "\xe1\x84\xa7\xf9\x5c\xaa\xe7\x75"
+			  "\x2f\xec\xce\xbe\xa2\x0e\xf5\xce"
+			  "\x9c\xcd\x1e\x71\xec\xcf\xf7\x0c"
+			  "\x53\x36\x3f\xa3\x84\x61\x17\xaa"
+			  "\x44\x6c\xe1\xff\xda\xdf\x4c\x0e"
+			  "\x15\xbe\xae\xab\xb8\x3c\xe2\x8a"
+			  "\x5f\xdc\x11\xbc\xa3\x3f\xa7\xf5"
+			  "\x88\xc7\x96\x00\x20\x18\x20\xb3"
+			  "\xfa\x00\x8d\x6f\xa8\xd0\xf1\x52"
+			  "\x78\xcc\xa2\x79\x3f\x91\x9b\xb4"
+			  "\xb1\x8f\x77\x93\x02\xa8\xbe\xa0"
+			  "\xba\xf4\xc6\xe8\x54\x5a\x64\x85"
+			  "\xc9\xae\x56\x6c\x6a\xf5\x2e\x4d"
+			  "\x7d\xc8\xdd\x4d\xd0\x89\xb3\x92"
+			  "\xcb\xe6\xcb\x18\xbe\x88\x22\x67"
+			  "\xf6\x88\xec\xa0\x41\x2a\xab\x9d"
+			  "\xef\xc7\x5c\x63\x80\xb2\x93\x9f"
+			  "\x38\x0b\x7b\x1b\x58\x60\x62\x97"
+			  "\x57\xbd\x16\x40\xe4\x95\x25\x58"
+			  "\x97\x89\xf8\xb6\x50\xe2\xcb\xc9"
+			  "\xf7\xe9\x83\x90\xb8\xf6\xe4\x97"
+			  "\x6f\x4c\x40\x05\xf1\xeb\x03\x77"
+			  "\x0f\x62\x54\x52\x2d\x50\xf9\x8a"
+			  "\xed\x84\x64\xe9\xa3\x2f\x0e\x08"
+			  "\xb3\x40\x17\x26\x77\x5a\x4e\xe8"
+			  "\xc7\x43\x8f\xb6\xdf\x06\x86\x26"
+			  "\x09\x06\x35\x15\xdb\xf8\x3c\xb9"
+			  "\x9a\xee\xcf\x30\x1c\xea\xf2\x2d"
+			  "\x21\x1e\x33\x6e\x71\x5f\x51\xeb"
+			  "\x58\x5b\xce\x6d\x30\x7a\x54\xf1"
+			  "\x56\x39\xd8\x2f\x7c\x76\xa9\x5c"
+			  "\x81\x44\x38\xf6\x16\x2a\x34\x1d"
+			  "\xf7\x91\x69\xa7\xc7\xa0\x0c\xa9"
+			  "\x3c\xa2\xa5\xc3\xcc\xad\xbd\x10"
+			  "\x8a\xf5\xc4\x0a\x6e\x29\x2e\x0b"
+			  "\xe3\xb4\x17\xc2\x4b\x6a\xc6\x6e"
+			  "\x2a\x51\x03\xfc\x73\xaa\x3d\x0f"
+			  "\x49\x5c\x61\x5d\xe1\x29\xad\x1c"
+			  "\x9d\x9d\xa0\x30\x3f\x6f\xc4\x5d"
+			  "\xb6\x2a\x70\x68\xd7\x44\xba\xa0"
+			  "\x43\x01\x8f\x96\x9a\x91\x67\x09"
+			  "\xdd\xe1\x48\xef\x89\x90\x0d\xa8"
+			  "\x46\x10\x15\x9d\xa3\x05\xc0\xc6"
+			  "\x93\xe3\x10\xa0\xdb\xac\x21\x8c"
+			  "\x02\xb6\xcc\x83\x09\x8b\xd3\x83"
+			  "\xfe\xd4\xf1\x3d\x76\x80\x74\xa7"
+			  "\x5a\x65\x41\x02\xd2\x9d\x47\x7a"
+			  "\x43\xbd\x92\xa7\x26\x59\xda\x54"
+			  "\xca\xf8\x89\x5b\x78\xae\xc0\xc4"
+			  "\x60\x32\x19\xd7\x29\xd1\xdb\xc3"
+			  "\x42\x72\x52\x15\x94\x9c\x1c\xa8"
+			  "\x58\xb3\x6c\x58\x8b\x44\x1a\x00"
+			  "\x5e\x26\xb4\xb8\x1a\xfc\x36\xc2"
+			  "\x18\x66\xdb\x54\x5b\xe2\xca\xd2"
+			  "\x45\xe1\x15\x68\x7c\xb0\x05\x87"
+			  "\x25\x18\x02\xa7\x76\x4b\x93\x71"
+			  "\x97\x71\xa5\xa8\x56\x39\xb8\xad"
+			  "\x15\xe3\x07\x4a\x3b\x5b\x35\xd8"
+			  "\xca\x79\xa4\xab\x2a\x9d\x1d\x04"
+			  "\xc7\x1a\x88\x8a\x2f\xb9\xd1\x33"
+			  "\xca\x55\x33\x59\x23\x37\x1b\xa8"
+			  "\xaa\x67\xa9\xf6\x01\x3b\xd5\x7c"
+			  "\xa5\x41\x90\x0e\x1a\xeb\x69\x8d"
+			  "\x6a\x72\xb5\xfb\x24\xf4\x9e\x90"
+			  "\x50\xfe\xaf\x7f\x15\xdb\xe8\x88"
+			  "\x30\xfc\xdf\x7a\xd9\xf8\x63\x8f"
+			  "\x1d\x53\xad\x15\x1a\xe7\x15\x25"
+			  "\xc6\xe2\x1d\x7a\x23\x7d\x34\x12"
+			  "\xc1\x8e\x74\x32\x9d\x59\xf2\x3b"
+			  "\x23\x67\xe0\x4b\xd3\xdb\x35\x45"
+			  "\x9a\x2e\xca\x9c\x60\x97\xe3\xa7"
+			  "\xdd\xe8\x23\x86\xb5\x0c\x19\x3e"
+			  "\x61\x48\x4b\xf9\x1e\x16\x0e\x30"
+			  "\x69\x10\xf5\x79\xa1\x15\xab\xae"
+			  "\x2e\x35\x8e\xf1\xa9\x92\x85\x8a"
+			  "\x1d\xfd\x6a\xb2\x99\x41\x40\xea"
+			  "\x0a\x19\xf7\xdf\xd9\xff\xf2\x10"
+			  "\xbb\x75\xcf\xf8\xcf\xf9\xbc\xf8"
+			  "\xd3\x4c\xba\x12\xce\xa0\x05\x2b"
+			  "\x8d\xd5\xce\xf5\xe3\xf2\x5f\xc9"
+			  "\x42\xc8\x64\x1e\xe4\x9b\x27\xf7"
+			  "\x56\x3b\xcf\x8a\x2e\x7a\x41\xf9"
+			  "\x2b\x24\x8c\x18\x21\xe2\x9c\x1a"
+			  "\x6b\x89\x7e\x8c\x7c\xb1\x41\xae"
+			  "\xe9\x78\xe2\x12\x76\x3c\x67\x44"
+			  "\xb5\x48\xdb\x93\xe8\x22\x32\x22"
+			  "\x5c\x16\xf3\xea\x6b\x2e\xa4\x98"
+			  "\x45\x94\xda\xbe\x92\xab\xd0\xe8"
+			  "\x67\x3c\x11\xf7\x8d\x80\xbf\xfe"
+			  "\xe3\xa2\x55\xad\xa4\xda\xfa\x18"
+			  "\x77\x84\x6d\x0b\xb0\x48\x93\xcb"
+			  "\x67\xcb\x1a\x0e\xea\x69\xcc\x11"
+			  "\xd8\x31\x8c\x5b\xd8\x00\x64\x7e"
+			  "\xcb\xef\x9c\xaf\xbf\xf8\x68\xe7"
+			  "\x26\xe0\x2d\xf4\x04\x6c\xe4\x07"
+			  "\x52\x95\x9c\x90\x94\xaf\x65\x6e"
+			  "\x10\x0b\x75\xef\x29\x0e\x0b\x6a"
+			  "\x50\xdb\xe4\xf5\x38\x63\xec\x0f"
+			  "\xce\x2b\x3e\xa8\xe4\xd4\x1c\xf5"
+			  "\x7f\x06\x5d\x62\xa8\xdc\x78\xb7"
+			  "\x4c\x41\xc3\x46\x86\x59\x2c\xfd"
+			  "\x5f\xf1\x5e\x1a\xeb\x1f\x91\xea",
+		.len	= 8192,
+	}, { /* 8 units of 512 bytes, the sector wraps around */
+		.key	= "\x07\x1a\x2d\x40\x53\x66\x79\x8c"
+			  "\x9f\xb2\xc5\xd8\xeb\xfe\x11\x24"
+			  "\x37\x4a\x5d\x70\x83\x96\xa9\xbc"
+			  "\xcf\xe2\xf5\x08\x1b\x2e\x41\x54"
+			  "\x67\x7a\x8d\xa0\xb3\xc6\xd9\xec"
+			  "\xff\x12\x25\x38\x4b\x5e\x71\x84"
+			  "\x97\xaa\xbd\xd0\xe3\xf6\x09\x1c"
+			  "\x2f\x42\x55\x68\x7b\x8e\xa1\xb4",
+		.klen	= 64,
+		.iv	= "\xfd\xff\xff\xff\xff\xff\xff\xff"
+			  "\x09\x00\x00\x00\x00\x00\x00\x00",
+		.ptext	= "\x00\x03\x06\x09\x0c\x0f\x12\x15"
+			  "\x18\x1b\x1e\x21\x24\x27\x2a\x2d"
+			  "\x30\x33\x36\x39\x3c\x3f\x42\x45"
+			  "\x48\x4b\x4e\x51\x54\x57\x5a\x5d"
+			  "\x60\x63\x66\x69\x6c\x6f\x72\x75"
+			  "\x78\x7b\x7e\x81\x84\x87\x8a\x8d"
+			  "\x90\x93\x96\x99\x9c\x9f\xa2\xa5"
+			  "\xa8\xab\xae\xb1\xb4\xb7\xba\xbd"
+			  "\xc5\xc8\xcb\xce\xd1\xd4\xd7\xda"
+			  "\xdd\xe0\xe3\xe6\xe9\xec\xef\xf2"
+			  "\xf5\xf8\xfb\xfe\x01\x04\x07\x0a"
+			  "\x0d\x10\x13\x16\x19\x1c\x1f\x22"
+			  "\x25\x28\x2b\x2e\x31\x34\x37\x3a"
+			  "\x3d\x40\x43\x46\x49\x4c\x4f\x52"
+			  "\x55\x58\x5b\x5e\x61\x64\x67\x6a"
+			  "\x6d\x70\x73\x76\x79\x7c\x7f\x82"
+			  "\x8a\x8d\x90\x93\x96\x99\x9c\x9f"
+			  "\xa2\xa5\xa8\xab\xae\xb1\xb4\xb7"
+			  "\xba\xbd\xc0\xc3\xc6\xc9\xcc\xcf"
+			  "\xd2\xd5\xd8\xdb\xde\xe1\xe4\xe7"
+			  "\xea\xed\xf0\xf3\xf6\xf9\xfc\xff"
+			  "\x02\x05\x08\x0b\x0e\x11\x14\x17"
+			  "\x1a\x1d\x20\x23\x26\x29\x2c\x2f"
+			  "\x32\x35\x38\x3b\x3e\x41\x44\x47"
+			  "\x4f\x52\x55\x58\x5b\x5e\x61\x64"
+			  "\x67\x6a\x6d\x70\x73\x76\x79\x7c"
+			  "\x7f\x82\x85\x88\x8b\x8e\x91\x94"
+			  "\x97\x9a\x9d\xa0\xa3\xa6\xa9\xac"
+			  "\xaf\xb2\xb5\xb8\xbb\xbe\xc1\xc4"
+			  "\xc7\xca\xcd\xd0\xd3\xd6\xd9\xdc"
+			  "\xdf\xe2\xe5\xe8\xeb\xee\xf1\xf4"
+			  "\xf7\xfa\xfd\x00\x03\x06\x09\x0c"
+			  "\x14\x17\x1a\x1d\x20\x23\x26\x29"
+			  "\x2c\x2f\x32\x35\x38\x3b\x3e\x41"
+			  "\x44\x47\x4a\x4d\x50\x53\x56\x59"
+			  "\x5c\x5f\x62\x65\x68\x6b\x6e\x71"
+			  "\x74\x77\x7a\x7d\x80\x83\x86\x89"
+			  "\x8c\x8f\x92\x95\x98\x9b\x9e\xa1"
+			  "\xa4\xa7\xaa\xad\xb0\xb3\xb6\xb9"
+			  "\xbc\xbf\xc2\xc5\xc8\xcb\xce\xd1"
+			  "\xd9\xdc\xdf\xe2\xe5\xe8\xeb\xee"
+			  "\xf1\xf4\xf7\xfa\xfd\x00\x03\x06"
+			  "\x09\x0c\x0f\x12\x15\x18\x1b\x1e"
+			  "\x21\x24\x27\x2a\x2d\x30\x33\x36"
+			  "\x39\x3c\x3f\x42\x45\x48\x4b\x4e"
+			  "\x51\x54\x57\x5a\x5d\x60\x63\x66"
+			  "\x69\x6c\x6f\x72\x75\x78\x7b\x7e"
+			  "\x81\x84\x87\x8a\x8d\x90\x93\x96"
+			  "\x9e\xa1\xa4\xa7\xaa\xad\xb0\xb3"
+			  "\xb6\xb9\xbc\xbf\xc2\xc5\xc8\xcb"
+			  "\xce\xd1\xd4\xd7\xda\xdd\xe0\xe3"
+			  "\xe6\xe9\xec\xef\xf2\xf5\xf8\xfb"
+			  "\xfe\x01\x04\x07\x0a\x0d\x10\x13"
+			  "\x16\x19\x1c\x1f\x22\x25\x28\x2b"
+			  "\x2e\x31\x34\x37\x3a\x3d\x40\x43"
+			  "\x46\x49\x4c\x4f\x52\x55\x58\x5b"
+			  "\x63\x66\x69\x6c\x6f\x72\x75\x78"
+			  "\x7b\x7e\x81\x84\x87\x8a\x8d\x90"
+			  "\x93\x96\x99\x9c\x9f\xa2\xa5\xa8"
+			  "\xab\xae\xb1\xb4\xb7\xba\xbd\xc0"
+			  "\xc3\xc6\xc9\xcc\xcf\xd2\xd5\xd8"
+			  "\xdb\xde\xe1\xe4\xe7\xea\xed\xf0"
+			  "\xf3\xf6\xf9\xfc\xff\x02\x05\x08"
+			  "\x0b\x0e\x11\x14\x17\x1a\x1d\x20"
+			  "\x28\x2b\x2e\x31\x34\x37\x3a\x3d"
+			  "\x40\x43\x46\x49\x4c\x4f\x52\x55"
+			  "\x58\x5b\x5e\x61\x64\x67\x6a\x6d"
+			  "\x70\x73\x76\x79\x7c\x7f\x82\x85"
+			  "\x88\x8b\x8e\x91\x94\x97\x9a\x9d"
+			  "\xa0\xa3\xa6\xa9\xac\xaf\xb2\xb5"
+			  "\xb8\xbb\xbe\xc1\xc4\xc7\xca\xcd"
+			  "\xd0\xd3\xd6\xd9\xdc\xdf\xe2\xe5"
+			  "\xed\xf0\xf3\xf6\xf9\xfc\xff\x02"
+			  "\x05\x08\x0b\x0e\x11\x14\x17\x1a"
+			  "\x1d\x20\x23\x26\x29\x2c\x2f\x32"
+			  "\x35\x38\x3b\x3e\x41\x44\x47\x4a"
+			  "\x4d\x50\x53\x56\x59\x5c\x5f\x62"
+			  "\x65\x68\x6b\x6e\x71\x74\x77\x7a"
+			  "\x7d\x80\x83\x86\x89\x8c\x8f\x92"
+			  "\x95\x98\x9b\x9e\xa1\xa4\xa7\xaa"
+			  "\xb2\xb5\xb8\xbb\xbe\xc1\xc4\xc7"
+			  "\xca\xcd\xd0\xd3\xd6\xd9\xdc\xdf"
+			  "\xe2\xe5\xe8\xeb\xee\xf1\xf4\xf7"
+			  "\xfa\xfd\x00\x03\x06\x09\x0c\x0f"
+			  "\x12\x15\x18\x1b\x1e\x21\x24\x27"
+			  "\x2a\x2d\x30\x33\x36\x39\x3c\x3f"
+			  "\x42\x45\x48\x4b\x4e\x51\x54\x57"
+			  "\x5a\x5d\x60\x63\x66\x69\x6c\x6f"
+			  "\x77\x7a\x7d\x80\x83\x86\x89\x8c"
+			  "\x8f\x92\x95\x98\x9b\x9e\xa1\xa4"
+			  "\xa7\xaa\xad\xb0\xb3\xb6\xb9\xbc"
+			  "\xbf\xc2\xc5\xc8\xcb\xce\xd1\xd4"
+			  "\xd7\xda\xdd\xe0\xe3\xe6\xe9\xec"
+			  "\xef\xf2\xf5\xf8\xfb\xfe\x01\x04"
+			  "\x07\x0a\x0d\x10\x13\x16\x19\x1c"
+			  "\x1f\x22\x25\x28\x2b\x2e\x31\x34"
+			  "\x3c\x3f\x42\x45\x48\x4b\x4e\x51"
+			  "\x54\x57\x5a\x5d\x60\x63\x66\x69"
+			  "\x6c\x6f\x72\x75\x78\x7b\x7e\x81"
+			  "\x84\x87\x8a\x8d\x90\x93\x96\x99"
+			  "\x9c\x9f\xa2\xa5\xa8\xab\xae\xb1"
+			  "\xb4\xb7\xba\xbd\xc0\xc3\xc6\xc9"
+			  "\xcc\xcf\xd2\xd5\xd8\xdb\xde\xe1"
+			  "\xe4\xe7\xea\xed\xf0\xf3\xf6\xf9"
+			  "\x01\x04\x07\x0a\x0d\x10\x13\x16"
+			  "\x19\x1c\x1f\x22\x25\x28\x2b\x2e"
+			  "\x31\x34\x37\x3a\x3d\x40\x43\x46"
+			  "\x49\x4c\x4f\x52\x55\x58\x5b\x5e"
+			  "\x61\x64\x67\x6a\x6d\x70\x73\x76"
+			  "\x79\x7c\x7f\x82\x85\x88\x8b\x8e"
+			  "\x91\x94\x97\x9a\x9d\xa0\xa3\xa6"
+			  "\xa9\xac\xaf\xb2\xb5\xb8\xbb\xbe"
+			  "\xc6\xc9\xcc\xcf\xd2\xd5\xd8\xdb"
+			  "\xde\xe1\xe4\xe7\xea\xed\xf0\xf3"
+			  "\xf6\xf9\xfc\xff\x02\x05\x08\x0b"
+			  "\x0e\x11\x14\x17\x1a\x1d\x20\x23"
+			  "\x26\x29\x2c\x2f\x32\x35\x38\x3b"
+			  "\x3e\x41\x44\x47\x4a\x4d\x50\x53"
+			  "\x56\x59\x5c\x5f\x62\x65\x68\x6b"
+			  "\x6e\x71\x74\x77\x7a\x7d\x80\x83"
+			  "\x8b\x8e\x91\x94\x97\x9a\x9d\xa0"
+			  "\xa3\xa6\xa9\xac\xaf\xb2\xb5\xb8"
+			  "\xbb\xbe\xc1\xc4\xc7\xca\xcd\xd0"
+			  "\xd3\xd6\xd9\xdc\xdf\xe2\xe5\xe8"
+			  "\xeb\xee\xf1\xf4\xf7\xfa\xfd\x00"
+			  "\x03\x06\x09\x0c\x0f\x12\x15\x18"
+			  "\x1b\x1e\x21\x24\x27\x2a\x2d\x30"
+			  "\x33\x36\x39\x3c\x3f\x42\x45\x48"
+			  "\x50\x53\x56\x59\x5c\x5f\x62\x65"
+			  "\x68\x6b\x6e\x71\x74\x77\x7a\x7d"
+			  "\x80\x83\x86\x89\x8c\x8f\x92\x95"
+			  "\x98\x9b\x9e\xa1\xa4\xa7\xaa\xad"
+			  "\xb0\xb3\xb6\xb9\xbc\xbf\xc2\xc5"
+			  "\xc8\xcb\xce\xd1\xd4\xd7\xda\xdd"
+			  "\xe0\xe3\xe6\xe9\xec\xef\xf2\xf5"
+			  "\xf8\xfb\xfe\x01\x04\x07\x0a\x0d"
+			  "\x15\x18\x1b\x1e\x21\x24\x27\x2a"
+			  "\x2d\x30\x33\x36\x39\x3c\x3f\x42"
+			  "\x45\x48\x4b\x4e\x51\x54\x57\x5a"
+			  "\x5d\x60\x63\x66\x69\x6c\x6f\x72"
+			  "\x75\x78\x7b\x7e\x81\x84\x87\x8a"
+			  "\x8d\x90\x93\x96\x99\x9c\x9f\xa2"
+			  "\xa5\xa8\xab\xae\xb1\xb4\xb7\xba"
+			  "\xbd\xc0\xc3\xc6\xc9\xcc\xcf\xd2"
+			  "\xda\xdd\xe0\xe3\xe6\xe9\xec\xef"
+			  "\xf2\xf5\xf8\xfb\xfe\x01\x04\x07"
+			  "\x0a\x0d\x10\x13\x16\x19\x1c\x1f"
+			  "\x22\x25\x28\x2b\x2e\x31\x34\x37"
+			  "\x3a\x3d\x40\x43\x46\x49\x4c\x4f"
+			  "\x52\x55\x58\x5b\x5e\x61\x64\x67"
+			  "\x6a\x6d\x70\x73\x76\x79\x7c\x7f"
+			  "\x82\x85\x88\x8b\x8e\x91\x94\x97"
+			  "\x9f\xa2\xa5\xa8\xab\xae\xb1\xb4"
+			  "\xb7\xba\xbd\xc0\xc3\xc6\xc9\xcc"
+			  "\xcf\xd2\xd5\xd8\xdb\xde\xe1\xe4"
+			  "\xe7\xea\xed\xf0\xf3\xf6\xf9\xfc"
+			  "\xff\x02\x05\x08\x0b\x0e\x11\x14"
+			  "\x17\x1a\x1d\x20\x23\x26\x29\x2c"
+			  "\x2f\x32\x35\x38\x3b\x3e\x41\x44"
+			  "\x47\x4a\x4d\x50\x53\x56\x59\x5c"
+			  "\x64\x67\x6a\x6d\x70\x73\x76\x79"
+			  "\x7c\x7f\x82\x85\x88\x8b\x8e\x91"
+			  "\x94\x97\x9a\x9d\xa0\xa3\xa6\xa9"
+			  "\xac\xaf\xb2\xb5\xb8\xbb\xbe\xc1"
+			  "\xc4\xc7\xca\xcd\xd0\xd3\xd6\xd9"
+			  "\xdc\xdf\xe2\xe5\xe8\xeb\xee\xf1"
+			  "\xf4\xf7\xfa\xfd\x00\x03\x06\x09"
+			  "\x0c\x0f\x12\x15\x18\x1b\x1e\x21"
+			  "\x29\x2c\x2f\x32\x35\x38\x3b\x3e"
+			  "\x41\x44\x47\x4a\x4d\x50\x53\x56"
+			  "\x59\x5c\x5f\x62\x65\x68\x6b\x6e"
+			  "\x71\x74\x77\x7a\x7d\x80\x83\x86"
+			  "\x89\x8c\x8f\x92\x95\x98\x9b\x9e"
+			  "\xa1\xa4\xa7\xaa\xad\xb0\xb3\xb6"
+			  "\xb9\xbc\xbf\xc2\xc5\xc8\xcb\xce"
+			  "\xd1\xd4\xd7\xda\xdd\xe0\xe3\xe6"
+			  "\xee\xf1\xf4\xf7\xfa\xfd\x00\x03"
+			  "\x06\x09\x0c\x0f\x12\x15\x18\x1b"
+			  "\x1e\x21\x24\x27\x2a\x2d\x30\x33"
+			  "\x36\x39\x3c\x3f\x42\x45\x48\x4b"
+			  "\x4e\x51\x54\x57\x5a\x5d\x60\x63"
+			  "\x66\x69\x6c\x6f\x72\x75\x78\x7b"
+			  "\x7e\x81\x84\x87\x8a\x8d\x90\x93"
+			  "\x96\x99\x9c\x9f\xa2\xa5\xa8\xab"
+			  "\xb3\xb6\xb9\xbc\xbf\xc2\xc5\xc8"
+			  "\xcb\xce\xd1\xd4\xd7\xda\xdd\xe0"
+			  "\xe3\xe6\xe9\xec\xef\xf2\xf5\xf8"
+			  "\xfb\xfe\x01\x04\x07\x0a\x0d\x10"
+			  "\x13\x16\x19\x1c\x1f\x22\x25\x28"
+			  "\x2b\x2e\x31\x34\x37\x3a\x3d\x40"
+			  "\x43\x46\x49\x4c\x4f\x52\x55\x58"
+			  "\x5b\x5e\x61\x64\x67\x6a\x6d\x70"
+			  "\x78\x7b\x7e\x81\x84\x87\x8a\x8d"
+			  "\x90\x93\x96\x99\x9c\x9f\xa2\xa5"
+			  "\xa8\xab\xae\xb1\xb4\xb7\xba\xbd"
+			  "\xc0\xc3\xc6\xc9\xcc\xcf\xd2\xd5"
+			  "\xd8\xdb\xde\xe1\xe4\xe7\xea\xed"
+			  "\xf0\xf3\xf6\xf9\xfc\xff\x02\x05"
+			  "\x08\x0b\x0e\x11\x14\x17\x1a\x1d"
+			  "\x20\x23\x26\x29\x2c\x2f\x32\x35"
+			  "\x3d\x40\x43\x46\x49\x4c\x4f\x52"
+			  "\x55\x58\x5b\x5e\x61\x64\x67\x6a"
+			  "\x6d\x70\x73\x76\x79\x7c\x7f\x82"
+			  "\x85\x88\x8b\x8e\x91\x94\x97\x9a"
+			  "\x9d\xa0\xa3\xa6\xa9\xac\xaf\xb2"
+			  "\xb5\xb8\xbb\xbe\xc1\xc4\xc7\xca"
+			  "\xcd\xd0\xd3\xd6\xd9\xdc\xdf\xe2"
+			  "\xe5\xe8\xeb\xee\xf1\xf4\xf7\xfa"
+			  "\x02\x05\x08\x0b\x0e\x11\x14\x17"
+			  "\x1a\x1d\x20\x23\x26\x29\x2c\x2f"
+			  "\x32\x35\x38\x3b\x3e\x41\x44\x47"
+			  "\x4a\x4d\x50\x53\x56\x59\x5c\x5f"
+			  "\x62\x65\x68\x6b\x6e\x71\x74\x77"
+			  "\x7a\x7d\x80\x83\x86\x89\x8c\x8f"
+			  "\x92\x95\x98\x9b\x9e\xa1\xa4\xa7"
+			  "\xaa\xad\xb0\xb3\xb6\xb9\xbc\xbf"
+			  "\xc7\xca\xcd\xd0\xd3\xd6\xd9\xdc"
+			  "\xdf\xe2\xe5\xe8\xeb\xee\xf1\xf4"
+			  "\xf7\xfa\xfd\x00\x03\x06\x09\x0c"
+			  "\x0f\x12\x15\x18\x1b\x1e\x21\x24"
+			  "\x27\x2a\x2d\x30\x33\x36\x39\x3c"
+			  "\x3f\x42\x45\x48\x4b\x4e\x51\x54"
+			  "\x57\x5a\x5d\x60\x63\x66\x69\x6c"
+			  "\x6f\x72\x75\x78\x7b\x7e\x81\x84"
+			  "\x8c\x8f\x92\x95\x98\x9b\x9e\xa1"
+			  "\xa4\xa7\xaa\xad\xb0\xb3\xb6\xb9"
+			  "\xbc\xbf\xc2\xc5\xc8\xcb\xce\xd1"
+			  "\xd4\xd7\xda\xdd\xe0\xe3\xe6\xe9"
+			  "\xec\xef\xf2\xf5\xf8\xfb\xfe\x01"
+			  "\x04\x07\x0a\x0d\x10\x13\x16\x19"
+			  "\x1c\x1f\x22\x25\x28\x2b\x2e\x31"
+			  "\x34\x37\x3a\x3d\x40\x43\x46\x49"
+			  "\x51\x54\x57\x5a\x5d\x60\x63\x66"
+			  "\x69\x6c\x6f\x72\x75\x78\x7b\x7e"
+			  "\x81\x84\x87\x8a\x8d\x90\x93\x96"
+			  "\x99\x9c\x9f\xa2\xa5\xa8\xab\xae"
+			  "\xb1\xb4\xb7\xba\xbd\xc0\xc3\xc6"
+			  "\xc9\xcc\xcf\xd2\xd5\xd8\xdb\xde"
+			  "\xe1\xe4\xe7\xea\xed\xf0\xf3\xf6"
+			  "\xf9\xfc\xff\x02\x05\x08\x0b\x0e"
+			  "\x16\x19\x1c\x1f\x22\x25\x28\x2b"
+			  "\x2e\x31\x34\x37\x3a\x3d\x40\x43"
+			  "\x46\x49\x4c\x4f\x52\x55\x58\x5b"
+			  "\x5e\x61\x64\x67\x6a\x6d\x70\x73"
+			  "\x76\x79\x7c\x7f\x82\x85\x88\x8b"
+			  "\x8e\x91\x94\x97\x9a\x9d\xa0\xa3"
+			  "\xa6\xa9\xac\xaf\xb2\xb5\xb8\xbb"
+			  "\xbe\xc1\xc4\xc7\xca\xcd\xd0\xd3"
+			  "\xdb\xde\xe1\xe4\xe7\xea\xed\xf0"
+			  "\xf3\xf6\xf9\xfc\xff\x02\x05\x08"
+			  "\x0b\x0e\x11\x14\x17\x1a\x1d\x20"
+			  "\x23\x26\x29\x2c\x2f\x32\x35\x38"
+			  "\x3b\x3e\x41\x44\x47\x4a\x4d\x50"
+			  "\x53\x56\x59\x5c\x5f\x62\x65\x68"
+			  "\x6b\x6e\x71\x74\x77\x7a\x7d\x80"
+			  "\x83\x86\x89\x8c\x8f\x92\x95\x98"
+			  "\xa0\xa3\xa6\xa9\xac\xaf\xb2\xb5"
+			  "\xb8\xbb\xbe\xc1\xc4\xc7\xca\xcd"
+			  "\xd0\xd3\xd6\xd9\xdc\xdf\xe2\xe5"
+			  "\xe8\xeb\xee\xf1\xf4\xf7\xfa\xfd"
+			  "\x00\x03\x06\x09\x0c\x0f\x12\x15"
+			  "\x18\x1b\x1e\x21\x24\x27\x2a\x2d"
+			  "\x30\x33\x36\x39\x3c\x3f\x42\x45"
+			  "\x48\x4b\x4e\x51\x54\x57\x5a\x5d"
+			  "\x65\x68\x6b\x6e\x71\x74\x77\x7a"
+			  "\x7d\x80\x83\x86\x89\x8c\x8f\x92"
+			  "\x95\x98\x9b\x9e\xa1\xa4\xa7\xaa"
+			  "\xad\xb0\xb3\xb6\xb9\xbc\xbf\xc2"
+			  "\xc5\xc8\xcb\xce\xd1\xd4\xd7\xda"
+			  "\xdd\xe0\xe3\xe6\xe9\xec\xef\xf2"
+			  "\xf5\xf8\xfb\xfe\x01\x04\x07\x0a"
+			  "\x0d\x10\x13\x16\x19\x1c\x1f\x22"
+			  "\x2a\x2d\x30\x33\x36\x39\x3c\x3f"
+			  "\x42\x45\x48\x4b\x4e\x51\x54\x57"
+			  "\x5a\x5d\x60\x63\x66\x69\x6c\x6f"
+			  "\x72\x75\x78\x7b\x7e\x81\x84\x87"
+			  "\x8a\x8d\x90\x93\x96\x99\x9c\x9f"
+			  "\xa2\xa5\xa8\xab\xae\xb1\xb4\xb7"
+			  "\xba\xbd\xc0\xc3\xc6\xc9\xcc\xcf"
+			  "\xd2\xd5\xd8\xdb\xde\xe1\xe4\xe7"
+			  "\xef\xf2\xf5\xf8\xfb\xfe\x01\x04"
+			  "\x07\x0a\x0d\x10\x13\x16\x19\x1c"
+			  "\x1f\x22\x25\x28\x2b\x2e\x31\x34"
+			  "\x37\x3a\x3d\x40\x43\x46\x49\x4c"
+			  "\x4f\x52\x55\x58\x5b\x5e\x61\x64"
+			  "\x67\x6a\x6d\x70\x73\x76\x79\x7c"
+			  "\x7f\x82\x85\x88\x8b\x8e\x91\x94"
+			  "\x97\x9a\x9d\xa0\xa3\xa6\xa9\xac"
+			  "\xb4\xb7\xba\xbd\xc0\xc3\xc6\xc9"
+			  "\xcc\xcf\xd2\xd5\xd8\xdb\xde\xe1"
+			  "\xe4\xe7\xea\xed\xf0\xf3\xf6\xf9"
+			  "\xfc\xff\x02\x05\x08\x0b\x0e\x11"
+			  "\x14\x17\x1a\x1d\x20\x23\x26\x29"
+			  "\x2c\x2f\x32\x35\x38\x3b\x3e\x41"
+			  "\x44\x47\x4a\x4d\x50\x53\x56\x59"
+			  "\x5c\x5f\x62\x65\x68\x6b\x6e\x71"
+			  "\x79\x7c\x7f\x82\x85\x88\x8b\x8e"
+			  "\x91\x94\x97\x9a\x9d\xa0\xa3\xa6"
+			  "\xa9\xac\xaf\xb2\xb5\xb8\xbb\xbe"
+			  "\xc1\xc4\xc7\xca\xcd\xd0\xd3\xd6"
+			  "\xd9\xdc\xdf\xe2\xe5\xe8\xeb\xee"
+			  "\xf1\xf4\xf7\xfa\xfd\x00\x03\x06"
+			  "\x09\x0c\x0f\x12\x15\x18\x1b\x1e"
+			  "\x21\x24\x27\x2a\x2d\x30\x33\x36"
+			  "\x3e\x41\x44\x47\x4a\x4d\x50\x53"
+			  "\x56\x59\x5c\x5f\x62\x65\x68\x6b"
+			  "\x6e\x71\x74\x77\x7a\x7d\x80\x83"
+			  "\x86\x89\x8c\x8f\x92\x95\x98\x9b"
+			  "\x9e\xa1\xa4\xa7\xaa\xad\xb0\xb3"
+			  "\xb6\xb9\xbc\xbf\xc2\xc5\xc8\xcb"
+			  "\xce\xd1\xd4\xd7\xda\xdd\xe0\xe3"
+			  "\xe6\xe9\xec\xef\xf2\xf5\xf8\xfb"
+			  "\x03\x06\x09\x0c\x0f\x12\x15\x18"
+			  "\x1b\x1e\x21\x24\x27\x2a\x2d\x30"
+			  "\x33\x36\x39\x3c\x3f\x42\x45\x48"
+			  "\x4b\x4e\x51\x54\x57\x5a\x5d\x60"
+			  "\x63\x66\x69\x6c\x6f\x72\x75\x78"
+			  "\x7b\x7e\x81\x84\x87\x8a\x8d\x90"
+			  "\x93\x96\x99\x9c\x9f\xa2\xa5\xa8"
+			  "\xab\xae\xb1\xb4\xb7\xba\xbd\xc0"
+			  "\xc8\xcb\xce\xd1\xd4\xd7\xda\xdd"
+			  "\xe0\xe3\xe6\xe9\xec\xef\xf2\xf5"
+			  "\xf8\xfb\xfe\x01\x04\x07\x0a\x0d"
+			  "\x10\x13\x16\x19\x1c\x1f\x22\x25"
+			  "\x28\x2b\x2e\x31\x34\x37\x3a\x3d"
+			  "\x40\x43\x46\x49\x4c\x4f\x52\x55"
+			  "\x58\x5b\x5e\x61\x64\x67\x6a\x6d"
+			  "\x70\x73\x76\x79\x7c\x7f\x82\x85"
+			  "\x8d\x90\x93\x96\x99\x9c\x9f\xa2"
+			  "\xa5\xa8\xab\xae\xb1\xb4\xb7\xba"
+			  "\xbd\xc0\xc3\xc6\xc9\xcc\xcf\xd2"
+			  "\xd5\xd8\xdb\xde\xe1\xe4\xe7\xea"
+			  "\xed\xf0\xf3\xf6\xf9\xfc\xff\x02"
+			  "\x05\x08\x0b\x0e\x11\x14\x17\x1a"
+			  "\x1d\x20\x23\x26\x29\x2c\x2f\x32"
+			  "\x35\x38\x3b\x3e\x41\x44\x47\x4a"
+			  "\x52\x55\x58\x5b\x5e\x61\x64\x67"
+			  "\x6a\x6d\x70\x73\x76\x79\x7c\x7f"
+			  "\x82\x85\x88\x8b\x8e\x91\x94\x97"
+			  "\x9a\x9d\xa0\xa3\xa6\xa9\xac\xaf"
+			  "\xb2\xb5\xb8\xbb\xbe\xc1\xc4\xc7"
+			  "\xca\xcd\xd0\xd3\xd6\xd9\xdc\xdf"
+			  "\xe2\xe5\xe8\xeb\xee\xf1\xf4\xf7"
+			  "\xfa\xfd\x00\x03\x06\x09\x0c\x0f"
+			  "\x17\x1a\x1d\x20\x23\x26\x29\x2c"
+			  "\x2f\x32\x35\x38\x3b\x3e\x41\x44"
+			  "\x47\x4a\x4d\x50\x53\x56\x59\x5c"
+			  "\x5f\x62\x65\x68\x6b\x6e\x71\x74"
+			  "\x77\x7a\x7d\x80\x83\x86\x89\x8c"
+			  "\x8f\x92\x95\x98\x9b\x9e\xa1\xa4"
+			  "\xa7\xaa\xad\xb0\xb3\xb6\xb9\xbc"
+			  "\xbf\xc2\xc5\xc8\xcb\xce\xd1\xd4"
+			  "\xdc\xdf\xe2\xe5\xe8\xeb\xee\xf1"
+			  "\xf4\xf7\xfa\xfd\x00\x03\x06\x09"
+			  "\x0c\x0f\x12\x15\x18\x1b\x1e\x21"
+			  "\x24\x27\x2a\x2d\x30\x33\x36\x39"
+			  "\x3c\x3f\x42\x45\x48\x4b\x4e\x51"
+			  "\x54\x57\x5a\x5d\x60\x63\x66\x69"
+			  "\x6c\x6f\x72\x75\x78\x7b\x7e\x81"
+			  "\x84\x87\x8a\x8d\x90\x93\x96\x99"
+			  "\xa1\xa4\xa7\xaa\xad\xb0\xb3\xb6"
+			  "\xb9\xbc\xbf\xc2\xc5\xc8\xcb\xce"
+			  "\xd1\xd4\xd7\xda\xdd\xe0\xe3\xe6"
+			  "\xe9\xec\xef\xf2\xf5\xf8\xfb\xfe"
+			  "\x01\x04\x07\x0a\x0d\x10\x13\x16"
+			  "\x19\x1c\x1f\x22\x25\x28\x2b\x2e"
+			  "\x31\x34\x37\x3a\x3d\x40\x43\x46"
+			  "\x49\x4c\x4f\x52\x55\x58\x5b\x5e"
+			  "\x66\x69\x6c\x6f\x72\x75\x78\x7b"
+			  "\x7e\x81\x84\x87\x8a\x8d\x90\x93"
+			  "\x96\x99\x9c\x9f\xa2\xa5\xa8\xab"
+			  "\xae\xb1\xb4\xb7\xba\xbd\xc0\xc3"
+			  "\xc6\xc9\xcc\xcf\xd2\xd5\xd8\xdb"
+			  "\xde\xe1\xe4\xe7\xea\xed\xf0\xf3"
+			  "\xf6\xf9\xfc\xff\x02\x05\x08\x0b"
+			  "\x0e\x11\x14\x17\x1a\x1d\x20\x23"
+			  "\x2b\x2e\x31\x34\x37\x3a\x3d\x40"
+			  "\x43\x46\x49\x4c\x4f\x52\x55\x58"
+			  "\x5b\x5e\x61\x64\x67\x6a\x6d\x70"
+			  "\x73\x76\x79\x7c\x7f\x82\x85\x88"
+			  "\x8b\x8e\x91\x94\x97\x9a\x9d\xa0"
+			  "\xa3\xa6\xa9\xac\xaf\xb2\xb5\xb8"
+			  "\xbb\xbe\xc1\xc4\xc7\xca\xcd\xd0"
+			  "\xd3\xd6\xd9\xdc\xdf\xe2\xe5\xe8"
+			  "\xf0\xf3\xf6\xf9\xfc\xff\x02\x05"
+			  "\x08\x0b\x0e\x11\x14\x17\x1a\x1d"
+			  "\x20\x23\x26\x29\x2c\x2f\x32\x35"
+			  "\x38\x3b\x3e\x41\x44\x47\x4a\x4d"
+			  "\x50\x53\x56\x59\x5c\x5f\x62\x65"
+			  "\x68\x6b\x6e\x71\x74\x77\x7a\x7d"
+			  "\x80\x83\x86\x89\x8c\x8f\x92\x95"
+			  "\x98\x9b\x9e\xa1\xa4\xa7\xaa\xad"
+			  "\xb5\xb8\xbb\xbe\xc1\xc4\xc7\xca"
+			  "\xcd\xd0\xd3\xd6\xd9\xdc\xdf\xe2"
+			  "\xe5\xe8\xeb\xee\xf1\xf4\xf7\xfa"
+			  "\xfd\x00\x03\x06\x09\x0c\x0f\x12"
+			  "\x15\x18\x1b\x1e\x21\x24\x27\x2a"
+			  "\x2d\x30\x33\x36\x39\x3c\x3f\x42"
+			  "\x45\x48\x4b\x4e\x51\x54\x57\x5a"
+			  "\x5d\x60\x63\x66\x69\x6c\x6f\x72"
+			  "\x7a\x7d\x80\x83\x86\x89\x8c\x8f"
+			  "\x92\x95\x98\x9b\x9e\xa1\xa4\xa7"
+			  "\xaa\xad\xb0\xb3\xb6\xb9\xbc\xbf"
+			  "\xc2\xc5\xc8\xcb\xce\xd1\xd4\xd7"
+			  "\xda\xdd\xe0\xe3\xe6\xe9\xec\xef"
+			  "\xf2\xf5\xf8\xfb\xfe\x01\x04\x07"
+			  "\x0a\x0d\x10\x13\x16\x19\x1c\x1f"
+			  "\x22\x25\x28\x2b\x2e\x31\x34\x37"
+			  "\x3f\x42\x45\x48\x4b\x4e\x51\x54"
+			  "\x57\x5a\x5d\x60\x63\x66\x69\x6c"
+			  "\x6f\x72\x75\x78\x7b\x7e\x81\x84"
+			  "\x87\x8a\x8d\x90\x93\x96\x99\x9c"
+			  "\x9f\xa2\xa5\xa8\xab\xae\xb1\xb4"
+			  "\xb7\xba\xbd\xc0\xc3\xc6\xc9\xcc"
+			  "\xcf\xd2\xd5\xd8\xdb\xde\xe1\xe4"
+			  "\xe7\xea\xed\xf0\xf3\xf6\xf9\xfc"
+			  "\x04\x07\x0a\x0d\x10\x13\x16\x19"
+			  "\x1c\x1f\x22\x25\x28\x2b\x2e\x31"
+			  "\x34\x37\x3a\x3d\x40\x43\x46\x49"
+			  "\x4c\x4f\x52\x55\x58\x5b\x5e\x61"
+			  "\x64\x67\x6a\x6d\x70\x73\x76\x79"
+			  "\x7c\x7f\x82\x85\x88\x8b\x8e\x91"
+			  "\x94\x97\x9a\x9d\xa0\xa3\xa6\xa9"
+			  "\xac\xaf\xb2\xb5\xb8\xbb\xbe\xc1"
+			  "\xc9\xcc\xcf\xd2\xd5\xd8\xdb\xde"
+			  "\xe1\xe4\xe7\xea\xed\xf0\xf3\xf6"
+			  "\xf9\xfc\xff\x02\x05\x08\x0b\x0e"
+			  "\x11\x14\x17\x1a\x1d\x20\x23\x26"
+			  "\x29\x2c\x2f\x32\x35\x38\x3b\x3e"
+			  "\x41\x44\x47\x4a\x4d\x50\x53\x56"
+			  "\x59\x5c\x5f\x62\x65\x68\x6b\x6e"
+			  "\x71\x74\x77\x7a\x7d\x80\x83\x86"
+			  "\x8e\x91\x94\x97\x9a\x9d\xa0\xa3"
+			  "\xa6\xa9\xac\xaf\xb2\xb5\xb8\xbb"
+			  "\xbe\xc1\xc4\xc7\xca\xcd\xd0\xd3"
+			  "\xd6\xd9\xdc\xdf\xe2\xe5\xe8\xeb"
+			  "\xee\xf1\xf4\xf7\xfa\xfd\x00\x03"
+			  "\x06\x09\x0c\x0f\x12\x15\x18\x1b"
+			  "\x1e\x21\x24\x27\x2a\x2d\x30\x33"
+			  "\x36\x39\x3c\x3f\x42\x45\x48\x4b"
+			  "\x53\x56\x59\x5c\x5f\x62\x65\x68"
+			  "\x6b\x6e\x71\x74\x77\x7a\x7d\x80"
+			  "\x83\x86\x89\x8c\x8f\x92\x95\x98"
+			  "\x9b\x9e\xa1\xa4\xa7\xaa\xad\xb0"
+			  "\xb3\xb6\xb9\xbc\xbf\xc2\xc5\xc8"
+			  "\xcb\xce\xd1\xd4\xd7\xda\xdd\xe0"
+			  "\xe3\xe6\xe9\xec\xef\xf2\xf5\xf8"
+			  "\xfb\xfe\x01\x04\x07\x0a\x0d\x10"
+			  "\x18\x1b\x1e\x21\x24\x27\x2a\x2d"
+			  "\x30\x33\x36\x39\x3c\x3f\x42\x45"
+			  "\x48\x4b\x4e\x51\x54\x57\x5a\x5d"
+			  "\x60\x63\x66\x69\x6c\x6f\x72\x75"
+			  "\x78\x7b\x7e\x81\x84\x87\x8a\x8d"
+			  "\x90\x93\x96\x99\x9c\x9f\xa2\xa5"
+			  "\xa8\xab\xae\xb1\xb4\xb7\xba\xbd"
+			  "\xc0\xc3\xc6\xc9\xcc\xcf\xd2\xd5"
+			  "\xdd\xe0\xe3\xe6\xe9\xec\xef\xf2"
+			  "\xf5\xf8\xfb\xfe\x01\x04\x07\x0a"
+			  "\x0d\x10\x13\x16\x19\x1c\x1f\x22"
+			  "\x25\x28\x2b\x2e\x31\x34\x37\x3a"
+			  "\x3d\x40\x43\x46\x49\x4c\x4f\x52"
+			  "\x55\x58\x5b\x5e\x61\x64\x67\x6a"
+			  "\x6d\x70\x73\x76\x79\x7c\x7f\x82"
+			  "\x85\x88\x8b\x8e\x91\x94\x97\x9a"
+			  "\xa2\xa5\xa8\xab\xae\xb1\xb4\xb7"
+			  "\xba\xbd\xc0\xc3\xc6\xc9\xcc\xcf"
+			  "\xd2\xd5\xd8\xdb\xde\xe1\xe4\xe7"
+			  "\xea\xed\xf0\xf3\xf6\xf9\xfc\xff"
+			  "\x02\x05\x08\x0b\x0e\x11\x14\x17"
+			  "\x1a\x1d\x20\x23\x26\x29\x2c\x2f"
+			  "\x32\x35\x38\x3b\x3e\x41\x44\x47"
+			  "\x4a\x4d\x50\x53\x56\x59\x5c\x5f"
+			  "\x67\x6a\x6d\x70\x73\x76\x79\x7c"
+			  "\x7f\x82\x85\x88\x8b\x8e\x91\x94"
+			  "\x97\x9a\x9d\xa0\xa3\xa6\xa9\xac"
+			  "\xaf\xb2\xb5\xb8\xbb\xbe\xc1\xc4"
+			  "\xc7\xca\xcd\xd0\xd3\xd6\xd9\xdc"
+			  "\xdf\xe2\xe5\xe8\xeb\xee\xf1\xf4"
+			  "\xf7\xfa\xfd\x00\x03\x06\x09\x0c"
+			  "\x0f\x12\x15\x18\x1b\x1e\x21\x24"
+			  "\x2c\x2f\x32\x35\x38\x3b\x3e\x41"
+			  "\x44\x47\x4a\x4d\x50\x53\x56\x59"
+			  "\x5c\x5f\x62\x65\x68\x6b\x6e\x71"
+			  "\x74\x77\x7a\x7d\x80\x83\x86\x89"
+			  "\x8c\x8f\x92\x95\x98\x9b\x9e\xa1"
+			  "\xa4\xa7\xaa\xad\xb0\xb3\xb6\xb9"
+			  "\xbc\xbf\xc2\xc5\xc8\xcb\xce\xd1"
+			  "\xd4\xd7\xda\xdd\xe0\xe3\xe6\xe9"
+			  "\xf1\xf4\xf7\xfa\xfd\x00\x03\x06"
+			  "\x09\x0c\x0f\x12\x15\x18\x1b\x1e"
+			  "\x21\x24\x27\x2a\x2d\x30\x33\x36"
+			  "\x39\x3c\x3f\x42\x45\x48\x4b\x4e"
+			  "\x51\x54\x57\x5a\x5d\x60\x63\x66"
+			  "\x69\x6c\x6f\x72\x75\x78\x7b\x7e"
+			  "\x81\x84\x87\x8a\x8d\x90\x93\x96"
+			  "\x99\x9c\x9f\xa2\xa5\xa8\xab\xae"
+			  "\xb6\xb9\xbc\xbf\xc2\xc5\xc8\xcb"
+			  "\xce\xd1\xd4\xd7\xda\xdd\xe0\xe3"
+			  "\xe6\xe9\xec\xef\xf2\xf5\xf8\xfb"
+			  "\xfe\x01\x04\x07\x0a\x0d\x10\x13"
+			  "\x16\x19\x1c\x1f\x22\x25\x28\x2b"
+			  "\x2e\x31\x34\x37\x3a\x3d\x40\x43"
+			  "\x46\x49\x4c\x4f\x52\x55\x58\x5b"
+			  "\x5e\x61\x64\x67\x6a\x6d\x70\x73"
+			  "\x7b\x7e\x81\x84\x87\x8a\x8d\x90"
+			  "\x93\x96\x99\x9c\x9f\xa2\xa5\xa8"
+			  "\xab\xae\xb1\xb4\xb7\xba\xbd\xc0"
+			  "\xc3\xc6\xc9\xcc\xcf\xd2\xd5\xd8"
+			  "\xdb\xde\xe1\xe4\xe7\xea\xed\xf0"
+			  "\xf3\xf6\xf9\xfc\xff\x02\x05\x08"
+			  "\x0b\x0e\x11\x14\x17\x1a\x1d\x20"
+			  "\x23\x26\x29\x2c\x2f\x32\x35\x38",
+		.ctext	= "\x47\xd4\xfc\x4a\x92\xc3\x08\x30"
+			  "\xd3\x47\x15\x5a\x19\xf8\x9d\x20"
+			  "\x3a\x22\xaa\xb9\x94\xed\x6a\x92"
+			  "\xd3\x70\x2a\x90\xaf\x4b\x57\x19"
+			  "\x50\xb1\xef\xdf\x57\xc5\x8e\xf2"
+			  "\x70\x8d\x3f\x2b\x05\xd7\x28\xd5"
+			  "\xb2\x34\x28\xb2\x0b\xeb\x38\xaf"
+			  "\x6e\xe3\x4b\xfe\x55\x04\x2b\xd0"
+			  "\xc2\xd0\x1a\xaa\xfb\x02\x32\x0e"
+			  "\xc4\x4f\x48\xef\x6b\x6a\xb1\xc9"
+			  "\x1e\x2f\xb1\xb9\x5f\xdb\xca\x81"
+			  "\xab\x94\x68\x3e\x72\x90\x33\x1c"
+			  "\x07\x3d\x06\x45\xbd\x3a\xbc\xf6"
+			  "\x40\x4e\x6e\xf9\xb6\xc8\xb7\xd0"
+			  "\x54\x21\xf4\xf1\xaa\xfc\x42\x85"
+			  "\x6c\xaa\x49\x9a\x98\x9b\xbe\xb9"
+			  "\x1a\x88\x36\x4e\x8e\x38\xae\x71"
+			  "\xa3\xcc\x7c\x84\x51\x82\xb7\xb9"
+			  "\x79\x5c\x1e\xba\x08\x0a\x94\x70"
+			  "\x58\x6f\x1f\xe6\x72\x21\x4b\xe9"
+			  "\xf2\xe1\x40\xaf\x2c\x97\x3a\xee"
+			  "\xbc\x32\x38\x8f\xeb\x1c\x74\xed"
+			  "\xef\x62\xf0\xcb\xf1\x3a\x26\xc6"
+			  "\xeb\xce\x5f\x14\x40\x3d\x29\x65"
+			  "\x05\x76\x5a\xd8\x2d\xfa\xae\x30"
+			  "\x4c\xf3\x45\x5e\x04\x09\x01\x8e"
+			  "\x85\x99\x97\x2c\xec\x38\xf8\x5a"
+			  "\xfa\x08\x9a\xd6\x8d\x57\x0d\x38"
+			  "\x2b\x01\x92\xc3\x41\x7c\x96\xe2"
+			  "\xd7\x3e\x83\x98\xc5\xba\x3b\x51"
+			  "\x0d\x28\xc5\x0f\x35\xac\x3a\x6b"
+			  "\xa5\x84\xab\x35\xa9\x6c\x0b\x75"
+			  "\xe9\x2d\xdd\x4f\x7b\x2f\x8f\xbd"
+			  "\x06\x8c\xd9\xa6\x25\xc1\xdb\x26"
+			  "\x7b\x9e\x01\x55\x7b\x23\x4d\x1f"
+			  "\xc5\xee\x61\x4e\x35\x36\xaa\x82"
+			  "\xae\xba\x0d\xff\xc1\xb6\xa4\x7a"
+			  "\x26\x9e\x5b\x4b\x8e\xf3\x53\xde"
+			  "\x70\x55\x1b\x84\x6f\xfe\x49\xe1"
+			  "\x28\xe5\xfe\xdb\x05\xa9\xd7\x6d"
+			  "\x23\xeb\x21\xf8\x26\x36\x67\x3d"
+			  "\xb7\xd8\xb8\xda\xec\xff\x0b\x0b"
+			  "\x63\x39\xb6\x35\x5d\xdc\x4c\x14"
+			  "\x43\xff\x04\xf4\xff\xcd\x37\x66"
+			  "\x80\x85\x56\x78\xf8\xc4\x1a\x85"
+			  "\xd0\x72\xe0\xdc\xb7\x31\x30\xbd"
+			  "\x45\xe8\xf1\x3e\x4c\xf8\x74\x79"
+			  "\xfd\x53\xb0\xaa\xcf\x40\xc1\xdb"
+			  "\xd4\x17\xeb\x63\x5f\x13\x6e\xf5"
+			  "\xc5\x23\x37\x38\xbe\x2f\xb2\x45"
+			  "\xeb\x86\x7c\xdc\x99\x5b\xb2\x2a"
+			  "\x1c\x13\xc3\x3d\x5d\xfc\x38\x72"
+			  "\x4e\x64\x67\x25\xb2\x34\x3a\x78"
+			  "\x4f\xb3\x2f\x51\x76\xa5\x01\x5c"
+			  "\xfa\x52\xb2\x64\xb6\x7b\xdc\x7b"
+			  "\x44\x5d\xfe\x43\x88\x21\x4a\xa0"
+			  "\xe9\x55\x08\x26\xb2\x60\xd4\xa0"
+			  "\xee\x14\x59\xf9\x24\x4a\x84\xe5"
+			  "\xd7\xda\x8b\xaa\xa6\x7f\x43\x7f"
+			  "\xb0\x92\xad\x7f\x33\x02\x1b\x65"
+			  "\x29\x05\x92\x77\x2e\xd2\x42\xd6"
+			  "\xf0\xd1\xf3\x4e\x12\x37\xe1\x3e"
+			  "\x65\x6b\xba\x5e\x28\x1b\xdf\xac"
+			  "\xde\x71\x3c\xdb\x0c\x35\x13\x00"
+			  "\x51\x04\x1d\xea\xab\xe1\x05\x98"
+			  "\xc1\x6c\x37\xc9\x1a\x95\x62\x28"
+			  "\xce\x6e\xea\xac\xf4\xd2\x30\xde"
+			  "\x42\x9e\xba\x65\xb9\x80\x0c\x14"
+			  "\x25\x4a\xd9\xd6\x2c\xd5\x63\xcb"
+			  "\x85\xe2\x77\x05\x17\x8f\x45\x87"
+			  "\x70\x53\x7e\xf8\x26\xa7\x86\xf0"
+			  "\x83\xf5\xc5\x31\x59\xa1\xaf\x1f"
+			  "\x61\xee\x41\xa3\xb2\xf4\x21\x4a"
+			  "\xbc\x06\x96\x7c\x1c\x26\xc8\x3e"
+			  "\x36\xef\xe0\x0a\x3f\x1a\x3d\xb0"
+			  "\x1c\x2e\xb3\x11\xd4\xf0\x48\x4a"
+			  "\xad\x86\x8b\xc7\x75\x83\x59\x7c"
+			  "\x30\x66\x4b\x1e\x6d\xe0\x4d\x4f"
+			  "\x53\x05\xe8\x6f\x94\x36\x0c\x83"
+			  "\x59\x45\xb9\xb3\xf7\x82\xeb\x71"
+			  "\x16\x68\x9e\x96\xab\x1b\xd8\x34"
+			  "\x21\xa2\x69\x88\xfa\x0c\xf0\x90"
+			  "\xee\x6c\xcc\x88\x1d\x71\xfc\x20"
+			  "\xd6\x4d\x42\xa2\x36\x8e\x13\x5c"
+			  "\x3a\x3b\xd4\xfd\x76\x3e\xca\xb7"
+			  "\xc4\x8a\x4a\x0c\xae\x5c\xfe\xf6"
+			  "\x2c\x20\xa1\x3a\x0e\x66\x9b\x60"
+			  "\xa6\xd5\xa9\xfd\xd7\x52\x06\x0e"
+			  "\xd3\x33\x0d\xfa\xd5\xf0\x42\x16"
+			  "\xff\x4d\xff\x2d\x91\x5e\x1f\xbf"
+			  "\x22\x8e\xec\xa4\xd5\x83\x1e\x8d"
+			  "\xde\x56\xde\x25\x77\xd9\x9c\xc4"
+			  "\x8f\x94\xf7\x0a\xc2\x40\x5e\xf8"
+			  "\xaa\x7f\x59\x0e\x18\x18\x17\x6a"
+			  "\x8f\x4b\x53\x96\x9a\x21\x5e\xf9"
+			  "\xcd\x1a\x8a\x41\xab\x14\xe6\xc8"
+			  "\xcc\xfb\xfb\x35\x83\xca\x30\x2c"
+			  "\xf2\x3d\xc4\x98\x9c\x48\xa5\x2d"
+			  "\x0e\x5d\x31\x3f\xab\x27\x83\xda"
+			  "\xb3\x7a\x86\x6c\x24\x0c\x8e\xbb"
+			  "\xef\x3c\xf1\xe2\xab\xc6\xdc\x97"
+			  "\xf2\x29\x2f\xf0\x8d\xf9\x1f\x9e"
+			  "\x84\x06\xd9\xc6\xb1\xdd\x84\xa5"
+			  "\xd6\x42\xe0\x49\x62\xaf\x5a\xc6"
+			  "\x0c\x04\xd1\xb7\x11\x6b\xbc\x4d"
+			  "\xd1\x6a\x6f\xeb\xb1\x8f\x09\xbb"
+			  "\xb7\x33\x35\x8e\x9f\x5d\x86\x67"
+			  "\x22\xb5\x70\x43\xcd\x32\xf6\xf6"
+			  "\xc9\x79\x62\x51\x24\x4d\xb5\x09"
+			  "\x5f\xc8\x63\x44\x52\x6a\x01\x9c"
+			  "\x3c\x89\x29\xd8\xc1\xb8\xdc\x4a"
+			  "\x91\x4e\x55\xab\x08\x30\x04\x4b"
+			  "\x88\xe8\x60\x28\x41\x99\xac\x27"
+			  "\xc3\x09\x85\x10\xef\x0e\xfd\xbf"
+			  "\x16\xf4\x56\xe2\xbb\x1d\xfb\x70"
+			  "\xae\xf3\x3d\x6b\x57\xd0\x3f\x18"
+			  "\x53\x5e\x08\x68\x60\x3d\x39\x78"
+			  "\xc3\xf9\xe1\x0c\xe3\xd1\xe1\x3e"
+			  "\x88\xa1\xd0\x9c\x14\xf2\x7c\x8f"
+			  "\x68\x28\x79\xfc\x73\xf1\x7a\xd3"
+			  "\x08\xad\xbf\x7c\x61\x58\x4e\x5e"
+			  "\xf2\xc5\xae\xbc\x46\xdc\xf7\x94"
+			  "\xb6\x48\xc1\xed\x36\x8a\x9e\xec"
+			  "\xf8\xc2\xa8\xb8\xfd\xb4\xf0\x2b"
+			  "\xac\xae\xfb\xa7\x3a\x65\x56\x67"
+			  "\x6c\xfd\x89\x9c\x6b\x6c\x16\xd0"
+			  "\x15\x73\x59\xf7\x02\x9b\x94\x79"
+			  "\xc8\x50\xc0\x11\x64\x4e\xb9\xeb"
+			  "\xf2\xad\x50\x40\x4b\xee\x37\x66"
+			  "\x3b\x0d\xaa\xdd\xbc\xb1\x87\x60"
+			  "\x50\x66\x14\xac\x58\xac\xc4\x9f"
+			  "\xe5\xc4\xb8\x7e\x8c\x30\x6a\xcd"
+			  "\x6a\xad\x7e\x21\x13\x3f\x3c\x7c"
+			  "\x60\xed\x6f\xe7\x80\xef\x12\x25"
+			  "\xf4\x29\x39\xbc\x26\xd5\x72\x06"
+			  "\x24\x81\x3c\xbb\xe1\x0e\x0e\x02"
+			  "\xc7\x32\x6c\xbb\xa2\x6c\x13\xfe"
+			  "\x25\xa4\xf3\x02\xa5\xc9\x29\xc6"
+			  "\xb6\x42\x81\xcf\xa8\xa4\x3a\xdb"
+			  "\xc3\x0f\x8d\xb0\x92\x50\x3d\xe8"
+			  "\xeb\x1b\x95\x01\x2a\x9f\x63\x0e"
+			  "\x44\xbd\xe2\x77\xd7\x53\x19\x1c"
+			  "\xa0\x1a\xc0\x1a\xd2\x57\xce\x82"
+			  "\xe7\x50\xa3\xd2\x40\xe3\x27\x9b"
+			  "\x9c\x22\xbd\x63\x87\x3a\x7e\x77"
+			  "\xc2\x63\x83\xdd\xf0\xba\x75\xd2"
+			  "\x51\xbe\x66\x20\x8b\x0c\xe4\x2d"
+			  "\x61\xbe\x1a\x54\x2c\xfa\xed\xc4"
+			  "\xd8\x9b\x3d\x28\x0a\x57\x08\xf3"
+			  "\x6e\x63\xd9\x4f\x6f\xc1\x49\xdf"
+			  "\xa5\x00\x18\x83\xa9\x41\xb6\xfa"
+			  "\x4e\xea\x6b\xbc\x78\x85\x18\x38"
+			  "\xfa\xda\x4e\xe7\xba\x36\xdc\x88"
+			  "\x47\x4d\xa9\x47\x8d\x12\xc6\x47"
+			  "\xca\x36\x6c\x88\x56\xaf\x73\x78"
+			  "\xed\x3c\x3c\x81\xf6\x73\xd4\x94"
+			  "\x7a\x7b\x81\x29\xf7\xeb\x89\x42"
+			  "\xfb\x78\x67\xf0\xfa\x81\xe3\xfe"
+			  "\x02\x71\x27\xe8\xea\x68\xa9\x1f"
+			  "\x77\x48\xd4\xb0\xc5\x23\x82\x2c"
+			  "\x86\x6a\x71\x32\x2c\x94\xa1\x08"
+			  "\x09\xbb\xbf\x9d\x7e\x8a\x8f\xde"
+			  "\x26\x52\x38\x2c\xa1\x97\x5f\x3a"
+			  "\x49\xb1\x83\x96\x6d\x13\xc3\x65"
+			  "\x29\x36\xfd\x25\xb1\x37\xa2\x5a"
+			  "\x3d\x04\xb5\x99\x34\xb1\x64\x2d"
+			  "\xae\xe6\x8d\x6c\x27\xb7\xd9\x09"
+			  "\x44\x26\x77\xf5\x7c\x0c\xa1\xc0"
+			  "\x11\x72\x0d\xe7\x39\xa4\xe3\xb5"
+			  "\x0a\xb9\xcd\x8b\x0a\xb6\x12\x60"
+			  "\x3c\xc0\xf9\x33\x08\x76\xbe\x4e"
+			  "\xf8\x11\x19\x2d\x68\x42\x7e\x24"
+			  "\xa7\x96\x63\x13\x36\x4b\x17\x73"
+			  "\x7f\x63\xf8\x15\x30\x04\xfe\x13"
+			  "\xde\xdd\x35\x5a\x20\x68\xc1\x9e"
+			  "\x47\x7f\x28\xd1\x1b\xe1\x15\x11"
+			  "\xbc\xa3\xb7\x87\x75\x64\xd4\x31"
+			  "\xa0\x30\x95\xf1\xf6\x5a\x42\x6d"
+			  "\x26\x00\xb2\xe9\x02\x15\xd1\xb7"
+			  "\x40\x0f\x87\x41\xa5\x89\xfb\x4c"
+			  "\x64\x92\x42\x0e\x3a\x78\x64\xec"
+			  "\x57\x9e\xe4\x3a\x68\x7c\xb1\x12"
+			  "\xe3\x29\xfc\x0b\xf4\x06\x60\xa7"
+			  "\x8e\xb2\x3e\x33\xf5\xeb\xff\x4f"
+			  "\xf1\xc5\xbb\xdf\xb4\x06\xb2\xdc"
+			  "\xaa\xd0\xb7\x6f\xe6\x63\xad\x5b"
+			  "\x4b\x5b\x3e\xc2\x55\xbc\xbb\xfb"
+			  "\xb9\x71\x78\x6a\xa2\xa5\xf3\x3b"
+			  "\x46\xc4\x5b\xd9\x3b\x17\xb8\x13"
+			  "\xe7\x5d\x89\x86\x2f\x51\xe2\x10"
+			  "\xa6\x99\xb1\x27\xfe\x1e\xaf\x68"
+			  "\xab\x45\x27\x94\x9e\x30\x1a\xaf"
+			  "\xf1\xfb\x78\xaf\xcc\xd5\x0e\x2b"
+			  "\x18\xf8\xc6\x77\xbd\xb9\xa9\x34"
+			  "\x33\x92\x3d\x37\x66\xdd\xed\xcb"
+			  "\xe2\xa6\x10\xea\xf7\x13\xec\x18"
+			  "\x6c\x11\x21\x32\x67\x79\xa3\xc8"
+			  "\x4f\x97\x6f\xfe\xdb\x65\x2b\xc8"
+			  "\x46\xe8\x0b\x19\xcc\xb4\x94\x66"
+			  "\x51\xdf\x3c\x67\xc0\x9b\xd5\xaf"
+			  "\xd0\xe3\xff\x3d\x99\x68\xee\x48"
+			  "\x7e\x4f\x92\x5a\xf1\xa5\x5b\xfb"
+			  "\x7f\x7b\x19\x17\x26\xc5\x9a\x00"
+			  "\xa1\x6d\xa9\x19\xda\x78\xfc\x75"
+			  "\x74\x95\x37\xcd\xfe\x8a\xca\xa3"
+			  "\x88\xdc\xe0\x51\xda\xc6\x48\x90"
+			  "\xe5\xda\x7d\x98\x95\x45\x05\x70"
+			  "\x88\x0b\x5d\x19\xf9\x6f\x3d\x25"
+			  "\xc9\x16\x89\x2c\xc9\xae\x3e\xe4"
+			  "\xbb\x33\x42\x87\xc4\xb2\xad\xfc"
+			  "\x99\xac\x87\xa7\xc9\x89\xa5\x7f"
+			  "\x4f\x72\x21\x2f\xce\xad\xbe\x96"
+			  "\x2e\x75\x63\x28\xff\x8b\xbd\xfa"
+			  "\x49\x0c\x30\x97\xab\xfd\x32\x0e"
+			  "\x55\x9e\x58\x61\x48\x4f\x1b\x51"
+			  "\xd4\x21\x65\xc7\xef\x6e\xa6\xbd"
+			  "\x2d\x24\xec\xd1\xf4\xb9\x09\xa4"
+			  "\x39\xe0\x11\x6a\xc3\x7e\x43\x24"
+			  "\x0f\x4e\x9a\xfe\x3a\x38\xf2\x28"
+			  "\x0b\xa9\xf2\x8a\x5b\xe3\xca\x23"
+			  "\xfa\x7f\x99\x8d\xbb\x04\x99\x3f"
+			  "\x5c\x92\xc7\x9e\x26\xc4\x07\x43"
+			  "\xaa\x16\x6f\xb6\x17\xdc\xce\xcd"
+			  "\xc4\x26\x12\x57\xc1\xd4\xf5\x29"
+			  "\xd5\xec\xb6\x5a\xb7\xc7\x6d\xb1"
+			  "\x20\x0c\x93\xdb\xb1\xf9\x28\x46"
+			  "\xca\xdc\x8f\xa0\x88\x5b\xf7\x40"
+			  "\x91\xc9\x4a\x62\x17\x65\xc1\x8c"
+			  "\x3b\x4a\x31\x1a\xf0\x68\xa1\x4a"
+			  "\x55\xf4\x06\x79\x12\x9d\x2e\x13"
+			  "\xd4\xc5\x17\x2c\xb4\xcf\x3f\x70"
+			  "\x40\xa4\x09\x95\x35\xd4\xea\x2f"
+			  "\xd3\x7d\xf8\x7d\x6c\x72\x6e\x5e"
+			  "\x53\x11\xa7\xaf\x47\xf2\xe8\xf6"
+			  "\xe9\x46\x5c\x4e\xf7\x6b\x8c\xf5"
+			  "\x9f\x7c\x60\x63\x6a\xd7\xc6\x9a"
+			  "\x6b\x40\x81\x9e\x28\x37\x1b\xef"
+			  "\x83\x84\xf6\x74\x96\x07\x2c\xa5"
+			  "\xce\x68\x00\xab\xf5\x9a\xe7\x96"
+			  "\x18\x75\xe0\xfb\xf2\xb6\x56\x8e"
+			  "\xc8\x0b\x0b\xb0\xed\x63\xf3\x59"
+			  "\x7b\x09\xf3\x1d\x21\xbf\x72\xa3"
+			  "\x9a\xc9\xce\x32\x92\x5f\x14\xdb"
+			  "\x0a\x69\xfa\xf0\xf0\xed\x15\xf5"
+			  "\x2b\xd9\xed\xfb\x53\x3f\x4d\x21"
+			  "\x69\x65\xb9\x2d\x78\x1e\xa9\xd6"
+			  "\xa8\x34\x5d\x89\xf1\xfb\x60\x1d"
+			  "\xd2\x31\x16\xc8\xc8\x92\x20\x81"
+			  "\xa3\x0a\x0f\x09\x1c\x43\xe2\x1c"
+			  "\x9b\x89\x77\x7b\x59\x08\x51\xe9"
+			  "\xd3\xf3\xab\x83\x43\x53\x32\x44"
+			  "\x34\xbf\xfb\x6a\x84\x57\xed\x6c"
+			  "\xb2\x4e\x1e\x55\x3d\xc4\x1d\x38"
+			  "\xa1\x8b\x95\x4f\x34\xc0\x5d\x46"
+			  "\x7a\x70\x9e\x08\x8e\xc3\x60\xaa"
+			  "\x81\xdf\x4f\x1f\x1b\x69\xea\xfc"
+			  "\x34\x9e\x3e\xdd\x76\xc3\xa0\x92"
+			  "\x6d\x9a\x0a\xb6\xc6\x85\x53\x24"
+			  "\x81\xc4\x67\xc8\xf6\xdd\x2e\x0c"
+			  "\xa7\xf1\xb3\xb6\x31\xa1\x85\x3d"
+			  "\x01\xc3\x8a\xe3\xee\xe2\xda\xa7"
+			  "\xd1\x7f\xa3\x4e\x09\x5c\xe1\xd7"
+			  "\x2c\x4e\xf1\xbd\xf1\x57\x31\x44"
+			  "\x80\xd5\x6e\xd1\x52\xd8\x36\x70"
+			  "\x7a\xe5\x1d\x43\xe6\xf9\xa7\xcf"
+			  "\xf0\xdf\xa3\x7b\x5d\x82\x94\x63"
+			  "\xd7\x7e\x94\x5d\x54\x8b\x65\xa9"
+			  "\x7b\xdf\x12\xdb\xc5\xfa\xa9\xa4"
+			  "\x63\xaa\x35\xe1\x2e\x45\x0b\xad"
+			  "\xc0\x83\xe5\x7f\x87\xe2\x13\xd7"
+			  "\x7b\x8e\x3e\x16\x24\x78\x35\x66"
+			  "\x59\xd0\xe3\xb6\x77\x78\x60\xfb"
+			  "\x3a\xae\xef\xea\xf9\x90\x4f\x95"
+			  "\x48\xdf\x8f\x26\x50\xfc\x4a\xb7"
+			  "\x80\xbf\xd0\xde\x22\x9c\xf2\xb3"
+			  "\xff\xee\xb5\x1f\x18\xf2\x8f\x3f"
+			  "\x8d\x17\xb4\xfd\xf2\x32\x8e\x5f"
+			  "\x1f\x15\xb1\x57\xcc\x16\x32\xbf"
+			  "\xe6\xc1\x07\xc1\xa3\x4f\x3c\x21"
+			  "\x8a\xb6\x37\x50\xa6\x9b\xcc\x47"
+			  "\xcb\x6f\xd8\x42\x2a\x39\xd8\xbe"
+			  "\x9c\x39\x18\x11\x43\x34\xc6\xa3"
+			  "\xa4\x31\x18\xf3\x4a\xf8\x26\xe0"
+			  "\xf0\x30\x53\x65\x39\xa1\x51\x1a"
+			  "\x31\x13\x9b\xb1\x47\x03\x23\x36"
+			  "\x57\x59\x76\x01\x83\x91\x4d\xbf"
+			  "\x2c\x42\x94\x83\x47\x56\x43\x6b"
+			  "\x70\x16\x7c\x03\xbe\xf6\x4f\x51"
+			  "\xb7\xd5\xfc\xb4\xfe\x85\x0f\x89"
+			  "\x8a\xfa\x8f\x05\x8d\x74\x62\x6c"
+			  "\x6c\x79\xa5\xc9\x07\x97\x7d\xf0"
+			  "\x52\x75\xd8\xc3\x18\xb0\x5b\xa2"
+			  "\x92\x73\x10\xb0\x0c\xb9\x4f\x6c"
+			  "\xde\x3e\x0f\xd3\x95\xa2\x7c\x03"
+			  "\x7f\xb2\x0a\x1e\xac\x11\xa8\x79"
+			  "\xcc\xe9\x15\x48\x11\x11\xe8\x60"
+			  "\xc7\x98\x3f\xc0\x26\x10\x74\xba"
+			  "\xa9\xbf\x4e\xae\x43\x78\xed\x87"
+			  "\xc3\x55\xe6\x53\xd7\x97\x64\x29"
+			  "\x20\x5f\x98\xf6\x00\xbe\xcb\x2f"
+			  "\xc8\xe5\xb4\x0d\x0e\xff\x06\xd1"
+			  "\x68\xa0\xcd\x53\xc9\x79\x62\xf4"
+			  "\x3c\x40\x4a\x4b\x92\x6c\x8d\x73"
+			  "\xcf\xe8\xd2\xcb\x68\xba\x5c\x13"
+			  "\x34\x7b\x25\x38\x9a\x03\xf4\x2c"
+			  "\x86\xae\x5c\xf4\x7b\xe1\x93\x20"
+			  "\x13\xa1\x54\x77\xa7\x82\x1f\x78"
+			  "\x57\x90\x7b\xff\xa3\xf8\x73\x57"
+			  "\x3d\xc1\x71\xcc\x87\xca\x10\xcc"
+			  "\xb4\xc6\x98\x47\x95\xfd\x2d\x89"
+			  "\x68\xe4\x15\xeb\x1b\x7c\x75\xb2"
+			  "\x44\xe8\xb9\x39\x6f\x8d\x74\xb0"
+			  "\x5f\x57\x63\x72\x38\x98\x4f\xa7"
+			  "\xf4\x06\x10\x25\x16\x36\xcc\x22"
+			  "\x30\x68\x25\x6e\x95\xc8\x81\xb3"
+			  "\xbf\xb9\xb2\x71\x0d\x2a\x22\x50"
+			  "\x49\x1c\xe1\x6b\xf0\xf6\x72\x7d"
+			  "\x29\xf8\x27\xae\x04\xb4\x25\xc3"
+			  "\x1c\xac\x41\x0e\xd3\x0d\xda\xb4"
+			  "\xba\x27\xc9\x68\x63\xe8\x66\x94"
+			  "\x9e\xbc\x36\x47\xe4\x1a\x60\x18"
+			  "\x0d\xb4\xfc\x14\x18\xd9\x29\x07"
+			  "\x58\x52\x43\x37\xa4\x8f\x56\x40"
+			  "\x65\x6c\x8d\xd7\x8f\xc2\x97\x76"
+			  "\x2d\xb6\x7a\x38\x66\x89\x28\x71"
+			  "\xd8\x76\x39\x4d\x11\x8b\xa8\xff"
+			  "\x86\x22\x07\xeb\x17\xca\xde\x7e"
+			  "\x2c\x37\xc9\x48\x11\x2d\xda\x76"
+			  "\x3e\x20\x22\xdf\xad\xfc\xad\x1c"
+			  "\x18\x50\xa7\xfe\x44\x88\x55\xdf"
+			  "\x9e\xeb\xa6\x3a\xc9\xd3\x79\xad"
+			  "\x6f\xf0\x82\xe5\x65\xf2\xe7\xcf"
+			  "\x67\xf8\x74\x6e\x0f\xfe\xcc\x7b"
+			  "\x58\xcb\xbc\xc8\xdd\xd7\xf9\xae"
+			  "\xe6\x68\xf0\x0f\x15\xc7\x9b\xed"
+			  "\xfa\x42\x2d\x65\xb8\x29\xa2\x52"
+			  "\x0f\xbe\xa7\x18\x54\x29\x65\x88"
+			  "\x09\x86\xd5\x51\xfe\xb0\xc1\x85"
+			  "\x2b\x18\xb3\xdc\x2d\x30\xa6\x0b"
+			  "\xa1\x20\x78\xad\xac\x99\x03\x5c"
+			  "\x89\xa8\x82\x9a\xf7\x08\x0a\x21"
+			  "\x62\x84\xb3\xb6\xd9\xd4\x31\x09"
+			  "\x7a\x51\xf5\x22\x7d\x9b\xc5\x2f"
+			  "\x39\x1f\x25\x88\x42\xb2\x14\x31"
+			  "\xa6\x60\x3f\xa5\x40\xf8\x6d\xa3"
+			  "\x13\x19\xdd\x06\xae\x28\xb8\x19"
+			  "\xc6\x1f\x8a\x27\xae\xca\xd0\xa5"
+			  "\xa3\x13\x06\x49\x08\x32\x74\xf8"
+			  "\x20\xcb\x0b\xeb\xd1\xa8\xa5\x74"
+			  "\xcc\xc9\x51\x49\x01\x93\x83\x95"
+			  "\xc7\x39\xc1\x00\xbe\x63\x66\x6f"
+			  "\x7a\x99\xf8\x91\x87\x5f\x44\xf0"
+			  "\x7a\xc9\x00\xd1\x7a\xc7\x3e\xdb"
+			  "\xde\xb5\xeb\x67\xf7\x93\xfc\xec"
+			  "\xc4\xd4\x56\xd8\xbc\x5c\x6c\x68"
+			  "\xf6\x5b\xf0\x3d\x25\x90\x4d\xfd"
+			  "\x32\xa0\xba\x3d\x85\x4d\xfa\x69"
+			  "\x5a\x16\x6c\x0b\xe3\xa6\xb0\x9f"
+			  "\xd6\xe4\xdb\x7e\x11\xc5\xf9\xfb"
+			  "\x2c\x49\x56\xcf\x0c\x95\xb1\x6d"
+			  "\x3c\x6f\x04\xe3\x39\xf4\x82\xab"
+			  "\xc8\x1f\x7d\x89\xa3\xae\x22\x86"
+			  "\x0b\xa0\xaa\xca\x2e\x3c\xdb\x4f"
+			  "\x7f\xb9\x30\xeb\x8b\xfd\x45\x72"
+			  "\x94\x7c\xec\x75\x82\x3c\xee\x9b"
+			  "\xae\x6c\xde\x3d\xba\xaf\x45\x17"
+			  "\x70\x29\x51\x9e\xe9\x2e\x0c\x01"
+			  "\x9e\xa2\xdf\x13\x0d\xb9\xe5\x36"
+			  "\x7e\x4f\xce\x9d\x84\x13\x28\xbb"
+			  "\x2d\xa8\x4e\x4f\x1f\x83\x7e\x80"
+			  "\x04\x41\xd0\x76\x9b\x99\xe9\x62"
+			  "\x4f\xfb\x2a\x57\xc5\x5f\x1e\x8a"
+			  "\x00\xcd\xb3\x9e\xa7\x6b\x0c\x07"
+			  "\xbf\x56\xaf\xbf\x20\xcb\x4b\x77"
+			  "\x9a\xba\xf8\x78\x61\x47\xa7\xb0"
+			  "\xe1\xf2\x71\xc0\x53\xea\x93\x6c"
+			  "\xb0\x89\x58\xf8\x88\x1f\xd7\x33"
+			  "\xa5\x6d\x8c\x21\xbd\x41\xf6\xf1"
+			  "\xc0\x2e\x13\x79\xb8\x43\xb7\x19"
+			  "\x49\x16\x7e\x11\x45\x76\x9b\xbf"
+			  "\xe8\x23\x0e\x37\x20\x99\x86\x98"
+			  "\xc3\x4e\x9d\x1e\xe7\xee\x7a\x7a"
+			  "\x33\x5f\x05\x40\xe3\xe8\xdb\x06"
+			  "\xb6\x96\xdc\x18\xc6\xff\x65\x13"
+			  "\x52\x31\x1b\xad\xc4\x7c\xb3\xf2"
+			  "\xc9\xe8\x45\xc1\xed\x94\xde\x99"
+			  "\x56\xa4\x8c\x40\x9b\x4e\x68\xc6"
+			  "\xc1\x46\x7c\x7d\x57\xa2\xa2\x32"
+			  "\xc7\x58\xaa\x5b\xb6\xe8\x34\x90"
+			  "\xf3\xbf\x75\x62\x4a\x87\xc9\xa0"
+			  "\x09\x18\x08\x2b\x63\xa1\xb7\x94"
+			  "\x3d\x44\xb0\x12\xde\xf0\x26\xa7"
+			  "\xe9\x6a\x01\xc3\xe3\x5d\x9a\x02"
+			  "\x0b\x4c\xc8\xa2\x1e\xd7\x8c\x88"
+			  "\xd1\xd2\x26\x95\x34\xbb\x0c\x7c"
+			  "\x0c\x39\x77\xb5\x0a\x1f\x86\x94"
+			  "\xa1\x72\x11\x52\xa9\xc2\xc4\xc5"
+			  "\xe7\xda\x81\x8e\xaf\x6b\xdf\x3e"
+			  "\x5a\x02\x83\x32\x1a\x72\xb9\x2f"
+			  "\xd1\xe1\xed\x07\xe4\x46\x83\x0b"
+			  "\x68\x12\x6b\xe3\x20\x37\xff\x7a"
+			  "\x32\xbc\x4c\x0d\xd9\x57\x7d\x53"
+			  "\x19\x29\x1f\x4f\x66\xf8\xca\xe5"
+			  "\xf5\x9c\x19\x49\x20\xe4\x0b\x8f"
+			  "\x33\xac\x01\x7f\xb0\x28\x81\x8b"
+			  "\x05\xc0\x63\x59\x14\x8d\x1f\xdd"
+			  "\xe6\xb4\x12\x16\x2d\x7d\x89\x78"
+			  "\xc3\xdb\x93\x74\xd4\x7f\xcf\xeb"
+			  "\x23\x8d\x4c\x28\x4c\x0c\xd4\x28"
+			  "\xa4\xb8\xc2\x42\x90\x85\x13\xb2"
+			  "\x50\x21\x34\x81\x28\x14\xc8\xc9"
+			  "\xa6\x85\xd0\x13\xd1\x36\xd4\x55"
+			  "\x7f\x1f\x7a\x02\x3d\x30\x8d\x5a"
+			  "\x90\x7c\xb9\xde\xab\xa0\x8a\x9e"
+			  "\x66\xe6\x99\xdd\xbc\x12\x30\xeb"
+			  "\xd4\xfd\x55\xda\xad\xd1\xf4\xbe"
+			  "\x71\xb4\x59\x4a\xce\x36\xd0\x04"
+			  "\x7a\x42\x76\xe1\x4b\x09\x76\xd0"
+			  "\x20\x39\xcb\x69\xd7\xa6\xf5\x07"
+			  "\xcc\xed\x18\x2a\x3b\xf0\x50\x01"
+			  "\xc1\x02\x9c\x78\x2e\xef\x4b\xad"
+			  "\xc0\x43\xc8\x0a\x44\x06\xf8\x7a"
+			  "\xab\xe5\xd7\xaa\xf4\x9b\xbb\xfd"
+			  "\x2f\xb8\x72\xde\xbf\xd1\xeb\x2a"
+			  "\x78\x14\xda\x8b\xc9\x80\x9a\x5a"
+			  "\xd8\x12\xb6\xdc\xd8\xa5\xbd\x1f"
+			  "\xad\xae\x3b\x03\x98\x0a\xc0\x2a"
+			  "\xf4\x52\xde\x71\x5b\xef\x8b\xfa"
+			  "\x6c\x3f\xf7\x79\x99\x69\xa1\x34"
+			  "\x9e\xe3\xaf\x0f\x05\xe3\xbb\x17"
+			  "\x10\xe7\x0b\x55\x87\xc6\x31\xa0"
+			  "\x67\x72\x17\xe2\xfc\x89\x3e\xb8"
+			  "\x2e\xe1\x93\xe2\x2d\xbb\xea\x76"
+			  "\xb4\xec\xe0\x1e\x96\xf7\xc4\x6e"
+			  "\x0f\x4c\x2a\xa3\x80\xa3\xc9\x1d"
+			  "\x24\x35\x8e\xcd\x2b\xbf\xd8\x3f"
+			  "\x21\xcf\x0d\xa9\xc4\x91\xd5\xe3"
+			  "\x98\x7e\x7a\xe7\x14\x0f\x60\xd3"
+			  "\x3d\xb1\x2d\xa8\x5b\x1b\x72\x3d"
+			  "\xb4\xb2\xc9\x3a\xb2\x2d\x55\xc3"
+			  "\xd6\x4d\xc7\x86\x84\x1e\x25\x47"
+			  "\xfe\x38\xff\xc0\x57\x0e\x7f\x81"
+			  "\x84\xa2\x99\x62\x78\xf6\xba\x1a"
+			  "\x3a\x42\xe2\x08\x6c\xf9\x45\x48"
+			  "\xd6\x08\x05\xc2\xc0\xf4\x7b\xc3"
+			  "\x1b\x7c\xf4\xab\x08\x55\xee\x7d"
+			  "\x13\xa8\x0d\xb6\x93\x53\x63\xf8"
+			  "\xa9\xe3\xe2\x79\x4c\x89\xa8\x4b"
+			  "\x57\xa8\xe0\x7c\x76\xe1\xf2\x62"
+			  "\xb9\x85\x90\x8a\x28\x30\x7b\x19"
+			  "\x28\x48\x69\x67\xf6\x4c\x9a\xa6"
+			  "\x12\xbe\x41\x9c\x0b\x29\x02\xd3"
+			  "\x39\xfb\x4b\x74\x54\x0d\x09\xbd"
+			  "\x07\x40\xb5\xc6\x37\x4a\xfd\x7f"
+			  "\x92\x11\x81\xb3\x36\x15\x90\x74"
+			  "\xeb\x68\xd0\xa9\x5e\xbb\x86\xbe"
+			  "\x5a\xde\xa7\xf4\x4c\xfc\x8e\xa1"
+			  "\x83\xa2\x8d\x3a\xea\x16\x3b\xdb"
+			  "\x27\x99\x9e\xe8\x5a\x4f\x05\x32"
+			  "\x0e\x90\x2d\x03\xf9\x5f\x11\xd8"
+			  "\x79\xa6\x65\x35\x31\x66\x54\x83"
+			  "\xe9\x7f\x29\x3e\xc1\x11\xfc\x44"
+			  "\x6b\x82\x3a\x33\x9e\xab\x9f\x96"
+			  "\x9a\xf6\xfa\x57\x5a\x76\xa9\xd7"
+			  "\x09\x26\xe6\xd4\xd6\x5d\x99\x6f"
+			  "\x04\x19\xbc\x83\x83\x18\x2e\x22"
+			  "\xfc\x37\xe3\xcf\x1c\xc5\x16\x3e"
+			  "\xb9\x65\x82\xec\x70\xd9\xef\x83"
+			  "\x7c\x74\xed\xe1\x3e\x0b\x38\x52"
+			  "\xd4\xaa\xc2\xa4\x70\xc0\x0f\xd5"
+			  "\x58\x1e\xf8\xf4\x13\xd2\x6d\x51"
+			  "\x21\x5c\xd2\x0c\xd7\xec\x6a\xd4"
+			  "\x7b\xd4\xab\xf2\x69\xc2\x66\x08"
+			  "\x2b\x58\xd6\xa6\x65\xb7\xd1\xd8"
+			  "\xa3\x9f\xe9\xb0\xc4\x1b\x16\xb8"
+			  "\xb6\x65\x14\x36\x31\x09\xc3\x37"
+			  "\x25\x8f\x9e\xc9\xc9\xec\x53\xd1"
+			  "\x4f\x2f\x2c\xf7\x92\xf5\x0c\x4f"
+			  "\x59\x99\x10\xf1\xb4\x2e\x8b\xe6"
+			  "\x5b\xee\x6c\xd6\x02\xe8\xd2\x2b"
+			  "\x3b\x7c\xa7\x12\x10\x52\x15\x98"
+			  "\xe8\xa2\x11\x95\xaf\xd6\x59\xa1"
+			  "\x9a\x44\x61\x06\xc1\x8c\x3b\x5e"
+			  "\x54\xb0\x2c\x25\x1d\xc4\x83\x04"
+			  "\x83\x9a\x99\x28\x90\xfa\x86\x2d"
+			  "\x99\xda\x7f\xd9\xc2\x5a\x90\x89"
+			  "\x73\xba\x5a\xd8\xff\x18\x79\xdb"
+			  "\x1b\xfc\xb7\x34\xbd\x2e\x56\x27"
+			  "\xe8\x7c\x20\x73\xc5\x17\x7d\x4d"
+			  "\x8b\xf1\x0f\x3e\xd8\x54\x35\x3e"
+			  "\x1c\x42\xdd\x9d\x6a\x37\xde\xf2"
+			  "\x4e\xc5\x74\xec\xda\x41\xcf\xe9"
+			  "\x7e\x06\xaa\x60\xcc\xe3\x5f\x0e"
+			  "\x43\x08\xde\x4b\x76\x1e\xa5\x63"
+			  "\x70\x56\xb0\xe2\x1b\x08\x02\x9d"
+			  "\x47\xc0\x1f\x83\x06\x0d\x61\x80"
+			  "\x65\xa7\x6f\x10\x5f\x47\x9e\x41"
+			  "\xcf\x37\xff\xec\x64\xc0\x6c\xa2"
+			  "\xf6\x4a\xb4\xa8\x0d\xb9\x78\xf0"
+			  "\x9f\x4b\xb0\x48\x4c\xd4\x02\xe6"
+			  "\xa2\x6b\x58\xe8\xa6\xe4\x67\x9f"
+			  "\x56\x9a\x82\x16\xd9\x78\x66\x08"
+			  "\xa6\x4e\x07\x32\x46\x25\x58\xe2"
+			  "\xb9\xb8\x45\x06\xe2\x89\x76\xc3"
+			  "\xf1\xfc\x9f\xa9\x5d\x58\x8c\x3a"
+			  "\x53\x1c\xdf\x1e\x7f\xdf\xcd\xcd"
+			  "\x98\xaf\xcd\x2d\xd1\xd4\xaa\x97"
+			  "\x88\xd3\xbe\xb6\x2f\x72\xf7\x70"
+			  "\xf6\x94\xe6\xd8\x31\x2d\x79\x99"
+			  "\x1b\xb0\xca\x95\x41\x22\x83\x6e"
+			  "\x44\xb5\xfb\xcd\x61\x79\xa9\xca"
+			  "\xd5\xb6\xd0\xf2\x98\x9a\xfb\xb7",
+		.len	= 4096,
+	}
+};
+
 static const struct cipher_testvec aes_ctr_tv_template[] = {
 	{ /* From NIST Special Publication 800-38A, Appendix F.5 */
 		.key	= "\x2b\x7e\x15\x16\x28\xae\xd2\xa6"
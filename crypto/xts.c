@@ -16,6 +16,7 @@
 #include <linux/module.h>
 #include <linux/scatterlist.h>
 #include <linux/slab.h>
+#include <asm/unaligned.h>
 
 #include <crypto/xts.h>
 #include <crypto/b128ops.h>
@@ -443,20 +444,235 @@ static int xts_create(struct crypto_template *tmpl, struct rtattr **tb)
 	return err;
 }
 
-static struct crypto_template xts_tmpl = {
-	.name = "xts",
-	.create = xts_create,
-	.module = THIS_MODULE,
+/*
+ * xts-plain64: a request covers consecutive data units, each encrypted with
+ * the xts child using the plain64 IV of its own sector, see struct
+ * xts_plain64_iv. This generic version simply issues one child request per
+ * data unit; it is the reference that optimized implementations, which
+ * step the tweak in place, are tested against.
+ */
+struct xts_plain64_tfm_ctx {
+	struct crypto_skcipher *child;
+};
+
+struct xts_plain64_request_ctx {
+	struct scatterlist sg_src[2];
+	struct scatterlist sg_dst[2];
+	u8 iv[XTS_BLOCK_SIZE];
+	struct skcipher_request subreq;
+};
+
+static int xts_plain64_setkey(struct crypto_skcipher *parent, const u8 *key,
+			      unsigned int keylen)
+{
+	struct xts_plain64_tfm_ctx *ctx = crypto_skcipher_ctx(parent);
+	struct crypto_skcipher *child = ctx->child;
+
+	crypto_skcipher_clear_flags(child, CRYPTO_TFM_REQ_MASK);
+	crypto_skcipher_set_flags(child, crypto_skcipher_get_flags(parent) &
+					 CRYPTO_TFM_REQ_MASK);
+	return crypto_skcipher_setkey(child, key, keylen);
+}
+
+static int xts_plain64_crypt(struct skcipher_request *req, bool encrypt)
+{
+	struct crypto_skcipher *tfm = crypto_skcipher_reqtfm(req);
+	struct xts_plain64_tfm_ctx *ctx = crypto_skcipher_ctx(tfm);
+	struct xts_plain64_request_ctx *rctx = skcipher_request_ctx(req);
+	const struct xts_plain64_iv *iv = (const void *)req->iv;
+	struct skcipher_request *subreq = &rctx->subreq;
+	unsigned int du_size, offset;
+	u64 sector;
+	int err = 0;
+
+	/* 512 to 4096 byte data units, as used for disk sectors */
+	if (iv->du_bits < 9 || iv->du_bits > 12)
+		return -EINVAL;
+	du_size = 1U << iv->du_bits;
+	if (!req->cryptlen || req->cryptlen & (du_size - 1))
+		return -EINVAL;
+	sector = get_unaligned_le64(&iv->sector);
+
+	skcipher_request_set_tfm(subreq, ctx->child);
+	skcipher_request_set_callback(subreq, req->base.flags &
+					      CRYPTO_TFM_REQ_MAY_SLEEP,
+				      NULL, NULL);
+
+	for (offset = 0; offset < req->cryptlen; offset += du_size) {
+		struct scatterlist *src, *dst;
+
+		src = scatterwalk_ffwd(rctx->sg_src, req->src, offset);
+		dst = scatterwalk_ffwd(rctx->sg_dst, req->dst, offset);
+
+		memset(rctx->iv, 0, sizeof(rctx->iv));
+		put_unaligned_le64(sector++, rctx->iv);
+
+		skcipher_request_set_crypt(subreq, src, dst, du_size, rctx->iv);
+		err = encrypt ? crypto_skcipher_encrypt(subreq) :
+				crypto_skcipher_decrypt(subreq);
+		if (err)
+			break;
+	}
+
+	memzero_explicit(rctx->iv, sizeof(rctx->iv));
+	return err;
+}
+
+static int xts_plain64_encrypt(struct skcipher_request *req)
+{
+	return xts_plain64_crypt(req, true);
+}
+
+static int xts_plain64_decrypt(struct skcipher_request *req)
+{
+	return xts_plain64_crypt(req, false);
+}
+
+static int xts_plain64_init_tfm(struct crypto_skcipher *tfm)
+{
+	struct skcipher_instance *inst = skcipher_alg_instance(tfm);
+	struct xts_instance_ctx *ictx = skcipher_instance_ctx(inst);
+	struct xts_plain64_tfm_ctx *ctx = crypto_skcipher_ctx(tfm);
+	struct crypto_skcipher *child;
+
+	child = crypto_spawn_skcipher(&ictx->spawn);
+	if (IS_ERR(child))
+		return PTR_ERR(child);
+
+	ctx->child = child;
+
+	crypto_skcipher_set_reqsize(tfm, crypto_skcipher_reqsize(child) +
+					 sizeof(struct xts_plain64_request_ctx));
+
+	return 0;
+}
+
+static void xts_plain64_exit_tfm(struct crypto_skcipher *tfm)
+{
+	struct xts_plain64_tfm_ctx *ctx = crypto_skcipher_ctx(tfm);
+
+	crypto_free_skcipher(ctx->child);
+}
+
+static int xts_plain64_create(struct crypto_template *tmpl, struct rtattr **tb)
+{
+	struct skcipher_instance *inst;
+	struct xts_instance_ctx *ctx;
+	struct skcipher_alg *alg;
+	const char *cipher_name;
+	unsigned len;
+	u32 mask;
+	int err;
+
+	err = crypto_check_attr_type(tb, CRYPTO_ALG_TYPE_SKCIPHER, &mask);
+	if (err)
+		return err;
+
+	cipher_name = crypto_attr_alg_name(tb[1]);
+	if (IS_ERR(cipher_name))
+		return PTR_ERR(cipher_name);
+
+	inst = kzalloc(sizeof(*inst) + sizeof(*ctx), GFP_KERNEL);
+	if (!inst)
+		return -ENOMEM;
+
+	ctx = skcipher_instance_ctx(inst);
+
+	/* data units are done one after the other, so the child must be sync */
+	mask |= CRYPTO_ALG_ASYNC;
+
+	err = crypto_grab_skcipher(&ctx->spawn, skcipher_crypto_instance(inst),
+				   cipher_name, 0, mask);
+	if (err == -ENOENT) {
+		err = -ENAMETOOLONG;
+		if (snprintf(ctx->name, CRYPTO_MAX_ALG_NAME, "xts(%s)",
+			     cipher_name) >= CRYPTO_MAX_ALG_NAME)
+			goto err_free_inst;
+
+		err = crypto_grab_skcipher(&ctx->spawn,
+					   skcipher_crypto_instance(inst),
+					   ctx->name, 0, mask);
+	}
+
+	if (err)
+		goto err_free_inst;
+
+	alg = crypto_skcipher_spawn_alg(&ctx->spawn);
+
+	err = -EINVAL;
+	if (alg->base.cra_blocksize != XTS_BLOCK_SIZE ||
+	    crypto_skcipher_alg_ivsize(alg) != XTS_BLOCK_SIZE)
+		goto err_free_inst;
+
+	err = crypto_inst_setname(skcipher_crypto_instance(inst), "xts-plain64",
+				  &alg->base);
+	if (err)
+		goto err_free_inst;
+
+	/* "xts-plain64(xts(aes))" is named "xts-plain64(aes)" */
+	err = -EINVAL;
+	cipher_name = alg->base.cra_name;
+	if (strncmp(cipher_name, "xts(", 4))
+		goto err_free_inst;
+
+	len = strlcpy(ctx->name, cipher_name + 4, sizeof(ctx->name));
+	if (len < 2 || len >= sizeof(ctx->name) || ctx->name[len - 1] != ')')
+		goto err_free_inst;
+	ctx->name[len - 1] = 0;
+
+	if (snprintf(inst->alg.base.cra_name, CRYPTO_MAX_ALG_NAME,
+		     "xts-plain64(%s)", ctx->name) >= CRYPTO_MAX_ALG_NAME) {
+		err = -ENAMETOOLONG;
+		goto err_free_inst;
+	}
+
+	inst->alg.base.cra_priority = alg->base.cra_priority;
+	inst->alg.base.cra_blocksize = XTS_BLOCK_SIZE;
+	inst->alg.base.cra_alignmask = alg->base.cra_alignmask;
+
+	inst->alg.ivsize = sizeof(struct xts_plain64_iv);
+	inst->alg.min_keysize = crypto_skcipher_alg_min_keysize(alg);
+	inst->alg.max_keysize = crypto_skcipher_alg_max_keysize(alg);
+
+	inst->alg.base.cra_ctxsize = sizeof(struct xts_plain64_tfm_ctx);
+
+	inst->alg.init = xts_plain64_init_tfm;
+	inst->alg.exit = xts_plain64_exit_tfm;
+
+	inst->alg.setkey = xts_plain64_setkey;
+	inst->alg.encrypt = xts_plain64_encrypt;
+	inst->alg.decrypt = xts_plain64_decrypt;
+
+	inst->free = xts_free_instance;
+
+	err = skcipher_register_instance(tmpl, inst);
+	if (err) {
+err_free_inst:
+		xts_free_instance(inst);
+	}
+	return err;
+}
+
+static struct crypto_template xts_tmpls[] = {
+	{
+		.name = "xts",
+		.create = xts_create,
+		.module = THIS_MODULE,
+	}, {
+		.name = "xts-plain64",
+		.create = xts_plain64_create,
+		.module = THIS_MODULE,
+	},
 };
 
 static int __init xts_module_init(void)
 {
-	return crypto_register_template(&xts_tmpl);
+	return crypto_register_templates(xts_tmpls, ARRAY_SIZE(xts_tmpls));
 }
 
 static void __exit xts_module_exit(void)
 {
-	crypto_unregister_template(&xts_tmpl);
+	crypto_unregister_templates(xts_tmpls, ARRAY_SIZE(xts_tmpls));
 }
 
 subsys_initcall(xts_module_init);
@@ -465,5 +681,6 @@ module_exit(xts_module_exit);
 MODULE_LICENSE("GPL");
 MODULE_DESCRIPTION("XTS block cipher mode");
 MODULE_ALIAS_CRYPTO("xts");
+MODULE_ALIAS_CRYPTO("xts-plain64");
 MODULE_IMPORT_NS(CRYPTO_INTERNAL);
 MODULE_SOFTDEP("pre: ecb");
@@ -81,6 +81,8 @@ struct loop_device {
 struct loop_cmd {
 	struct list_head list_entry;
 	bool use_aio; /* use AIO interface to handle I/O */
+	bool nowait; /* aio issued from ->queue_rq with IOCB_NOWAIT */
+	bool nowait_busy; /* nowait issue got -EAGAIN, leave it to a worker */
 	atomic_t ref; /* only for aio */
 	long ret;
 	struct kiocb iocb;
@@ -341,6 +343,15 @@ static void lo_complete_rq(struct request *rq)
 	struct loop_cmd *cmd = blk_mq_rq_to_pdu(rq);
 	blk_status_t ret = BLK_STS_OK;
 
+	/* the backing device would have blocked, retry from a worker */
+	if (cmd->nowait && cmd->ret == -EAGAIN) {
+		cmd->ret = 0;
+		cmd->nowait_busy = true;
+		blk_mq_requeue_request(rq, true);
+		return;
+	}
+	cmd->nowait_busy = false;
+
 	if (!cmd->use_aio || cmd->ret < 0 || cmd->ret == blk_rq_bytes(rq) ||
 	    req_op(rq) != REQ_OP_READ) {
 		if (cmd->ret < 0)
@@ -392,7 +403,7 @@ static void lo_rw_aio_complete(struct kiocb *iocb, long ret)
 }
 
 static int lo_rw_aio(struct loop_device *lo, struct loop_cmd *cmd,
-		     loff_t pos, bool rw)
+		     loff_t pos, bool rw, bool nowait)
 {
 	struct iov_iter iter;
 	struct req_iterator rq_iter;
@@ -411,9 +422,9 @@ static int lo_rw_aio(struct loop_device *lo, struct loop_cmd *cmd,
 	if (rq->bio != rq->biotail) {
 
 		bvec = kmalloc_array(nr_bvec, sizeof(struct bio_vec),
-				     GFP_NOIO);
+				     nowait ? GFP_NOWAIT : GFP_NOIO);
 		if (!bvec)
-			return -EIO;
+			return nowait ? -EAGAIN : -EIO;
 		cmd->bvec = bvec;
 
 		/*
@@ -445,7 +456,7 @@ static int lo_rw_aio(struct loop_device *lo, struct loop_cmd *cmd,
 	cmd->iocb.ki_pos = pos;
 	cmd->iocb.ki_filp = file;
 	cmd->iocb.ki_complete = lo_rw_aio_complete;
-	cmd->iocb.ki_flags = IOCB_DIRECT;
+	cmd->iocb.ki_flags = IOCB_DIRECT | (nowait ? IOCB_NOWAIT : 0);
 	cmd->iocb.ki_ioprio = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_NONE, 0);
 
 	if (rw == WRITE)
@@ -453,6 +464,13 @@ static int lo_rw_aio(struct loop_device *lo, struct loop_cmd *cmd,
 	else
 		ret = call_read_iter(file, &cmd->iocb, &iter);
 
+	/* nothing was issued, the caller retries without IOCB_NOWAIT */
+	if (nowait && ret == -EAGAIN) {
+		kfree(cmd->bvec);
+		cmd->bvec = NULL;
+		return ret;
+	}
+
 	lo_rw_aio_do_completion(cmd);
 
 	if (ret != -EIOCBQUEUED)
@@ -490,12 +508,12 @@ static int do_req_filebacked(struct loop_device *lo, struct request *rq)
 		return lo_fallocate(lo, rq, pos, FALLOC_FL_PUNCH_HOLE);
 	case REQ_OP_WRITE:
 		if (cmd->use_aio)
-			return lo_rw_aio(lo, cmd, pos, WRITE);
+			return lo_rw_aio(lo, cmd, pos, WRITE, false);
 		else
 			return lo_write_simple(lo, rq, pos);
 	case REQ_OP_READ:
 		if (cmd->use_aio)
-			return lo_rw_aio(lo, cmd, pos, READ);
+			return lo_rw_aio(lo, cmd, pos, READ, false);
 		else
 			return lo_read_simple(lo, rq, pos);
 	default:
@@ -1805,9 +1823,90 @@ static const struct kernel_param_ops loop_hw_qdepth_param_ops = {
 device_param_cb(hw_queue_depth, &loop_hw_qdepth_param_ops, &hw_queue_depth, 0444);
 MODULE_PARM_DESC(hw_queue_depth, "Queue depth for each hardware queue. Default: 128");
 
+static int nr_hw_queues = 1;
+
+static int loop_set_nr_hw_queues(const char *s, const struct kernel_param *p)
+{
+	int ret = kstrtoint(s, 10, &nr_hw_queues);
+
+	return (ret || (nr_hw_queues < 1)) ? -EINVAL : 0;
+}
+
+static const struct kernel_param_ops loop_nr_hw_queues_param_ops = {
+	.set	= loop_set_nr_hw_queues,
+	.get	= param_get_int,
+};
+
+device_param_cb(nr_hw_queues, &loop_nr_hw_queues_param_ops, &nr_hw_queues, 0444);
+MODULE_PARM_DESC(nr_hw_queues, "Number of hardware queues, at most one per CPU. Default: 1");
+
+static bool nowait_dio = true;
+module_param(nowait_dio, bool, 0444);
+MODULE_PARM_DESC(nowait_dio, "Issue direct I/O from the submitter with IOCB_NOWAIT. Default: true");
+
 MODULE_LICENSE("GPL");
 MODULE_ALIAS_BLOCKDEV_MAJOR(LOOP_MAJOR);
 
+/*
+ * The workers charge a command to the blkcg of its first bio. Issuing it from
+ * the submitting context charges current's instead, so only do that when both
+ * are the same.
+ */
+static bool loop_blkcg_matches_current(struct request *rq)
+{
+#ifdef CONFIG_BLK_CGROUP
+	struct cgroup_subsys_state *css = bio_blkcg_css(rq->bio);
+	struct cgroup_subsys_state *cur;
+	bool match;
+
+	if (!css)
+		return true;
+
+	rcu_read_lock();
+	cur = kthread_blkcg();
+	if (!cur)
+		cur = task_css(current, io_cgrp_id);
+	match = cur == css;
+	rcu_read_unlock();
+	return match;
+#else
+	return true;
+#endif
+}
+
+/*
+ * Direct I/O is first issued from the submitting context with IOCB_NOWAIT,
+ * so that a backing file that can take it without blocking does not pay
+ * for the worker hop. Anything that would block is left to the workers.
+ */
+static bool loop_queue_rq_nowait(struct loop_device *lo, struct loop_cmd *cmd)
+{
+	struct request *rq = blk_mq_rq_from_pdu(cmd);
+	loff_t pos = ((loff_t) blk_rq_pos(rq) << 9) + lo->lo_offset;
+	const bool write = req_op(rq) == REQ_OP_WRITE;
+	unsigned int noio_flag;
+	int ret;
+
+	if (!nowait_dio || !cmd->use_aio || cmd->nowait_busy)
+		return false;
+	if (!(lo->lo_backing_file->f_mode & FMODE_NOWAIT))
+		return false;
+	if (write && (lo->lo_flags & LO_FLAGS_READ_ONLY))
+		return false;
+	if (!loop_blkcg_matches_current(rq))
+		return false;
+
+	cmd->nowait = true;
+	noio_flag = memalloc_noio_save();
+	ret = lo_rw_aio(lo, cmd, pos, write ? WRITE : READ, true);
+	memalloc_noio_restore(noio_flag);
+	if (ret) {
+		cmd->nowait = false;
+		return false;
+	}
+	return true;
+}
+
 static blk_status_t loop_queue_rq(struct blk_mq_hw_ctx *hctx,
 		const struct blk_mq_queue_data *bd)
 {
@@ -1831,6 +1930,10 @@ static blk_status_t loop_queue_rq(struct blk_mq_hw_ctx *hctx,
 		break;
 	}
 
+	cmd->nowait = false;
+	if (loop_queue_rq_nowait(lo, cmd))
+		return BLK_STS_OK;
+
 	/* always use the first bio's css */
 	cmd->blkcg_css = NULL;
 	cmd->memcg_css = NULL;
@@ -1896,8 +1999,11 @@ static void loop_process_work(struct loop_worker *worker,
 {
 	int orig_flags = current->flags;
 	struct loop_cmd *cmd;
+	struct blk_plug plug;
 
 	current->flags |= PF_LOCAL_THROTTLE | PF_MEMALLOC_NOIO;
+	/* batch what the backing file submits for the whole list */
+	blk_start_plug(&plug);
 	spin_lock_irq(&lo->lo_work_lock);
 	while (!list_empty(cmd_list)) {
 		cmd = container_of(
@@ -1922,6 +2028,7 @@ static void loop_process_work(struct loop_worker *worker,
 		loop_set_timer(lo);
 	}
 	spin_unlock_irq(&lo->lo_work_lock);
+	blk_finish_plug(&plug);
 	current->flags = orig_flags;
 }
 
@@ -1977,12 +2084,20 @@ static int loop_add(int i)
 	i = err;
 
 	lo->tag_set.ops = &loop_mq_ops;
-	lo->tag_set.nr_hw_queues = 1;
+	lo->tag_set.nr_hw_queues = min_t(unsigned int, nr_hw_queues,
+					 nr_cpu_ids);
 	lo->tag_set.queue_depth = hw_queue_depth;
 	lo->tag_set.numa_node = NUMA_NO_NODE;
 	lo->tag_set.cmd_size = sizeof(struct loop_cmd);
 	lo->tag_set.flags = BLK_MQ_F_SHOULD_MERGE | BLK_MQ_F_STACKING |
 		BLK_MQ_F_NO_SCHED_BY_DEFAULT;
+	/*
+	 * ->queue_rq may sleep issuing nowait direct I/O to the backing file.
+	 * The backing file is not known yet, so this covers buffered devices
+	 * too; nowait_dio=0 keeps the non-blocking tag set.
+	 */
+	if (nowait_dio)
+		lo->tag_set.flags |= BLK_MQ_F_BLOCKING;
 	lo->tag_set.driver_data = lo;
 
 	err = blk_mq_alloc_tag_set(&lo->tag_set);
@@ -59,6 +59,8 @@
 struct ublk_rq_data {
 	struct llist_node node;
 	struct callback_head work;
+	/* zero copy: held by ublksrv and by each registered io buffer */
+	refcount_t ref;
 };
 
 struct ublk_uring_cmd_pdu {
@@ -286,6 +288,13 @@ static inline bool ublk_need_get_data(const struct ublk_queue *ubq)
 	return false;
 }
 
+static inline bool ublk_support_zero_copy(const struct ublk_queue *ubq)
+{
+	if (ubq->flags & UBLK_F_SUPPORT_ZERO_COPY)
+		return true;
+	return false;
+}
+
 static struct ublk_device *ublk_get_device(struct ublk_device *ub)
 {
 	if (kobject_get_unless_zero(&ub->cdev_dev.kobj))
@@ -470,6 +479,11 @@ static int ublk_map_io(const struct ublk_queue *ubq, const struct request *req,
 		struct ublk_io *io)
 {
 	const unsigned int rq_bytes = blk_rq_bytes(req);
+
+	/* ublksrv gets at the pages through REGISTER_IO_BUF instead */
+	if (ublk_support_zero_copy(ubq))
+		return rq_bytes;
+
 	/*
 	 * no zero copy, we delay copy WRITE request data into ublksrv
 	 * context and the big benefit is that pinning pages in current
@@ -499,6 +513,9 @@ static int ublk_unmap_io(const struct ublk_queue *ubq,
 {
 	const unsigned int rq_bytes = blk_rq_bytes(req);
 
+	if (ublk_support_zero_copy(ubq))
+		return rq_bytes;
+
 	if (req_op(req) == REQ_OP_READ && ublk_rq_has_data(req)) {
 		struct ublk_map_data data = {
 			.ubq	=	ubq,
@@ -634,6 +651,35 @@ static void ublk_complete_rq(struct request *req)
 		__blk_mq_end_request(req, BLK_STS_OK);
 }
 
+static inline void ublk_init_req_ref(const struct ublk_queue *ubq,
+		struct request *req)
+{
+	if (ublk_support_zero_copy(ubq)) {
+		struct ublk_rq_data *data = blk_mq_rq_to_pdu(req);
+
+		refcount_set(&data->ref, 1);
+	}
+}
+
+static inline bool ublk_get_req_ref(struct request *req)
+{
+	struct ublk_rq_data *data = blk_mq_rq_to_pdu(req);
+
+	return refcount_inc_not_zero(&data->ref);
+}
+
+/*
+ * In zero copy mode the request completes once ublksrv has committed it
+ * and every io buffer registered over its pages has been released.
+ */
+static inline void ublk_put_req_ref(struct request *req)
+{
+	struct ublk_rq_data *data = blk_mq_rq_to_pdu(req);
+
+	if (refcount_dec_and_test(&data->ref))
+		ublk_complete_rq(req);
+}
+
 /*
  * Since __ublk_rq_task_work always fails requests immediately during
  * exiting, __ublk_fail_req() is only called from abort context during
@@ -648,11 +694,18 @@ static void __ublk_fail_req(struct ublk_queue *ubq, struct ublk_io *io,
 	WARN_ON_ONCE(io->flags & UBLK_IO_FLAG_ACTIVE);
 
 	if (!(io->flags & UBLK_IO_FLAG_ABORTED)) {
+		struct ublk_rq_data *data = blk_mq_rq_to_pdu(req);
+
 		io->flags |= UBLK_IO_FLAG_ABORTED;
-		if (ublk_queue_can_use_recovery_reissue(ubq))
+		if (ublk_support_zero_copy(ubq) && refcount_read(&data->ref)) {
+			/* the pages may still be lent out, wait for them */
+			io->res = -EIO;
+			ublk_put_req_ref(req);
+		} else if (ublk_queue_can_use_recovery_reissue(ubq)) {
 			blk_mq_requeue_request(req, false);
-		else
+		} else {
 			blk_mq_end_request(req, BLK_STS_IOERR);
+		}
 	}
 }
 
@@ -761,6 +814,7 @@ static inline void __ublk_rq_task_work(struct request *req)
 			mapped_bytes >> 9;
 	}
 
+	ublk_init_req_ref(ubq, req);
 	ubq_complete_io_cmd(io, UBLK_IO_RES_OK);
 }
 
@@ -970,8 +1024,12 @@ static void ublk_commit_completion(struct ublk_device *ub,
 	/* find the io request and complete */
 	req = blk_mq_tag_to_rq(ub->tag_set.tags[qid], tag);
 
-	if (req && likely(!blk_should_fake_timeout(req->q)))
-		ublk_complete_rq(req);
+	if (req && likely(!blk_should_fake_timeout(req->q))) {
+		if (ublk_support_zero_copy(ubq))
+			ublk_put_req_ref(req);
+		else
+			ublk_complete_rq(req);
+	}
 }
 
 /*
@@ -1194,6 +1252,37 @@ static void ublk_handle_need_get_data(struct ublk_device *ub, int q_id,
 	ublk_queue_cmd(ubq, req);
 }
 
+static void ublk_io_release(void *priv)
+{
+	ublk_put_req_ref(priv);
+}
+
+static int ublk_register_io_buf(struct io_uring_cmd *cmd,
+		struct ublk_device *ub, struct ublk_queue *ubq,
+		struct ublk_io *io, unsigned int tag, unsigned int index,
+		unsigned int issue_flags)
+{
+	struct request *req;
+	int ret;
+
+	if (!ublk_support_zero_copy(ubq))
+		return -EINVAL;
+	if (!(io->flags & UBLK_IO_FLAG_OWNED_BY_SRV))
+		return -EINVAL;
+
+	req = blk_mq_tag_to_rq(ub->tag_set.tags[ubq->q_id], tag);
+	if (!req || !ublk_rq_has_data(req))
+		return -EINVAL;
+	if (!ublk_get_req_ref(req))
+		return -EINVAL;
+
+	ret = io_buffer_register_bvec(cmd, req, ublk_io_release, index,
+			issue_flags);
+	if (ret)
+		ublk_put_req_ref(req);
+	return ret;
+}
+
 static int ublk_ch_uring_cmd(struct io_uring_cmd *cmd, unsigned int issue_flags)
 {
 	struct ublksrv_io_cmd *ub_cmd = (struct ublksrv_io_cmd *)cmd->cmd;
@@ -1226,6 +1315,14 @@ static int ublk_ch_uring_cmd(struct io_uring_cmd *cmd, unsigned int issue_flags)
 
 	io = &ubq->ios[tag];
 
+	/* the buffer may outlive the io it was registered for */
+	if (cmd_op == UBLK_IO_UNREGISTER_IO_BUF) {
+		if (ublk_support_zero_copy(ubq))
+			ret = io_buffer_unregister_bvec(cmd, ub_cmd->addr,
+					issue_flags);
+		goto out;
+	}
+
 	/* there is pending io cmd, something must be wrong */
 	if (io->flags & UBLK_IO_FLAG_ACTIVE) {
 		ret = -EBUSY;
@@ -1253,8 +1350,8 @@ static int ublk_ch_uring_cmd(struct io_uring_cmd *cmd, unsigned int issue_flags)
 		 */
 		if (io->flags & UBLK_IO_FLAG_OWNED_BY_SRV)
 			goto out;
-		/* FETCH_RQ has to provide IO buffer */
-		if (!ub_cmd->addr)
+		/* FETCH_RQ has to provide IO buffer unless zero copy */
+		if (!ub_cmd->addr && !ublk_support_zero_copy(ubq))
 			goto out;
 		io->cmd = cmd;
 		io->flags |= UBLK_IO_FLAG_ACTIVE;
@@ -1263,8 +1360,8 @@ static int ublk_ch_uring_cmd(struct io_uring_cmd *cmd, unsigned int issue_flags)
 		ublk_mark_io_ready(ub, ubq);
 		break;
 	case UBLK_IO_COMMIT_AND_FETCH_REQ:
-		/* FETCH_RQ has to provide IO buffer */
-		if (!ub_cmd->addr)
+		/* FETCH_RQ has to provide IO buffer unless zero copy */
+		if (!ub_cmd->addr && !ublk_support_zero_copy(ubq))
 			goto out;
 		if (!(io->flags & UBLK_IO_FLAG_OWNED_BY_SRV))
 			goto out;
@@ -1281,6 +1378,10 @@ static int ublk_ch_uring_cmd(struct io_uring_cmd *cmd, unsigned int issue_flags)
 		io->flags |= UBLK_IO_FLAG_ACTIVE;
 		ublk_handle_need_get_data(ub, ub_cmd->q_id, ub_cmd->tag);
 		break;
+	case UBLK_IO_REGISTER_IO_BUF:
+		ret = ublk_register_io_buf(cmd, ub, ubq, io, tag, ub_cmd->addr,
+				issue_flags);
+		goto out;
 	default:
 		goto out;
 	}
@@ -1673,8 +1774,9 @@ static int ublk_ctrl_add_dev(struct io_uring_cmd *cmd)
 	if (!IS_BUILTIN(CONFIG_BLK_DEV_UBLK))
 		ub->dev_info.flags |= UBLK_F_URING_CMD_COMP_IN_TASK;
 
-	/* We are not ready to support zero copy */
-	ub->dev_info.flags &= ~UBLK_F_SUPPORT_ZERO_COPY;
+	/* there is no ublksrv buffer to get data into with zero copy */
+	if (ub->dev_info.flags & UBLK_F_SUPPORT_ZERO_COPY)
+		ub->dev_info.flags &= ~UBLK_F_NEED_GET_DATA;
 
 	ub->dev_info.nr_hw_queues = min_t(unsigned int,
 			ub->dev_info.nr_hw_queues, nr_cpu_ids);
@@ -521,10 +521,20 @@ static void bch_btree_leaf_dirty(struct btree *b, atomic_t *journal_ref)
 #define mca_can_free(c)						\
 	max_t(int, 0, c->btree_cache_used - mca_reserve(c))
 
+static void btree_node_lookup_set(struct btree *b, struct btree_lookup *l)
+{
+	struct btree_lookup *old;
+
+	old = unrcu_pointer(xchg(&b->lookup, RCU_INITIALIZER(l)));
+	if (old)
+		kfree_rcu(old, rcu);
+}
+
 static void mca_data_free(struct btree *b)
 {
 	BUG_ON(b->io_mutex.count != 1);
 
+	btree_node_lookup_set(b, NULL);
 	bch_btree_keys_free(&b->keys);
 
 	b->c->btree_cache_used--;
@@ -537,6 +547,7 @@ static void mca_bucket_free(struct btree *b)
 
 	b->key.ptr[0] = 0;
 	hlist_del_init_rcu(&b->hash);
+	btree_node_lookup_set(b, NULL);
 	list_move(&b->list, &b->c->btree_cache_freeable);
 }
 
@@ -593,6 +604,7 @@ static int mca_reap(struct btree *b, unsigned int min_order, bool flush)
 
 	if (!down_write_trylock(&b->lock))
 		return -ENOMEM;
+	btree_node_write_begin(b);
 
 	BUG_ON(btree_node_dirty(b) && !b->keys.set[0].data);
 
@@ -931,11 +943,13 @@ static struct btree *mca_alloc(struct cache_set *c, struct btree_op *op,
 		goto err;
 
 	BUG_ON(!down_write_trylock(&b->lock));
+	btree_node_write_begin(b);
 	if (!b->keys.set->data)
 		goto err;
 out:
 	BUG_ON(b->io_mutex.count != 1);
 
+	btree_node_lookup_set(b, NULL);
 	bkey_copy(&b->key, k);
 	list_move(&b->list, &c->btree_cache);
 	hlist_del_init_rcu(&b->hash);
@@ -1002,7 +1016,7 @@ struct btree *bch_btree_node_get(struct cache_set *c, struct btree_op *op,
 		bch_btree_node_read(b);
 
 		if (!write)
-			downgrade_write(&b->lock);
+			rw_downgrade(b);
 	} else {
 		rw_lock(write, b, level);
 		if (PTR_HASH(c, &b->key) != PTR_HASH(c, k)) {
@@ -2409,7 +2423,7 @@ int bch_btree_insert_check_key(struct btree *b, struct btree_op *op,
 	BUG_ON(!ret && !bch_keylist_empty(&insert));
 out:
 	if (upgrade)
-		downgrade_write(&b->lock);
+		rw_downgrade(b);
 	return ret;
 }
 
@@ -2485,7 +2499,7 @@ void bch_btree_set_root(struct btree *b)
 	list_del_init(&b->list);
 	mutex_unlock(&b->c->bucket_lock);
 
-	b->c->root = b;
+	WRITE_ONCE(b->c->root, b);
 
 	bch_journal_meta(b->c, &cl);
 	closure_sync(&cl);
@@ -2528,6 +2542,215 @@ int __bch_btree_map_nodes(struct btree_op *op, struct cache_set *c,
 	return bcache_btree_root(map_nodes_recurse, c, op, from, fn, flags);
 }
 
+/*
+ * Lockless lookups
+ *
+ * Readers that only ever read lock the leaf (op->lock < 0, i.e. the cache
+ * read path and keybuf refills) skip the read locks of the root and the
+ * interior nodes: with a hot cache those rwsems, the root's in particular,
+ * are taken by every lookup on every CPU and their cachelines bounce.
+ *
+ * Instead, the locked path leaves an immutable copy of each interior node's
+ * child pointers (struct btree_lookup) behind, and lookups walk those copies
+ * under rcu_read_lock() down to the leaf, which they read lock as before.
+ *
+ * A copy can be stale, that's fine: a node's key range never changes while
+ * the node exists - splits, GC rewrites and coalescing all replace nodes, and
+ * free the old ones under their write lock. So if the leaf we end up at is
+ * still hashed under the pointer we followed once it's locked, it is the leaf
+ * for the key. The one exception is the root, whose range covers everything;
+ * it is only replaced under its write lock, so checking its seq is enough.
+ *
+ * Anything that fails those checks, a node that has to be read in or a
+ * restart (-EINTR) falls back to the locked walk.
+ */
+
+#define BTREE_LOOKUP_U64s	(sizeof(struct bkey) / sizeof(__u64) + 1)
+
+static struct bkey *btree_lookup_key(struct btree_lookup *l, unsigned int i)
+{
+	return (void *) (l->keys + i * BTREE_LOOKUP_U64s);
+}
+
+/* Index of the first child whose key is after @search */
+static unsigned int btree_lookup_search(struct btree_lookup *l,
+					struct bkey *search)
+{
+	unsigned int li = 0, ri = l->nr;
+
+	if (!search)
+		return 0;
+
+	while (li < ri) {
+		unsigned int m = (li + ri) >> 1;
+
+		if (bkey_cmp(btree_lookup_key(l, m), search) > 0)
+			ri = m;
+		else
+			li = m + 1;
+	}
+
+	return li;
+}
+
+static void btree_node_lookup_refresh(struct btree *b)
+{
+	unsigned long seq = READ_ONCE(b->seq);
+	struct btree_lookup *l;
+	struct btree_iter iter;
+	struct bkey *k;
+	size_t u64s = 0;
+	unsigned int i;
+	bool fresh;
+
+	/* A copy made under our own write lock is stale once we unlock */
+	if (seq & 1)
+		return;
+
+	/*
+	 * Other readers of the node may replace the copy concurrently and
+	 * free the old one after a grace period.
+	 */
+	rcu_read_lock();
+	l = rcu_dereference(b->lookup);
+	fresh = l && l->seq == seq && l->hash == PTR_HASH(b->c, &b->key);
+	rcu_read_unlock();
+	if (fresh)
+		return;
+
+	/* Every child pointer is at least BTREE_LOOKUP_U64s in the node */
+	for (i = 0; i <= b->keys.nsets; i++)
+		u64s += b->keys.set[i].data->keys;
+
+	l = kmalloc(struct_size(l, keys, u64s), GFP_NOIO|__GFP_NOWARN);
+	if (!l)
+		return;
+
+	l->seq		= seq;
+	l->hash		= PTR_HASH(b->c, &b->key);
+	l->level	= b->level;
+	l->nr		= 0;
+
+	for_each_key_filter(&b->keys, k, &iter, bch_ptr_bad)
+		bch_bkey_copy_single_ptr(btree_lookup_key(l, l->nr++), k, 0);
+
+	btree_node_lookup_set(b, l);
+}
+
+/*
+ * Find and read lock the leaf covering @search without locking the nodes
+ * above it. Returns NULL if there are no keys after @search, or
+ * ERR_PTR(-EINTR) if the locked walk has to be used instead.
+ */
+static struct btree *btree_lookup_leaf(struct cache_set *c,
+				       struct bkey *search)
+{
+	BKEY_PADDED(key) child;
+	struct btree *root, *parent = NULL, *b;
+	struct btree_lookup *l;
+	unsigned long seq;
+	uint64_t hash;
+	unsigned int i, level = 0;
+
+	rcu_read_lock();
+
+	root = READ_ONCE(c->root);
+	if (IS_ERR_OR_NULL(root) || !root->level)
+		goto fail;
+
+	seq = READ_ONCE(root->seq);
+	smp_rmb();
+	if ((seq & 1) || READ_ONCE(c->root) != root)
+		goto fail;
+
+	b = root;
+	hash = PTR_HASH(c, &root->key);
+
+	while (1) {
+		l = rcu_dereference(b->lookup);
+		if (!l || l->hash != hash || l->seq != READ_ONCE(b->seq) ||
+		    (b != root && l->level + 1 != level))
+			goto fail;
+		level = l->level;
+
+		i = btree_lookup_search(l, search);
+		if (i == l->nr) {
+			/* Past the last key of the root: nothing left to map */
+			if (b != root)
+				goto fail;
+			rcu_read_unlock();
+			b = NULL;
+			goto check_root;
+		}
+
+		bkey_copy(&child.key, btree_lookup_key(l, i));
+		hash = PTR_HASH(c, &child.key);
+
+		parent = b;
+		b = mca_find(c, &child.key);
+		if (!b)
+			goto fail;
+
+		if (l->level == 1)
+			break;
+	}
+
+	rcu_read_unlock();
+
+	rw_lock(false, b, 0);
+
+	if (PTR_HASH(c, &b->key) != hash ||
+	    hlist_unhashed(&b->hash) ||
+	    b->level ||
+	    !b->written ||
+	    btree_node_io_error(b) ||
+	    (search && bkey_cmp(search, &b->key) >= 0)) {
+		rw_unlock(false, b);
+		return ERR_PTR(-EINTR);
+	}
+
+	b->parent = parent;
+check_root:
+	smp_rmb();
+	if (READ_ONCE(c->root) != root || READ_ONCE(root->seq) != seq) {
+		if (b)
+			rw_unlock(false, b);
+		return ERR_PTR(-EINTR);
+	}
+
+	return b;
+fail:
+	rcu_read_unlock();
+	return ERR_PTR(-EINTR);
+}
+
+static int bch_btree_map_keys_lockless(struct btree_op *op,
+				       struct cache_set *c,
+				       struct bkey **from, struct bkey *next,
+				       btree_map_keys_fn *fn, int flags)
+{
+	struct bkey *start = *from;
+	int ret = MAP_CONTINUE;
+
+	while (1) {
+		struct btree *b = btree_lookup_leaf(c, *from);
+
+		if (IS_ERR_OR_NULL(b))
+			return b ? PTR_ERR(b) : ret;
+
+		ret = bch_btree_map_keys_recurse(b, op, start, fn, flags);
+		*next = KEY(KEY_INODE(&b->key), KEY_OFFSET(&b->key), 0);
+		rw_unlock(false, b);
+
+		if (ret != MAP_CONTINUE)
+			return ret;
+
+		/* Carry on with the next leaf, from its first key */
+		*from = next;
+		start = NULL;
+	}
+}
+
 int bch_btree_map_keys_recurse(struct btree *b, struct btree_op *op,
 				      struct bkey *from, btree_map_keys_fn *fn,
 				      int flags)
@@ -2536,6 +2759,9 @@ int bch_btree_map_keys_recurse(struct btree *b, struct btree_op *op,
 	struct bkey *k;
 	struct btree_iter iter;
 
+	if (b->level)
+		btree_node_lookup_refresh(b);
+
 	bch_btree_iter_init(&b->keys, &iter, from);
 
 	while ((k = bch_btree_iter_next_filter(&iter, &b->keys, bch_ptr_bad))) {
@@ -2559,6 +2785,17 @@ int bch_btree_map_keys_recurse(struct btree *b, struct btree_op *op,
 int bch_btree_map_keys(struct btree_op *op, struct cache_set *c,
 		       struct bkey *from, btree_map_keys_fn *fn, int flags)
 {
+	struct bkey next;
+
+	if (op->lock < 0) {
+		int ret = bch_btree_map_keys_lockless(op, c, &from, &next,
+						      fn, flags);
+
+		/* Restarts take the locked path, from where we got to */
+		if (ret != -EINTR)
+			return ret;
+	}
+
 	return bcache_btree_root(map_keys_recurse, c, op, from, fn, flags);
 }
 
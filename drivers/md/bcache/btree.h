@@ -114,6 +114,21 @@ struct btree_write {
 	int			prio_blocked;
 };
 
+/*
+ * Immutable copy of an interior node's child pointers, so that lookups can
+ * walk down to a leaf without taking the read locks of the nodes above it.
+ * It describes the node as of @seq and is replaced, never modified.
+ */
+struct btree_lookup {
+	struct rcu_head		rcu;
+	unsigned long		seq;
+	uint64_t		hash;
+	unsigned int		level;
+	unsigned int		nr;
+	/* nr keys with one pointer each */
+	uint64_t		keys[];
+};
+
 struct btree {
 	/* Hottest entries first */
 	struct hlist_node	hash;
@@ -121,10 +136,12 @@ struct btree {
 	/* Key/pointer for this btree node */
 	BKEY_PADDED(key);
 
+	/* Odd while write locked, see rw_lock() */
 	unsigned long		seq;
 	struct rw_semaphore	lock;
 	struct cache_set	*c;
 	struct btree		*parent;
+	struct btree_lookup __rcu *lookup;
 
 	struct mutex		write_lock;
 
@@ -245,21 +262,43 @@ static inline void bch_btree_op_init(struct btree_op *op, int write_lock_level)
 	op->lock = write_lock_level;
 }
 
+/*
+ * b->seq works like a seqcount: it is odd for as long as the node is write
+ * locked, so lockless readers can tell whether the node changed under them.
+ */
+static inline void btree_node_write_begin(struct btree *b)
+{
+	WRITE_ONCE(b->seq, b->seq + 1);
+	smp_wmb();
+}
+
+static inline void btree_node_write_end(struct btree *b)
+{
+	smp_wmb();
+	WRITE_ONCE(b->seq, b->seq + 1);
+}
+
 static inline void rw_lock(bool w, struct btree *b, int level)
 {
 	w ? down_write_nested(&b->lock, level + 1)
 	  : down_read_nested(&b->lock, level + 1);
 	if (w)
-		b->seq++;
+		btree_node_write_begin(b);
 }
 
 static inline void rw_unlock(bool w, struct btree *b)
 {
 	if (w)
-		b->seq++;
+		btree_node_write_end(b);
 	(w ? up_write : up_read)(&b->lock);
 }
 
+static inline void rw_downgrade(struct btree *b)
+{
+	btree_node_write_end(b);
+	downgrade_write(&b->lock);
+}
+
 void bch_btree_node_read_done(struct btree *b);
 void __bch_btree_node_write(struct btree *b, struct closure *parent);
 void bch_btree_node_write(struct btree *b, struct closure *parent);
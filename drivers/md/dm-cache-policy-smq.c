@@ -687,6 +687,163 @@ static void h_remove(struct smq_hash_table *ht, struct entry *e)
 
 /*----------------------------------------------------------------*/
 
+/*
+ * Count-min sketch of access frequencies, used by the tlfu variant for
+ * TinyLFU style admission.  Four rows of 4 bit saturating counters, with
+ * a row as wide as the cache has blocks, so it costs two bytes per cache
+ * block, capped at 2MB.  Every sample_size increments all counters are
+ * halved, so old popularity fades and the sketch follows workload shifts.
+ */
+#define SKETCH_ROWS 4u
+#define SKETCH_MIN_WIDTH_BITS 10u
+#define SKETCH_MAX_WIDTH_BITS 20u
+#define SKETCH_SAMPLE_FACTOR 10u
+
+static const u64 sketch_seeds[SKETCH_ROWS] = {
+	0x9e3779b97f4a7c15ull, 0xc2b2ae3d27d4eb4full,
+	0x165667b19e3779f9ull, 0xd6e8feb86659fd93ull,
+};
+
+struct cm_sketch {
+	u8 *counters;
+	unsigned width_bits;
+	unsigned nr_increments;
+	unsigned sample_size;
+};
+
+static int sketch_init(struct cm_sketch *cs, unsigned nr_blocks)
+{
+	cs->width_bits = clamp((unsigned) order_base_2(max(nr_blocks, 1u)),
+			       SKETCH_MIN_WIDTH_BITS, SKETCH_MAX_WIDTH_BITS);
+	cs->nr_increments = 0;
+	cs->sample_size = SKETCH_SAMPLE_FACTOR << cs->width_bits;
+	cs->counters = vzalloc((SKETCH_ROWS << cs->width_bits) / 2u);
+
+	return cs->counters ? 0 : -ENOMEM;
+}
+
+static void sketch_exit(struct cm_sketch *cs)
+{
+	vfree(cs->counters);
+}
+
+static unsigned sketch_pos(struct cm_sketch *cs, unsigned row, dm_oblock_t b)
+{
+	u64 h = from_oblock(b) * sketch_seeds[row];
+
+	return (row << cs->width_bits) + (unsigned) (h >> (64u - cs->width_bits));
+}
+
+static unsigned sketch_get(struct cm_sketch *cs, unsigned pos)
+{
+	u8 c = cs->counters[pos >> 1];
+
+	return (pos & 1u) ? c >> 4 : c & 0xfu;
+}
+
+static void sketch_halve(struct cm_sketch *cs)
+{
+	u64 *c = (u64 *) cs->counters;
+	size_t i, len = (SKETCH_ROWS << cs->width_bits) / 2u / sizeof(u64);
+
+	for (i = 0; i < len; i++)
+		c[i] = (c[i] >> 1) & 0x7777777777777777ull;
+}
+
+static void sketch_inc(struct cm_sketch *cs, dm_oblock_t b)
+{
+	unsigned row, pos;
+
+	for (row = 0; row < SKETCH_ROWS; row++) {
+		pos = sketch_pos(cs, row, b);
+		if (sketch_get(cs, pos) < 15u)
+			cs->counters[pos >> 1] += (pos & 1u) ? 0x10u : 0x01u;
+	}
+
+	if (++cs->nr_increments >= cs->sample_size) {
+		sketch_halve(cs);
+		cs->nr_increments /= 2u;
+	}
+}
+
+static unsigned sketch_estimate(struct cm_sketch *cs, dm_oblock_t b)
+{
+	unsigned row, est = 15u;
+
+	for (row = 0; row < SKETCH_ROWS; row++)
+		est = min(est, sketch_get(cs, sketch_pos(cs, row, b)));
+
+	return est;
+}
+
+/*
+ * Ghost list: fingerprints of recently demoted blocks, in 4 way buckets
+ * replaced round robin.  Four bytes per cache block, capped at 16MB.  A
+ * false positive only makes a block a promotion candidate a little early.
+ */
+#define GHOST_WAYS 4u
+#define GHOST_MAX_BUCKET_BITS 20u
+
+struct ghost_list {
+	u32 *fps;
+	unsigned bucket_bits;
+	unsigned clock;
+};
+
+static int ghost_init(struct ghost_list *gl, unsigned nr_blocks)
+{
+	gl->bucket_bits = clamp((unsigned) order_base_2(max(nr_blocks / GHOST_WAYS, 1u)),
+				1u, GHOST_MAX_BUCKET_BITS);
+	gl->clock = 0;
+	gl->fps = vzalloc(array_size(GHOST_WAYS << gl->bucket_bits, sizeof(u32)));
+
+	return gl->fps ? 0 : -ENOMEM;
+}
+
+static void ghost_exit(struct ghost_list *gl)
+{
+	vfree(gl->fps);
+}
+
+static u32 *ghost_bucket(struct ghost_list *gl, dm_oblock_t b, u32 *fp)
+{
+	u64 h = hash_64(from_oblock(b), 64u - 1u);
+
+	/* zero marks an empty slot */
+	*fp = (u32) h | 1u;
+	return gl->fps + GHOST_WAYS * ((h >> 32) & ((1u << gl->bucket_bits) - 1u));
+}
+
+static void ghost_insert(struct ghost_list *gl, dm_oblock_t b)
+{
+	unsigned i;
+	u32 fp, *bucket = ghost_bucket(gl, b, &fp);
+
+	for (i = 0; i < GHOST_WAYS; i++) {
+		if (!bucket[i] || bucket[i] == fp) {
+			bucket[i] = fp;
+			return;
+		}
+	}
+	bucket[gl->clock++ % GHOST_WAYS] = fp;
+}
+
+static bool ghost_remove(struct ghost_list *gl, dm_oblock_t b)
+{
+	unsigned i;
+	u32 fp, *bucket = ghost_bucket(gl, b, &fp);
+
+	for (i = 0; i < GHOST_WAYS; i++) {
+		if (bucket[i] == fp) {
+			bucket[i] = 0;
+			return true;
+		}
+	}
+	return false;
+}
+
+/*----------------------------------------------------------------*/
+
 struct entry_alloc {
 	struct entry_space *es;
 	unsigned begin;
@@ -855,6 +1012,24 @@ struct smq_policy {
 	struct background_tracker *bg_work;
 
 	bool migrations_allowed;
+
+	/*
+	 * The tlfu variant only admits a block into a full cache if the
+	 * sketch rates it above the block it would displace by more than
+	 * admit_margin.  Hits on the ghost list of recently demoted blocks
+	 * mean we displaced blocks still in use, so they raise the margin;
+	 * it decays again while there are none.
+	 */
+	bool tlfu;
+	struct cm_sketch sketch;
+	struct ghost_list ghost;
+	unsigned admit_margin;
+	unsigned period_ghost_hits;
+
+	unsigned long long hits;
+	unsigned long long misses;
+	unsigned long long ghost_hits;
+	unsigned long long admit_rejects;
 };
 
 /*----------------------------------------------------------------*/
@@ -1090,6 +1265,8 @@ static void update_level_jump(struct smq_policy *mq)
 	}
 }
 
+#define TLFU_MAX_ADMIT_MARGIN 4u
+
 static void end_hotspot_period(struct smq_policy *mq)
 {
 	clear_bitset(mq->hotspot_hit_bits, mq->nr_hotspot_blocks);
@@ -1100,6 +1277,15 @@ static void end_hotspot_period(struct smq_policy *mq)
 		q_redistribute(&mq->hotspot);
 		stats_reset(&mq->hotspot_stats);
 		mq->next_hotspot_period = jiffies + HOTSPOT_UPDATE_PERIOD;
+
+		if (mq->tlfu) {
+			if (mq->period_ghost_hits)
+				mq->admit_margin = min(mq->admit_margin + 1u,
+						       TLFU_MAX_ADMIT_MARGIN);
+			else if (mq->admit_margin)
+				mq->admit_margin--;
+			mq->period_ghost_hits = 0;
+		}
 	}
 }
 
@@ -1225,6 +1411,21 @@ static void queue_demotion(struct smq_policy *mq)
 	}
 }
 
+/*
+ * TinyLFU admission: only make room for @oblock if it has been accessed
+ * more often than the clean block that would be demoted for it.
+ */
+static bool tlfu_admit(struct smq_policy *mq, dm_oblock_t oblock)
+{
+	struct entry *victim = q_peek(&mq->clean, mq->clean.nr_levels / 2, true);
+
+	if (!victim)
+		return true;
+
+	return sketch_estimate(&mq->sketch, oblock) >
+		sketch_estimate(&mq->sketch, victim->oblock) + mq->admit_margin;
+}
+
 static void queue_promotion(struct smq_policy *mq, dm_oblock_t oblock,
 			    struct policy_work **workp)
 {
@@ -1236,6 +1437,11 @@ static void queue_promotion(struct smq_policy *mq, dm_oblock_t oblock,
 		return;
 
 	if (allocator_empty(&mq->cache_alloc)) {
+		if (mq->tlfu && !tlfu_admit(mq, oblock)) {
+			mq->admit_rejects++;
+			return;
+		}
+
 		/*
 		 * We always claim to be 'idle' to ensure some demotions happen
 		 * with continuous loads.
@@ -1354,6 +1560,8 @@ static void smq_destroy(struct dm_cache_policy *p)
 	struct smq_policy *mq = to_smq_policy(p);
 
 	btracker_destroy(mq->bg_work);
+	ghost_exit(&mq->ghost);
+	sketch_exit(&mq->sketch);
 	h_exit(&mq->hotspot_table);
 	h_exit(&mq->table);
 	free_bitset(mq->hotspot_hit_bits);
@@ -1373,9 +1581,13 @@ static int __lookup(struct smq_policy *mq, dm_oblock_t oblock, dm_cblock_t *cblo
 
 	*background_work = false;
 
+	if (mq->tlfu)
+		sketch_inc(&mq->sketch, oblock);
+
 	e = h_lookup(&mq->table, oblock);
 	if (e) {
 		stats_level_accessed(&mq->cache_stats, e->level);
+		mq->hits++;
 
 		requeue(mq, e);
 		*cblock = infer_cblock(mq, e);
@@ -1383,6 +1595,7 @@ static int __lookup(struct smq_policy *mq, dm_oblock_t oblock, dm_cblock_t *cblo
 
 	} else {
 		stats_miss(&mq->cache_stats);
+		mq->misses++;
 
 		/*
 		 * The hotspot queue only gets updated with misses.
@@ -1390,6 +1603,17 @@ static int __lookup(struct smq_policy *mq, dm_oblock_t oblock, dm_cblock_t *cblo
 		hs_e = update_hotspot_queue(mq, oblock);
 
 		pr = should_promote(mq, hs_e, data_dir, fast_copy);
+
+		/*
+		 * A recently demoted block coming back doesn't have to
+		 * climb the hotspot queue again, admission still applies.
+		 */
+		if (mq->tlfu && ghost_remove(&mq->ghost, oblock)) {
+			mq->ghost_hits++;
+			mq->period_ghost_hits++;
+			pr = PROMOTE_PERMANENT;
+		}
+
 		if (pr != PROMOTE_NOT) {
 			queue_promotion(mq, oblock, work);
 			*background_work = true;
@@ -1482,6 +1706,8 @@ static void __complete_background_work(struct smq_policy *mq,
 	case POLICY_DEMOTE:
 		// h, !q, a
 		if (success) {
+			if (mq->tlfu)
+				ghost_insert(&mq->ghost, e->oblock);
 			h_remove(&mq->table, e);
 			free_entry(&mq->cache_alloc, e);
 			// !h, !q, !a
@@ -1674,6 +1900,37 @@ static int mq_emit_config_values(struct dm_cache_policy *p, char *result,
 	return 0;
 }
 
+/*
+ * smq-tlfu reports its hit ratio and admission statistics as read only
+ * config values in the status line.
+ */
+static int tlfu_emit_config_values(struct dm_cache_policy *p, char *result,
+				   unsigned maxlen, ssize_t *sz_ptr)
+{
+	struct smq_policy *mq = to_smq_policy(p);
+	unsigned long long hits, misses, ghost_hits, admit_rejects;
+	unsigned margin;
+	unsigned long flags;
+	ssize_t sz = *sz_ptr;
+
+	spin_lock_irqsave(&mq->lock, flags);
+	hits = mq->hits;
+	misses = mq->misses;
+	ghost_hits = mq->ghost_hits;
+	admit_rejects = mq->admit_rejects;
+	margin = mq->admit_margin;
+	spin_unlock_irqrestore(&mq->lock, flags);
+
+	DMEMIT("12 hits %llu misses %llu hit_permille %llu "
+	       "ghost_hits %llu admit_rejects %llu admit_margin %u ",
+	       hits, misses,
+	       hits + misses ? div64_u64(hits * 1000, hits + misses) : 0,
+	       ghost_hits, admit_rejects, margin);
+
+	*sz_ptr = sz;
+	return 0;
+}
+
 /* Init the policy plugin interface function pointers. */
 static void init_policy_functions(struct smq_policy *mq, bool mimic_mq)
 {
@@ -1694,6 +1951,8 @@ static void init_policy_functions(struct smq_policy *mq, bool mimic_mq)
 	if (mimic_mq) {
 		mq->policy.set_config_value = mq_set_config_value;
 		mq->policy.emit_config_values = mq_emit_config_values;
+	} else if (mq->tlfu) {
+		mq->policy.emit_config_values = tlfu_emit_config_values;
 	}
 }
 
@@ -1722,7 +1981,8 @@ static struct dm_cache_policy *__smq_create(dm_cblock_t cache_size,
 					    sector_t origin_size,
 					    sector_t cache_block_size,
 					    bool mimic_mq,
-					    bool migrations_allowed)
+					    bool migrations_allowed,
+					    bool tlfu)
 {
 	unsigned i;
 	unsigned nr_sentinels_per_queue = 2u * NR_CACHE_LEVELS;
@@ -1732,6 +1992,7 @@ static struct dm_cache_policy *__smq_create(dm_cblock_t cache_size,
 	if (!mq)
 		return NULL;
 
+	mq->tlfu = tlfu;
 	init_policy_functions(mq, mimic_mq);
 	mq->cache_size = cache_size;
 	mq->cache_block_size = cache_block_size;
@@ -1808,10 +2069,25 @@ static struct dm_cache_policy *__smq_create(dm_cblock_t cache_size,
 	if (!mq->bg_work)
 		goto bad_btracker;
 
+	if (tlfu) {
+		if (sketch_init(&mq->sketch, from_cblock(cache_size))) {
+			DMERR("couldn't allocate frequency sketch");
+			goto bad_sketch;
+		}
+		if (ghost_init(&mq->ghost, from_cblock(cache_size))) {
+			DMERR("couldn't allocate ghost list");
+			goto bad_ghost;
+		}
+	}
+
 	mq->migrations_allowed = migrations_allowed;
 
 	return &mq->policy;
 
+bad_ghost:
+	sketch_exit(&mq->sketch);
+bad_sketch:
+	btracker_destroy(mq->bg_work);
 bad_btracker:
 	h_exit(&mq->hotspot_table);
 bad_alloc_hotspot_table:
@@ -1832,21 +2108,28 @@ static struct dm_cache_policy *smq_create(dm_cblock_t cache_size,
 					  sector_t origin_size,
 					  sector_t cache_block_size)
 {
-	return __smq_create(cache_size, origin_size, cache_block_size, false, true);
+	return __smq_create(cache_size, origin_size, cache_block_size, false, true, false);
+}
+
+static struct dm_cache_policy *tlfu_create(dm_cblock_t cache_size,
+					   sector_t origin_size,
+					   sector_t cache_block_size)
+{
+	return __smq_create(cache_size, origin_size, cache_block_size, false, true, true);
 }
 
 static struct dm_cache_policy *mq_create(dm_cblock_t cache_size,
 					 sector_t origin_size,
 					 sector_t cache_block_size)
 {
-	return __smq_create(cache_size, origin_size, cache_block_size, true, true);
+	return __smq_create(cache_size, origin_size, cache_block_size, true, true, false);
 }
 
 static struct dm_cache_policy *cleaner_create(dm_cblock_t cache_size,
 					      sector_t origin_size,
 					      sector_t cache_block_size)
 {
-	return __smq_create(cache_size, origin_size, cache_block_size, false, false);
+	return __smq_create(cache_size, origin_size, cache_block_size, false, false, false);
 }
 
 /*----------------------------------------------------------------*/
@@ -1859,6 +2142,14 @@ static struct dm_cache_policy_type smq_policy_type = {
 	.create = smq_create
 };
 
+static struct dm_cache_policy_type tlfu_policy_type = {
+	.name = "smq-tlfu",
+	.version = {1, 0, 0},
+	.hint_size = 4,
+	.owner = THIS_MODULE,
+	.create = tlfu_create,
+};
+
 static struct dm_cache_policy_type mq_policy_type = {
 	.name = "mq",
 	.version = {2, 0, 0},
@@ -1912,8 +2203,16 @@ static int __init smq_init(void)
 		goto out_default;
 	}
 
+	r = dm_cache_policy_register(&tlfu_policy_type);
+	if (r) {
+		DMERR("register failed (as smq-tlfu) %d", r);
+		goto out_tlfu;
+	}
+
 	return 0;
 
+out_tlfu:
+	dm_cache_policy_unregister(&default_policy_type);
 out_default:
 	dm_cache_policy_unregister(&cleaner_policy_type);
 out_cleaner:
@@ -1926,6 +2225,7 @@ static int __init smq_init(void)
 
 static void __exit smq_exit(void)
 {
+	dm_cache_policy_unregister(&tlfu_policy_type);
 	dm_cache_policy_unregister(&cleaner_policy_type);
 	dm_cache_policy_unregister(&smq_policy_type);
 	dm_cache_policy_unregister(&mq_policy_type);
@@ -1942,3 +2242,4 @@ MODULE_DESCRIPTION("smq cache policy");
 MODULE_ALIAS("dm-cache-default");
 MODULE_ALIAS("dm-cache-mq");
 MODULE_ALIAS("dm-cache-cleaner");
+MODULE_ALIAS("dm-cache-smq-tlfu");
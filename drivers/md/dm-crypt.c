@@ -34,6 +34,7 @@
 #include <crypto/skcipher.h>
 #include <crypto/aead.h>
 #include <crypto/authenc.h>
+#include <crypto/xts.h>
 #include <linux/rtnetlink.h> /* for struct rtattr and RTA macros only */
 #include <linux/key-type.h>
 #include <keys/user-type.h>
@@ -91,6 +92,15 @@ struct dm_crypt_request {
 	u64 iv_sector;
 };
 
+/*
+ * Per-CPU conversion counters, reported by the "stats" message
+ */
+struct crypt_stats {
+	u64 bytes[2];		/* indexed by READ / WRITE */
+	u64 requests;		/* crypto requests submitted */
+	u64 units;		/* sectors those requests covered */
+};
+
 struct crypt_config;
 
 struct crypt_iv_operations {
@@ -181,6 +191,12 @@ struct crypt_config {
 	unsigned tfms_count;
 	unsigned long cipher_flags;
 
+	/* converts runs of sectors in one request, see crypt_alloc_batch_tfm() */
+	struct crypto_skcipher *batch_tfm;
+
+	struct crypt_stats __percpu *stats;
+	ktime_t stats_start;
+
 	/*
 	 * Layout of each crypto request:
 	 *
@@ -1458,6 +1474,88 @@ static int crypt_convert_block_skcipher(struct crypt_config *cc,
 	return r;
 }
 
+/*
+ * Map as much of @iter as fits in the DM_CRYPT_BATCH_SEGS entries of @sg,
+ * up to @limit bytes, stopping at the first segment that isn't made of
+ * whole sectors.
+ */
+#define DM_CRYPT_BATCH_SEGS	ARRAY_SIZE(((struct dm_crypt_request *)0)->sg_in)
+
+static unsigned int crypt_batch_sg(struct crypt_config *cc, struct bio *bio,
+				   struct bvec_iter iter, struct scatterlist *sg,
+				   unsigned int limit)
+{
+	unsigned int len = 0, n = 0;
+
+	sg_init_table(sg, DM_CRYPT_BATCH_SEGS);
+	while (iter.bi_size && n < DM_CRYPT_BATCH_SEGS && len < limit) {
+		struct bio_vec bv = bio_iter_iovec(bio, iter);
+		unsigned int seg = min(bv.bv_len, limit - len);
+
+		if (seg & (cc->sector_size - 1))
+			break;
+		sg_set_page(&sg[n++], bv.bv_page, seg, bv.bv_offset);
+		len += seg;
+		bio_advance_iter_single(bio, &iter, seg);
+	}
+	if (n)
+		sg_mark_end(&sg[n - 1]);
+
+	return len;
+}
+
+/*
+ * Convert as many sectors as the scatterlists of one dm_crypt_request can
+ * describe with a single request to cc->batch_tfm, setting *units to the
+ * number of sectors covered.
+ */
+static int crypt_convert_batch_skcipher(struct crypt_config *cc,
+					struct convert_context *ctx,
+					struct skcipher_request *req,
+					unsigned int tag_offset,
+					unsigned int *units)
+{
+	struct dm_crypt_request *dmreq = dmreq_of_req(cc, req);
+	struct xts_plain64_iv *iv;
+	unsigned int len;
+	int r;
+
+	len = crypt_batch_sg(cc, ctx->bio_in, ctx->iter_in, dmreq->sg_in,
+			     UINT_MAX);
+	len = crypt_batch_sg(cc, ctx->bio_out, ctx->iter_out, dmreq->sg_out,
+			     len);
+	len = crypt_batch_sg(cc, ctx->bio_in, ctx->iter_in, dmreq->sg_in, len);
+	if (len <= cc->sector_size) {
+		*units = 1;
+		return crypt_convert_block_skcipher(cc, ctx, req, tag_offset);
+	}
+
+	dmreq->iv_sector = ctx->cc_sector;
+	if (test_bit(CRYPT_IV_LARGE_SECTORS, &cc->cipher_flags))
+		dmreq->iv_sector >>= cc->sector_shift;
+	dmreq->ctx = ctx;
+	*org_sector_of_dmreq(cc, dmreq) = cpu_to_le64(ctx->cc_sector - cc->iv_offset);
+
+	iv = (struct xts_plain64_iv *)iv_of_dmreq(cc, dmreq);
+	memset(iv, 0, sizeof(*iv));
+	iv->sector = cpu_to_le64(dmreq->iv_sector);
+	iv->du_bits = cc->sector_shift + SECTOR_SHIFT;
+
+	skcipher_request_set_tfm(req, cc->batch_tfm);
+	skcipher_request_set_crypt(req, dmreq->sg_in, dmreq->sg_out, len, iv);
+
+	if (bio_data_dir(ctx->bio_in) == WRITE)
+		r = crypto_skcipher_encrypt(req);
+	else
+		r = crypto_skcipher_decrypt(req);
+
+	bio_advance_iter(ctx->bio_in, &ctx->iter_in, len);
+	bio_advance_iter(ctx->bio_out, &ctx->iter_out, len);
+	*units = len >> (cc->sector_shift + SECTOR_SHIFT);
+
+	return r;
+}
+
 static void kcryptd_async_done(struct crypto_async_request *async_req,
 			       int error);
 
@@ -1542,6 +1640,18 @@ static void crypt_free_req(struct crypt_config *cc, void *req, struct bio *base_
 		crypt_free_req_skcipher(cc, req, base_bio);
 }
 
+static void crypt_account(struct crypt_config *cc,
+			  struct convert_context *ctx, unsigned int units)
+{
+	struct crypt_stats *stats = get_cpu_ptr(cc->stats);
+
+	stats->bytes[bio_data_dir(ctx->bio_in)] +=
+		units << (cc->sector_shift + SECTOR_SHIFT);
+	stats->requests++;
+	stats->units += units;
+	put_cpu_ptr(cc->stats);
+}
+
 /*
  * Encrypt / decrypt data from one bio to another one (can be the same one)
  */
@@ -1550,6 +1660,7 @@ static blk_status_t crypt_convert(struct crypt_config *cc,
 {
 	unsigned int tag_offset = 0;
 	unsigned int sector_step = cc->sector_size >> SECTOR_SHIFT;
+	unsigned int units;
 	int r;
 
 	/*
@@ -1570,11 +1681,18 @@ static blk_status_t crypt_convert(struct crypt_config *cc,
 
 		atomic_inc(&ctx->cc_pending);
 
+		units = 1;
 		if (crypt_integrity_aead(cc))
 			r = crypt_convert_block_aead(cc, ctx, ctx->r.req_aead, tag_offset);
+		else if (cc->batch_tfm)
+			r = crypt_convert_batch_skcipher(cc, ctx, ctx->r.req,
+							 tag_offset, &units);
 		else
 			r = crypt_convert_block_skcipher(cc, ctx, ctx->r.req, tag_offset);
 
+		if (r == 0 || r == -EINPROGRESS || r == -EBUSY)
+			crypt_account(cc, ctx, units);
+
 		switch (r) {
 		/*
 		 * The request was queued by a crypto driver
@@ -1593,8 +1711,8 @@ static blk_status_t crypt_convert(struct crypt_config *cc,
 					 * exit and continue processing in a workqueue
 					 */
 					ctx->r.req = NULL;
-					ctx->cc_sector += sector_step;
-					tag_offset++;
+					ctx->cc_sector += sector_step * units;
+					tag_offset += units;
 					return BLK_STS_DEV_RESOURCE;
 				}
 			} else {
@@ -1608,16 +1726,16 @@ static blk_status_t crypt_convert(struct crypt_config *cc,
 		 */
 		case -EINPROGRESS:
 			ctx->r.req = NULL;
-			ctx->cc_sector += sector_step;
-			tag_offset++;
+			ctx->cc_sector += sector_step * units;
+			tag_offset += units;
 			continue;
 		/*
 		 * The request was already processed (synchronously).
 		 */
 		case 0:
 			atomic_dec(&ctx->cc_pending);
-			ctx->cc_sector += sector_step;
-			tag_offset++;
+			ctx->cc_sector += sector_step * units;
+			tag_offset += units;
 			if (!atomic)
 				cond_resched();
 			continue;
@@ -2270,6 +2388,11 @@ static void crypt_free_tfms_skcipher(struct crypt_config *cc)
 
 	kfree(cc->cipher_tfm.tfms);
 	cc->cipher_tfm.tfms = NULL;
+
+	if (cc->batch_tfm) {
+		crypto_free_skcipher(cc->batch_tfm);
+		cc->batch_tfm = NULL;
+	}
 }
 
 static void crypt_free_tfms(struct crypt_config *cc)
@@ -2311,6 +2434,48 @@ static int crypt_alloc_tfms_skcipher(struct crypt_config *cc, char *ciphermode)
 	return 0;
 }
 
+/*
+ * xts(aes) with plain64 IVs that step by one per sector can hand whole runs
+ * of sectors to an "xts-plain64(aes)" implementation, where one is
+ * available. Without one, every sector is a request of its own.
+ */
+static void crypt_alloc_batch_tfm(struct crypt_config *cc)
+{
+	struct crypto_skcipher *tfm;
+
+	if (crypt_integrity_aead(cc) || cc->integrity_iv_size ||
+	    cc->tfms_count != 1 || cc->iv_gen_ops != &crypt_iv_plain64_ops ||
+	    test_bit(CRYPT_ENCRYPT_PREPROCESS, &cc->cipher_flags))
+		return;
+	if (cc->sector_size != (1 << SECTOR_SHIFT) &&
+	    !test_bit(CRYPT_IV_LARGE_SECTORS, &cc->cipher_flags))
+		return;
+	if (strcmp(crypto_skcipher_alg(any_tfm(cc))->base.cra_name, "xts(aes)"))
+		return;
+
+	tfm = crypto_alloc_skcipher("xts-plain64(aes)", 0,
+				    CRYPTO_ALG_ALLOCATES_MEMORY);
+	if (IS_ERR(tfm))
+		return;
+	/*
+	 * The generic template splits the request back into one xts request
+	 * per sector, on a synchronous xts(aes) that may not be the one in
+	 * cc->cipher_tfm. It only exists as a reference for the self-tests.
+	 */
+	if (!strncmp(crypto_skcipher_alg(tfm)->base.cra_driver_name,
+		     "xts-plain64(", 12) ||
+	    crypto_skcipher_reqsize(tfm) > crypto_skcipher_reqsize(any_tfm(cc)) ||
+	    crypto_skcipher_alignmask(tfm) > crypto_skcipher_alignmask(any_tfm(cc)) ||
+	    crypto_skcipher_ivsize(tfm) != cc->iv_size) {
+		crypto_free_skcipher(tfm);
+		return;
+	}
+
+	DMDEBUG_LIMIT("batching sectors using implementation \"%s\"",
+		      crypto_skcipher_alg(tfm)->base.cra_driver_name);
+	cc->batch_tfm = tfm;
+}
+
 static int crypt_alloc_tfms_aead(struct crypt_config *cc, char *ciphermode)
 {
 	int err;
@@ -2405,6 +2570,12 @@ static int crypt_setkey(struct crypt_config *cc)
 			err = r;
 	}
 
+	if (cc->batch_tfm) {
+		r = crypto_skcipher_setkey(cc->batch_tfm, cc->key, subkey_size);
+		if (r)
+			err = r;
+	}
+
 	if (crypt_integrity_hmac(cc))
 		memzero_explicit(cc->authenc_key, crypt_authenckey_size(cc));
 
@@ -2712,6 +2883,7 @@ static void crypt_dtr(struct dm_target *ti)
 
 	WARN_ON(percpu_counter_sum(&cc->n_allocated_pages) != 0);
 	percpu_counter_destroy(&cc->n_allocated_pages);
+	free_percpu(cc->stats);
 
 	if (cc->iv_gen_ops && cc->iv_gen_ops->dtr)
 		cc->iv_gen_ops->dtr(cc);
@@ -3029,6 +3201,8 @@ static int crypt_ctr_cipher(struct dm_target *ti, char *cipher_in, char *key)
 	if (ret < 0)
 		return ret;
 
+	crypt_alloc_batch_tfm(cc);
+
 	/* Initialize and set key */
 	ret = crypt_set_key(cc, key);
 	if (ret < 0) {
@@ -3200,6 +3374,14 @@ static int crypt_ctr(struct dm_target *ti, unsigned int argc, char **argv)
 	if (ret < 0)
 		goto bad;
 
+	cc->stats = alloc_percpu(struct crypt_stats);
+	if (!cc->stats) {
+		ti->error = "Cannot allocate statistics";
+		ret = -ENOMEM;
+		goto bad;
+	}
+	cc->stats_start = ktime_get();
+
 	/* Optional parameters need to be read before cipher constructor */
 	if (argc > 5) {
 		ret = crypt_ctr_optional(ti, argc - 5, &argv[5]);
@@ -3565,9 +3747,36 @@ static void crypt_resume(struct dm_target *ti)
 	clear_bit(DM_CRYPT_SUSPENDED, &cc->flags);
 }
 
+static void crypt_emit_stats(struct crypt_config *cc, char *result,
+			     unsigned maxlen)
+{
+	u64 bytes[2] = { 0, 0 }, requests = 0, units = 0, elapsed_ms;
+	unsigned sz = 0;
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		struct crypt_stats *stats = per_cpu_ptr(cc->stats, cpu);
+
+		bytes[READ] += READ_ONCE(stats->bytes[READ]);
+		bytes[WRITE] += READ_ONCE(stats->bytes[WRITE]);
+		requests += READ_ONCE(stats->requests);
+		units += READ_ONCE(stats->units);
+	}
+	elapsed_ms = max_t(s64, ktime_ms_delta(ktime_get(), cc->stats_start), 1);
+
+	DMEMIT("decrypted_bytes %llu encrypted_bytes %llu requests %llu sectors %llu",
+	       bytes[READ], bytes[WRITE], requests, units);
+	DMEMIT(" elapsed_ms %llu throughput_kib_s %llu batching %s",
+	       elapsed_ms,
+	       div64_u64(((bytes[READ] + bytes[WRITE]) >> 10) * 1000, elapsed_ms),
+	       cc->batch_tfm ?
+	       crypto_skcipher_alg(cc->batch_tfm)->base.cra_driver_name : "off");
+}
+
 /* Message interface
  *	key set <key>
  *	key wipe
+ *	stats
  */
 static int crypt_message(struct dm_target *ti, unsigned argc, char **argv,
 			 char *result, unsigned maxlen)
@@ -3575,6 +3784,11 @@ static int crypt_message(struct dm_target *ti, unsigned argc, char **argv,
 	struct crypt_config *cc = ti->private;
 	int key_size, ret = -EINVAL;
 
+	if (argc == 1 && !strcasecmp(argv[0], "stats")) {
+		crypt_emit_stats(cc, result, maxlen);
+		return 1;
+	}
+
 	if (argc < 2)
 		goto error;
 
@@ -3640,7 +3854,7 @@ static void crypt_io_hints(struct dm_target *ti, struct queue_limits *limits)
 
 static struct target_type crypt_target = {
 	.name   = "crypt",
-	.version = {1, 24, 0},
+	.version = {1, 25, 0},
 	.module = THIS_MODULE,
 	.ctr    = crypt_ctr,
 	.dtr    = crypt_dtr,
@@ -37,6 +37,9 @@
 #define MIN_LOG2_INTERLEAVE_SECTORS	3
 #define MAX_LOG2_INTERLEAVE_SECTORS	31
 #define METADATA_WORKQUEUE_MAX_ACTIVE	16
+#define CHECKSUM_PARALLEL_MIN_BYTES	(256 * 1024)
+#define CHECKSUM_CHUNK_BYTES		(64 * 1024)
+#define COMMIT_BATCH_MAX_NS		(1000 * NSEC_PER_USEC)
 #define RECALC_SECTORS			32768
 #define RECALC_WRITE_SUPER		16
 #define BITMAP_BLOCK_SIZE		4096	/* don't change it */
@@ -160,6 +163,14 @@ struct alg_spec {
 	unsigned key_size;
 };
 
+/*
+ * Per-CPU counters, reported by the "stats" message
+ */
+struct integrity_stats {
+	u64 checksum_bytes;
+	u64 parallel_bios;
+};
+
 struct dm_integrity_c {
 	struct dm_dev *dev;
 	struct dm_dev *meta_dev;
@@ -217,6 +228,7 @@ struct dm_integrity_c {
 	int failed;
 
 	struct crypto_shash *internal_hash;
+	struct workqueue_struct *checksum_wq;
 
 	struct dm_target *ti;
 
@@ -245,6 +257,14 @@ struct dm_integrity_c {
 	struct workqueue_struct *commit_wq;
 	struct work_struct commit_work;
 
+	/* only touched by integrity_commit, read by the "stats" message */
+	u64 commits;
+	u64 commit_sections;
+	u64 commit_flushes;
+	unsigned commit_batch_max;
+	unsigned last_commit_flushes;
+	u64 commit_time_avg_ns;
+
 	struct workqueue_struct *writer_wq;
 	struct work_struct writer_work;
 
@@ -279,6 +299,9 @@ struct dm_integrity_c {
 
 	atomic64_t number_of_mismatches;
 
+	struct integrity_stats __percpu *stats;
+	ktime_t stats_start;
+
 	struct notifier_block reboot_notifier;
 };
 
@@ -1692,6 +1715,7 @@ static void integrity_sector_checksum(struct dm_integrity_c *ic, sector_t sector
 	if (unlikely(digest_size < ic->tag_size))
 		memset(result + digest_size, 0, ic->tag_size - digest_size);
 
+	this_cpu_add(ic->stats->checksum_bytes, ic->sectors_per_block << SECTOR_SHIFT);
 	return;
 
 failed:
@@ -1699,6 +1723,126 @@ static void integrity_sector_checksum(struct dm_integrity_c *ic, sector_t sector
 	get_random_bytes(result, ic->tag_size);
 }
 
+struct checksum_chunk {
+	struct work_struct work;
+	struct dm_integrity_c *ic;
+	struct bio *bio;
+	struct bvec_iter iter;
+	sector_t sector;
+	char *checksums;
+	atomic_t *pending;
+	struct completion *done;
+};
+
+static void integrity_checksum_range(struct dm_integrity_c *ic, struct bio *bio,
+				     struct bvec_iter iter, sector_t sector,
+				     char *checksums)
+{
+	struct bvec_iter i;
+	struct bio_vec bv;
+
+	__bio_for_each_segment(bv, bio, i, iter) {
+		char *mem = bvec_kmap_local(&bv);
+		unsigned pos;
+
+		for (pos = 0; pos < bv.bv_len; pos += ic->sectors_per_block << SECTOR_SHIFT) {
+			integrity_sector_checksum(ic, sector, mem + pos, checksums);
+			checksums += ic->tag_size;
+			sector += ic->sectors_per_block;
+		}
+		kunmap_local(mem);
+	}
+}
+
+static void integrity_checksum_chunk(struct work_struct *w)
+{
+	struct checksum_chunk *c = container_of(w, struct checksum_chunk, work);
+
+	integrity_checksum_range(c->ic, c->bio, c->iter, c->sector, c->checksums);
+	if (atomic_dec_and_test(c->pending))
+		complete(c->done);
+}
+
+/*
+ * Compute the tags of a large bio in CHECKSUM_CHUNK_BYTES pieces on all
+ * CPUs and then read or write them in one go. Returns -EAGAIN if memory
+ * is short or the tags can't be computed independently (a digest longer
+ * than the tag spills into the next tag), the caller then falls back to
+ * doing it a page at a time.
+ */
+static int integrity_metadata_parallel(struct dm_integrity_io *dio, struct bio *bio)
+{
+	struct dm_integrity_c *ic = dio->ic;
+	unsigned n_bytes = dio->range.n_sectors << SECTOR_SHIFT;
+	unsigned n_chunks = DIV_ROUND_UP(n_bytes, CHECKSUM_CHUNK_BYTES);
+	unsigned tags_size = (dio->range.n_sectors >> ic->sb->log2_sectors_per_block) * ic->tag_size;
+	struct checksum_chunk *chunks;
+	DECLARE_COMPLETION_ONSTACK(done);
+	struct bvec_iter iter;
+	atomic_t pending;
+	char *checksums;
+	unsigned i;
+	int r;
+
+	if (crypto_shash_digestsize(ic->internal_hash) > ic->tag_size)
+		return -EAGAIN;
+
+	checksums = kvmalloc(tags_size, GFP_NOIO | __GFP_NORETRY | __GFP_NOWARN);
+	if (!checksums)
+		return -EAGAIN;
+	chunks = kmalloc_array(n_chunks, sizeof(*chunks), GFP_NOIO | __GFP_NORETRY | __GFP_NOWARN);
+	if (!chunks) {
+		kvfree(checksums);
+		return -EAGAIN;
+	}
+
+	atomic_set(&pending, n_chunks);
+	iter = dio->bio_details.bi_iter;
+	for (i = 0; i < n_chunks; i++) {
+		struct checksum_chunk *c = &chunks[i];
+		unsigned offset = i * CHECKSUM_CHUNK_BYTES;
+
+		c->ic = ic;
+		c->bio = bio;
+		c->iter = iter;
+		c->iter.bi_size = min_t(unsigned, CHECKSUM_CHUNK_BYTES, n_bytes - offset);
+		c->sector = dio->range.logical_sector + (offset >> SECTOR_SHIFT);
+		c->checksums = checksums + (offset >> SECTOR_SHIFT >> ic->sb->log2_sectors_per_block) * ic->tag_size;
+		c->pending = &pending;
+		c->done = &done;
+		bio_advance_iter(bio, &iter, c->iter.bi_size);
+
+		/* the first chunk is ours */
+		if (i) {
+			INIT_WORK(&c->work, integrity_checksum_chunk);
+			queue_work(ic->checksum_wq, &c->work);
+		}
+	}
+	integrity_checksum_chunk(&chunks[0].work);
+	wait_for_completion_io(&done);
+	kfree(chunks);
+
+	this_cpu_inc(ic->stats->parallel_bios);
+
+	r = dm_integrity_rw_tag(ic, checksums, &dio->metadata_block, &dio->metadata_offset,
+				tags_size, dio->op == REQ_OP_READ ? TAG_CMP : TAG_WRITE);
+	if (unlikely(r > 0)) {
+		sector_t s;
+
+		s = dio->range.logical_sector + dio->range.n_sectors -
+		    ((r + ic->tag_size - 1) / ic->tag_size);
+		DMERR_LIMIT("%pg: Checksum failed at sector 0x%llx",
+			    bio->bi_bdev, s);
+		r = -EILSEQ;
+		atomic64_inc(&ic->number_of_mismatches);
+		dm_audit_log_bio(DM_MSG_PREFIX, "integrity-checksum",
+				 bio, s, 0);
+	}
+
+	kvfree(checksums);
+	return r;
+}
+
 static void integrity_metadata(struct work_struct *w)
 {
 	struct dm_integrity_io *dio = container_of(w, struct dm_integrity_io, work);
@@ -1720,6 +1864,16 @@ static void integrity_metadata(struct work_struct *w)
 		if (unlikely(ic->mode == 'R'))
 			goto skip_io;
 
+		if (likely(dio->op != REQ_OP_DISCARD) &&
+		    dio->range.n_sectors << SECTOR_SHIFT >= CHECKSUM_PARALLEL_MIN_BYTES) {
+			r = integrity_metadata_parallel(dio, bio);
+			if (r != -EAGAIN) {
+				if (unlikely(r))
+					goto error;
+				goto skip_io;
+			}
+		}
+
 		if (likely(dio->op != REQ_OP_DISCARD))
 			checksums = kmalloc((PAGE_SIZE >> SECTOR_SHIFT >> ic->sb->log2_sectors_per_block) * ic->tag_size + extra_space,
 					    GFP_NOIO | __GFP_NORETRY | __GFP_NOWARN);
@@ -2357,9 +2511,26 @@ static void integrity_commit(struct work_struct *w)
 	unsigned commit_start, commit_sections;
 	unsigned i, j, n;
 	struct bio *flushes;
+	struct bio *b;
+	unsigned n_flushes = 0;
+	u64 start_ns;
 
 	del_timer(&ic->autocommit_timer);
 
+	/*
+	 * Group commit: if the last commit carried flushes from several
+	 * writers, give the others a moment to queue theirs, so that they
+	 * ride on this commit instead of waiting for the next one. The wait
+	 * is bounded by half the average commit time.
+	 */
+	if (ic->mode == 'J' && ic->last_commit_flushes > 1) {
+		unsigned long delay_us = div_u64(min_t(u64, ic->commit_time_avg_ns >> 1,
+						       COMMIT_BATCH_MAX_NS), NSEC_PER_USEC);
+
+		if (delay_us)
+			usleep_range(delay_us, delay_us + 1);
+	}
+
 	spin_lock_irq(&ic->endio_wait.lock);
 	flushes = bio_list_get(&ic->flush_bio_list);
 	if (unlikely(ic->mode != 'J')) {
@@ -2377,6 +2548,7 @@ static void integrity_commit(struct work_struct *w)
 		goto release_flush_bios;
 
 	ic->wrote_to_journal = true;
+	start_ns = ktime_get_ns();
 
 	i = commit_start;
 	for (n = 0; n < commit_sections; n++) {
@@ -2399,6 +2571,12 @@ static void integrity_commit(struct work_struct *w)
 
 	write_journal(ic, commit_start, commit_sections);
 
+	/* 1/8 weight moving average */
+	ic->commit_time_avg_ns -= ic->commit_time_avg_ns >> 3;
+	ic->commit_time_avg_ns += (ktime_get_ns() - start_ns) >> 3;
+	ic->commits++;
+	ic->commit_sections += commit_sections;
+
 	spin_lock_irq(&ic->endio_wait.lock);
 	ic->uncommitted_section += commit_sections;
 	wraparound_section(ic, &ic->uncommitted_section);
@@ -2410,6 +2588,12 @@ static void integrity_commit(struct work_struct *w)
 		queue_work(ic->writer_wq, &ic->writer_work);
 
 release_flush_bios:
+	for (b = flushes; b; b = b->bi_next)
+		n_flushes++;
+	ic->last_commit_flushes = n_flushes;
+	ic->commit_flushes += n_flushes;
+	ic->commit_batch_max = max(ic->commit_batch_max, n_flushes);
+
 	while (flushes) {
 		struct bio *next = flushes->bi_next;
 		flushes->bi_next = NULL;
@@ -3370,6 +3554,51 @@ static int dm_integrity_iterate_devices(struct dm_target *ti,
 		return fn(ti, ic->dev, 0, ti->len, data);
 }
 
+static void dm_integrity_emit_stats(struct dm_integrity_c *ic, char *result,
+				    unsigned maxlen)
+{
+	u64 checksum_bytes = 0, parallel_bios = 0, elapsed_ms, commits;
+	unsigned sz = 0;
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		struct integrity_stats *stats = per_cpu_ptr(ic->stats, cpu);
+
+		checksum_bytes += READ_ONCE(stats->checksum_bytes);
+		parallel_bios += READ_ONCE(stats->parallel_bios);
+	}
+	elapsed_ms = max_t(s64, ktime_ms_delta(ktime_get(), ic->stats_start), 1);
+	commits = READ_ONCE(ic->commits);
+
+	DMEMIT("checksum_bytes %llu checksum_kib_s %llu parallel_bios %llu",
+	       checksum_bytes, div64_u64((checksum_bytes >> 10) * 1000, elapsed_ms),
+	       parallel_bios);
+	DMEMIT(" commits %llu commit_sections %llu commit_flushes %llu",
+	       commits, READ_ONCE(ic->commit_sections), READ_ONCE(ic->commit_flushes));
+	DMEMIT(" commit_batch_avg %llu commit_batch_max %u commit_time_avg_us %llu elapsed_ms %llu",
+	       div64_u64(READ_ONCE(ic->commit_flushes), max_t(u64, commits, 1)),
+	       READ_ONCE(ic->commit_batch_max),
+	       div_u64(READ_ONCE(ic->commit_time_avg_ns), NSEC_PER_USEC),
+	       elapsed_ms);
+}
+
+/* Message interface
+ *	stats
+ */
+static int dm_integrity_message(struct dm_target *ti, unsigned argc, char **argv,
+				char *result, unsigned maxlen)
+{
+	struct dm_integrity_c *ic = ti->private;
+
+	if (argc == 1 && !strcasecmp(argv[0], "stats")) {
+		dm_integrity_emit_stats(ic, result, maxlen);
+		return 1;
+	}
+
+	DMWARN("unrecognised message received.");
+	return -EINVAL;
+}
+
 static void dm_integrity_io_hints(struct dm_target *ti, struct queue_limits *limits)
 {
 	struct dm_integrity_c *ic = ti->private;
@@ -4004,6 +4233,14 @@ static int dm_integrity_ctr(struct dm_target *ti, unsigned argc, char **argv)
 	ti->per_io_data_size = sizeof(struct dm_integrity_io);
 	ic->ti = ti;
 
+	ic->stats = alloc_percpu(struct integrity_stats);
+	if (!ic->stats) {
+		ti->error = "Cannot allocate statistics";
+		r = -ENOMEM;
+		goto bad;
+	}
+	ic->stats_start = ktime_get();
+
 	ic->in_progress = RB_ROOT;
 	INIT_LIST_HEAD(&ic->wait_list);
 	init_waitqueue_head(&ic->endio_wait);
@@ -4240,6 +4477,16 @@ static int dm_integrity_ctr(struct dm_target *ti, unsigned argc, char **argv)
 		goto bad;
 	}
 
+	if (ic->internal_hash) {
+		ic->checksum_wq = alloc_workqueue("dm-integrity-checksum",
+						  WQ_MEM_RECLAIM | WQ_UNBOUND | WQ_CPU_INTENSIVE, 0);
+		if (!ic->checksum_wq) {
+			ti->error = "Cannot allocate workqueue";
+			r = -ENOMEM;
+			goto bad;
+		}
+	}
+
 	ic->commit_wq = alloc_workqueue("dm-integrity-commit", WQ_MEM_RECLAIM, 1);
 	if (!ic->commit_wq) {
 		ti->error = "Cannot allocate workqueue";
@@ -4568,6 +4815,8 @@ static void dm_integrity_dtr(struct dm_target *ti)
 		destroy_workqueue(ic->offload_wq);
 	if (ic->commit_wq)
 		destroy_workqueue(ic->commit_wq);
+	if (ic->checksum_wq)
+		destroy_workqueue(ic->checksum_wq);
 	if (ic->writer_wq)
 		destroy_workqueue(ic->writer_wq);
 	if (ic->recalc_wq)
@@ -4578,6 +4827,7 @@ static void dm_integrity_dtr(struct dm_target *ti)
 	if (ic->bufio)
 		dm_bufio_client_destroy(ic->bufio);
 	mempool_exit(&ic->journal_io_mempool);
+	free_percpu(ic->stats);
 	if (ic->io)
 		dm_io_client_destroy(ic->io);
 	if (ic->dev)
@@ -4627,7 +4877,7 @@ static void dm_integrity_dtr(struct dm_target *ti)
 
 static struct target_type integrity_target = {
 	.name			= "integrity",
-	.version		= {1, 10, 0},
+	.version		= {1, 11, 0},
 	.module			= THIS_MODULE,
 	.features		= DM_TARGET_SINGLETON | DM_TARGET_INTEGRITY,
 	.ctr			= dm_integrity_ctr,
@@ -4636,6 +4886,7 @@ static struct target_type integrity_target = {
 	.postsuspend		= dm_integrity_postsuspend,
 	.resume			= dm_integrity_resume,
 	.status			= dm_integrity_status,
+	.message		= dm_integrity_message,
 	.iterate_devices	= dm_integrity_iterate_devices,
 	.io_hints		= dm_integrity_io_hints,
 };
@@ -175,11 +175,37 @@ static int verity_hash_final(struct dm_verity *v, struct ahash_request *req,
 	return r;
 }
 
-int verity_hash(struct dm_verity *v, struct ahash_request *req,
+/*
+ * Start a shash from the state precomputed in verity_setup_shash(), so the
+ * salt isn't hashed again for every block.
+ */
+static int verity_shash_init(struct dm_verity *v, struct shash_desc *desc)
+{
+	desc->tfm = v->shash_tfm;
+	return crypto_shash_import(desc, v->initial_hashstate);
+}
+
+static int verity_shash(struct dm_verity *v, struct shash_desc *desc,
+			const u8 *data, size_t len, u8 *digest)
+{
+	int r;
+
+	r = verity_shash_init(v, desc);
+	if (unlikely(r < 0))
+		return r;
+
+	return crypto_shash_finup(desc, data, len, digest);
+}
+
+int verity_hash(struct dm_verity *v, struct dm_verity_io *io,
 		const u8 *data, size_t len, u8 *digest)
 {
 	int r;
 	struct crypto_wait wait;
+	struct ahash_request *req = verity_io_hash_req(v, io);
+
+	if (v->shash_tfm)
+		return verity_shash(v, verity_io_hash_desc(v, io), data, len, digest);
 
 	r = verity_hash_init(v, req, &wait);
 	if (unlikely(r < 0))
@@ -315,7 +341,7 @@ static int verity_verify_level(struct dm_verity *v, struct dm_verity_io *io,
 			goto release_ret_r;
 		}
 
-		r = verity_hash(v, verity_io_hash_req(v, io),
+		r = verity_hash(v, io,
 				data, 1 << v->hash_dev_block_bits,
 				verity_io_real_digest(v, io));
 		if (unlikely(r < 0))
@@ -435,6 +461,50 @@ static int verity_for_io_block(struct dm_verity *v, struct dm_verity_io *io,
 	return 0;
 }
 
+/*
+ * Calculates the digest for the given bio with the shash API. A block that
+ * lies within one page, which is nearly always the case, takes a single
+ * finup call.
+ */
+static int verity_shash_io_block(struct dm_verity *v, struct dm_verity_io *io,
+				 struct bvec_iter *iter, u8 *digest)
+{
+	unsigned int todo = 1 << v->data_dev_block_bits;
+	struct bio *bio = dm_bio_from_per_bio_data(io, v->ti->per_io_data_size);
+	struct shash_desc *desc = verity_io_hash_desc(v, io);
+	int r;
+
+	r = verity_shash_init(v, desc);
+	if (unlikely(r < 0))
+		return r;
+
+	do {
+		u8 *page;
+		unsigned int len;
+		struct bio_vec bv = bio_iter_iovec(bio, *iter);
+
+		page = bvec_kmap_local(&bv);
+		len = bv.bv_len;
+
+		if (likely(len >= todo)) {
+			len = todo;
+			r = crypto_shash_finup(desc, page, len, digest);
+		} else
+			r = crypto_shash_update(desc, page, len);
+		kunmap_local(page);
+
+		if (unlikely(r < 0)) {
+			DMERR("verity_shash_io_block crypto op failed: %d", r);
+			return r;
+		}
+
+		bio_advance_iter(bio, iter, len);
+		todo -= len;
+	} while (todo);
+
+	return 0;
+}
+
 /*
  * Calls function process for 1 << v->data_dev_block_bits bytes in the bio_vec
  * starting from iter.
@@ -492,6 +562,97 @@ static inline void verity_bv_skip_block(struct dm_verity *v,
 	bio_advance_iter(bio, iter, 1 << v->data_dev_block_bits);
 }
 
+/*
+ * Handle a data block whose digest didn't match, with the expected digest in
+ * verity_io_want_digest(): try FEC, then apply the configured error mode.
+ */
+static int verity_handle_data_hash_mismatch(struct dm_verity *v,
+					    struct dm_verity_io *io,
+					    struct bio *bio, sector_t blkno,
+					    struct bvec_iter *start)
+{
+	if (static_branch_unlikely(&use_tasklet_enabled) && io->in_tasklet) {
+		/*
+		 * Error handling code (FEC included) cannot be run in a
+		 * tasklet since it may sleep, so fallback to work-queue.
+		 */
+		return -EAGAIN;
+	}
+	if (verity_fec_decode(v, io, DM_VERITY_BLOCK_TYPE_DATA, blkno, NULL,
+			      start) == 0)
+		return 0;
+	if (bio->bi_status) {
+		/*
+		 * Error correction failed; Just return error
+		 */
+		return -EIO;
+	}
+	if (verity_handle_err(v, DM_VERITY_BLOCK_TYPE_DATA, blkno))
+		return -EIO;
+	return 0;
+}
+
+static void verity_clear_pending_blocks(struct dm_verity_io *io)
+{
+	int i;
+
+	for (i = io->num_pending - 1; i >= 0; i--)
+		kunmap_local(io->pending_blocks[i].data);
+	io->num_pending = 0;
+}
+
+/*
+ * Hash the pending data blocks with a single crypto_shash_finup_mb() call,
+ * which lets multi-buffer capable drivers interleave them, and check each
+ * digest.
+ */
+static int verity_verify_pending_blocks(struct dm_verity *v,
+					struct dm_verity_io *io,
+					struct bio *bio)
+{
+	struct shash_desc *desc = verity_io_hash_desc(v, io);
+	const u8 *data[HASH_MAX_MB_MSGS];
+	u8 *real_digests[HASH_MAX_MB_MSGS];
+	unsigned int num_pending = io->num_pending;
+	unsigned int i;
+	int r;
+
+	for (i = 0; i < num_pending; i++) {
+		data[i] = io->pending_blocks[i].data;
+		real_digests[i] = io->pending_blocks[i].real_digest;
+	}
+
+	r = verity_shash_init(v, desc);
+	if (likely(r == 0))
+		r = crypto_shash_finup_mb(desc, data,
+					  1 << v->data_dev_block_bits,
+					  real_digests, num_pending);
+	verity_clear_pending_blocks(io);
+	if (unlikely(r < 0)) {
+		DMERR("verity_verify_pending_blocks crypto op failed: %d", r);
+		return r;
+	}
+
+	for (i = 0; i < num_pending; i++) {
+		struct verity_pending_block *block = &io->pending_blocks[i];
+
+		if (likely(memcmp(block->real_digest, block->want_digest,
+				  v->digest_size) == 0)) {
+			if (v->validated_blocks)
+				set_bit(block->blkno, v->validated_blocks);
+			continue;
+		}
+		memcpy(verity_io_want_digest(v, io), block->want_digest,
+		       v->digest_size);
+		r = verity_handle_data_hash_mismatch(v, io, bio, block->blkno,
+						     &block->fec_start);
+		if (unlikely(r < 0))
+			return r;
+	}
+
+	return 0;
+}
+
 /*
  * Verify one "dm_verity_io" structure.
  */
@@ -499,14 +660,14 @@ static int verity_verify_io(struct dm_verity_io *io)
 {
 	bool is_zero;
 	struct dm_verity *v = io->v;
-#if defined(CONFIG_DM_VERITY_FEC)
 	struct bvec_iter start;
-#endif
 	struct bvec_iter iter_copy;
 	struct bvec_iter *iter;
 	struct crypto_wait wait;
 	struct bio *bio = dm_bio_from_per_bio_data(io, v->ti->per_io_data_size);
+	unsigned int block_size = 1 << v->data_dev_block_bits;
 	unsigned int b;
+	int r;
 
 	if (static_branch_unlikely(&use_tasklet_enabled) && io->in_tasklet) {
 		/*
@@ -518,8 +679,9 @@ static int verity_verify_io(struct dm_verity_io *io)
 	} else
 		iter = &io->iter;
 
+	io->num_pending = 0;
+
 	for (b = 0; b < io->n_blocks; b++) {
-		int r;
 		sector_t cur_block = io->block + b;
 		struct ahash_request *req = verity_io_hash_req(v, io);
 
@@ -533,7 +695,7 @@ static int verity_verify_io(struct dm_verity_io *io)
 					  verity_io_want_digest(v, io),
 					  &is_zero);
 		if (unlikely(r < 0))
-			return r;
+			goto error;
 
 		if (is_zero) {
 			/*
@@ -543,59 +705,85 @@ static int verity_verify_io(struct dm_verity_io *io)
 			r = verity_for_bv_block(v, io, iter,
 						verity_bv_zero);
 			if (unlikely(r < 0))
-				return r;
+				goto error;
 
 			continue;
 		}
 
-		r = verity_hash_init(v, req, &wait);
-		if (unlikely(r < 0))
-			return r;
+		if (v->mb_max_msgs > 1) {
+			struct bio_vec bv = bio_iter_iovec(bio, *iter);
+
+			/*
+			 * Queue blocks that lie within one page, which is
+			 * nearly always the case, and hash them together once
+			 * there are as many as the driver can interleave.
+			 */
+			if (likely(bv.bv_len >= block_size)) {
+				struct verity_pending_block *block =
+					&io->pending_blocks[io->num_pending];
+
+				memcpy(block->want_digest,
+				       verity_io_want_digest(v, io),
+				       v->digest_size);
+				block->blkno = cur_block;
+				block->fec_start = *iter;
+				block->data = bvec_kmap_local(&bv);
+				verity_bv_skip_block(v, io, iter);
+				if (++io->num_pending == v->mb_max_msgs) {
+					r = verity_verify_pending_blocks(v, io,
+									 bio);
+					if (unlikely(r < 0))
+						goto error;
+				}
+				continue;
+			}
+		}
 
-#if defined(CONFIG_DM_VERITY_FEC)
 		if (verity_fec_is_enabled(v))
 			start = *iter;
-#endif
-		r = verity_for_io_block(v, io, iter, &wait);
-		if (unlikely(r < 0))
-			return r;
+		if (v->shash_tfm) {
+			r = verity_shash_io_block(v, io, iter,
+						  verity_io_real_digest(v, io));
+			if (unlikely(r < 0))
+				goto error;
+		} else {
+			r = verity_hash_init(v, req, &wait);
+			if (unlikely(r < 0))
+				goto error;
 
-		r = verity_hash_final(v, req, verity_io_real_digest(v, io),
-					&wait);
-		if (unlikely(r < 0))
-			return r;
+			r = verity_for_io_block(v, io, iter, &wait);
+			if (unlikely(r < 0))
+				goto error;
+
+			r = verity_hash_final(v, req, verity_io_real_digest(v, io),
+					      &wait);
+			if (unlikely(r < 0))
+				goto error;
+		}
 
 		if (likely(memcmp(verity_io_real_digest(v, io),
 				  verity_io_want_digest(v, io), v->digest_size) == 0)) {
 			if (v->validated_blocks)
 				set_bit(cur_block, v->validated_blocks);
 			continue;
-		} else if (static_branch_unlikely(&use_tasklet_enabled) &&
-			   io->in_tasklet) {
-			/*
-			 * Error handling code (FEC included) cannot be run in a
-			 * tasklet since it may sleep, so fallback to work-queue.
-			 */
-			return -EAGAIN;
-#if defined(CONFIG_DM_VERITY_FEC)
-		} else if (verity_fec_decode(v, io, DM_VERITY_BLOCK_TYPE_DATA,
-					     cur_block, NULL, &start) == 0) {
-			continue;
-#endif
-		} else {
-			if (bio->bi_status) {
-				/*
-				 * Error correction failed; Just return error
-				 */
-				return -EIO;
-			}
-			if (verity_handle_err(v, DM_VERITY_BLOCK_TYPE_DATA,
-					      cur_block))
-				return -EIO;
 		}
+		r = verity_handle_data_hash_mismatch(v, io, bio, cur_block,
+						     &start);
+		if (unlikely(r < 0))
+			goto error;
+	}
+
+	if (io->num_pending) {
+		r = verity_verify_pending_blocks(v, io, bio);
+		if (unlikely(r < 0))
+			goto error;
 	}
 
 	return 0;
+
+error:
+	verity_clear_pending_blocks(io);
+	return r;
 }
 
 /*
@@ -954,6 +1142,9 @@ static void verity_dtr(struct dm_target *ti)
 	kfree(v->root_digest);
 	kfree(v->zero_digest);
 
+	kfree(v->initial_hashstate);
+	if (v->shash_tfm)
+		crypto_free_shash(v->shash_tfm);
 	if (v->tfm)
 		crypto_free_ahash(v->tfm);
 
@@ -999,7 +1190,7 @@ static int verity_alloc_most_once(struct dm_verity *v)
 static int verity_alloc_zero_digest(struct dm_verity *v)
 {
 	int r = -ENOMEM;
-	struct ahash_request *req;
+	struct dm_verity_io *io;
 	u8 *zero_data;
 
 	v->zero_digest = kmalloc(v->digest_size, GFP_KERNEL);
@@ -1007,9 +1198,9 @@ static int verity_alloc_zero_digest(struct dm_verity *v)
 	if (!v->zero_digest)
 		return r;
 
-	req = kmalloc(v->ahash_reqsize, GFP_KERNEL);
+	io = kmalloc(sizeof(*io) + v->ahash_reqsize, GFP_KERNEL);
 
-	if (!req)
+	if (!io)
 		return r; /* verity_dtr will free zero_digest */
 
 	zero_data = kzalloc(1 << v->data_dev_block_bits, GFP_KERNEL);
@@ -1017,16 +1208,71 @@ static int verity_alloc_zero_digest(struct dm_verity *v)
 	if (!zero_data)
 		goto out;
 
-	r = verity_hash(v, req, zero_data, 1 << v->data_dev_block_bits,
+	r = verity_hash(v, io, zero_data, 1 << v->data_dev_block_bits,
 			v->zero_digest);
 
 out:
-	kfree(req);
+	kfree(io);
 	kfree(zero_data);
 
 	return r;
 }
 
+/*
+ * Most dm-verity users hash on the CPU. If the ahash API resolved to a
+ * synchronous CPU driver, use the shash API for it instead: it avoids the
+ * request, scatterlist and completion setup that otherwise costs more than
+ * hashing a 4k block. The salted initial state is computed here once.
+ *
+ * The obsolete version 0 format, which appends the salt, stays on ahash.
+ */
+static int verity_setup_shash(struct dm_verity *v)
+{
+	struct crypto_shash *shash;
+	struct shash_desc *desc;
+	int r;
+
+	if (!v->version)
+		return 0;
+
+	shash = crypto_alloc_shash(v->alg_name, 0, 0);
+	if (IS_ERR(shash))
+		return 0;
+
+	if (strcmp(crypto_shash_driver_name(shash),
+		   crypto_ahash_driver_name(v->tfm))) {
+		crypto_free_shash(shash);
+		return 0;
+	}
+
+	v->initial_hashstate = kmalloc(crypto_shash_alg(shash)->statesize, GFP_KERNEL);
+	desc = kmalloc(sizeof(*desc) + crypto_shash_descsize(shash), GFP_KERNEL);
+	if (!v->initial_hashstate || !desc) {
+		r = -ENOMEM;
+		goto out;
+	}
+
+	desc->tfm = shash;
+	r = crypto_shash_init(desc);
+	if (!r && v->salt_size)
+		r = crypto_shash_update(desc, v->salt, v->salt_size);
+	if (!r)
+		r = crypto_shash_export(desc, v->initial_hashstate);
+	if (r)
+		goto out;
+
+	v->shash_tfm = shash;
+	v->mb_max_msgs = crypto_shash_mb_max_msgs(shash);
+	v->ahash_reqsize = max_t(unsigned int, v->ahash_reqsize,
+				 sizeof(*desc) + crypto_shash_descsize(shash));
+	shash = NULL;
+out:
+	kfree_sensitive(desc);
+	if (shash)
+		crypto_free_shash(shash);
+	return r;
+}
+
 static inline bool verity_is_verity_mode(const char *arg_name)
 {
 	return (!strcasecmp(arg_name, DM_VERITY_OPT_LOGGING) ||
@@ -1330,6 +1576,12 @@ static int verity_ctr(struct dm_target *ti, unsigned argc, char **argv)
 		}
 	}
 
+	r = verity_setup_shash(v);
+	if (r) {
+		ti->error = "Cannot initialize hash function";
+		goto bad;
+	}
+
 	argv += 10;
 	argc -= 10;
 
@@ -1489,7 +1741,7 @@ int dm_verity_get_root_digest(struct dm_target *ti, u8 **root_digest, unsigned i
 static struct target_type verity_target = {
 	.name		= "verity",
 	.features	= DM_TARGET_IMMUTABLE,
-	.version	= {1, 9, 0},
+	.version	= {1, 10, 0},
 	.module		= THIS_MODULE,
 	.ctr		= verity_ctr,
 	.dtr		= verity_dtr,
@@ -39,6 +39,8 @@ struct dm_verity {
 	struct dm_bufio_client *bufio;
 	char *alg_name;
 	struct crypto_ahash *tfm;
+	struct crypto_shash *shash_tfm;	/* set if tfm is a synchronous driver */
+	u8 *initial_hashstate;	/* shash state after hashing the salt */
 	u8 *root_digest;	/* digest of the root block */
 	u8 *salt;		/* salt: its size is salt_size */
 	u8 *zero_digest;	/* digest for a zero block */
@@ -55,7 +57,9 @@ struct dm_verity {
 	bool hash_failed:1;	/* set if hash of any block failed */
 	bool use_tasklet:1;	/* try to verify in tasklet before work-queue */
 	unsigned digest_size;	/* digest size for the current hash algorithm */
-	unsigned int ahash_reqsize;/* the size of temporary space for crypto */
+	unsigned int ahash_reqsize;/* the size of temporary space for crypto,
+				    * also big enough for the shash descriptor */
+	unsigned int mb_max_msgs; /* max data blocks to hash at once */
 	enum verity_mode mode;	/* mode for handling verification errors */
 	unsigned corrupted_errs;/* Number of errors for corrupted blocks */
 
@@ -70,6 +74,18 @@ struct dm_verity {
 	char *signature_key_desc; /* signature keyring reference */
 };
 
+/*
+ * A data block whose hash is deferred so that it can be computed together with
+ * the next ones by crypto_shash_finup_mb().
+ */
+struct verity_pending_block {
+	void *data;		/* kmap_local()ed data of the block */
+	sector_t blkno;
+	struct bvec_iter fec_start;	/* iter to the block, for FEC */
+	u8 want_digest[HASH_MAX_DIGESTSIZE];
+	u8 real_digest[HASH_MAX_DIGESTSIZE];
+};
+
 struct dm_verity_io {
 	struct dm_verity *v;
 
@@ -85,15 +101,18 @@ struct dm_verity_io {
 	struct work_struct work;
 	struct tasklet_struct tasklet;
 
+	unsigned int num_pending;
+	struct verity_pending_block pending_blocks[HASH_MAX_MB_MSGS];
+
 	/*
 	 * Three variably-size fields follow this struct:
 	 *
-	 * u8 hash_req[v->ahash_reqsize];
+	 * u8 hash_req[v->ahash_reqsize];	(or the shash descriptor)
 	 * u8 real_digest[v->digest_size];
 	 * u8 want_digest[v->digest_size];
 	 *
-	 * To access them use: verity_io_hash_req(), verity_io_real_digest()
-	 * and verity_io_want_digest().
+	 * To access them use: verity_io_hash_req() or verity_io_hash_desc(),
+	 * verity_io_real_digest() and verity_io_want_digest().
 	 */
 };
 
@@ -103,6 +122,12 @@ static inline struct ahash_request *verity_io_hash_req(struct dm_verity *v,
 	return (struct ahash_request *)(io + 1);
 }
 
+static inline struct shash_desc *verity_io_hash_desc(struct dm_verity *v,
+						    struct dm_verity_io *io)
+{
+	return (struct shash_desc *)(io + 1);
+}
+
 static inline u8 *verity_io_real_digest(struct dm_verity *v,
 					struct dm_verity_io *io)
 {
@@ -127,7 +152,7 @@ extern int verity_for_bv_block(struct dm_verity *v, struct dm_verity_io *io,
 					      struct dm_verity_io *io,
 					      u8 *data, size_t len));
 
-extern int verity_hash(struct dm_verity *v, struct ahash_request *req,
+extern int verity_hash(struct dm_verity *v, struct dm_verity_io *io,
 		       const u8 *data, size_t len, u8 *digest);
 
 extern int verity_hash_for_block(struct dm_verity *v, struct dm_verity_io *io,
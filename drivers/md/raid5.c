@@ -303,6 +303,46 @@ static void do_release_stripe(struct r5conf *conf, struct stripe_head *sh,
 	}
 }
 
+/*
+ * Each hash lock has one inactive list per node, holding the free stripes of
+ * that hash whose pages are on that node, so that get_free_stripe() can hand
+ * out a local stripe without searching.  All of them are protected by the
+ * hash lock.  Stripes allocated without a node go on node 0's list.
+ */
+static inline struct list_head *stripe_inactive_list(struct r5conf *conf,
+						     int hash, int node)
+{
+	if (node == NUMA_NO_NODE)
+		node = 0;
+	return conf->inactive_list + hash * nr_node_ids + node;
+}
+
+static bool inactive_list_empty(struct r5conf *conf, int hash)
+{
+	int node;
+
+	for (node = 0; node < nr_node_ids; node++)
+		if (!list_empty(stripe_inactive_list(conf, hash, node)))
+			return false;
+	return true;
+}
+
+/* Move the stripes on @list to the inactive lists of their nodes */
+static void splice_inactive_stripes(struct r5conf *conf,
+				    struct list_head *list, int hash)
+{
+	struct stripe_head *sh, *t;
+
+	if (nr_node_ids == 1) {
+		list_splice_tail_init(list, stripe_inactive_list(conf, hash, 0));
+		return;
+	}
+
+	list_for_each_entry_safe(sh, t, list, lru)
+		list_move_tail(&sh->lru,
+			       stripe_inactive_list(conf, hash, sh->numa_node));
+}
+
 static void __release_stripe(struct r5conf *conf, struct stripe_head *sh,
 			     struct list_head *temp_inactive_list)
 	__must_hold(&conf->device_lock)
@@ -340,10 +380,10 @@ static void release_inactive_stripe_list(struct r5conf *conf,
 		 */
 		if (!list_empty_careful(list)) {
 			spin_lock_irqsave(conf->hash_locks + hash, flags);
-			if (list_empty(conf->inactive_list + hash) &&
+			if (inactive_list_empty(conf, hash) &&
 			    !list_empty(list))
 				atomic_dec(&conf->empty_inactive_list_nr);
-			list_splice_tail_init(list, conf->inactive_list + hash);
+			splice_inactive_stripes(conf, list, hash);
 			do_wakeup = true;
 			spin_unlock_irqrestore(conf->hash_locks + hash, flags);
 		}
@@ -360,15 +400,16 @@ static void release_inactive_stripe_list(struct r5conf *conf,
 	}
 }
 
-static int release_stripe_list(struct r5conf *conf,
-			       struct list_head *temp_inactive_list)
+static int __release_stripe_list(struct r5conf *conf,
+				 struct llist_head *released,
+				 struct list_head *temp_inactive_list)
 	__must_hold(&conf->device_lock)
 {
 	struct stripe_head *sh, *t;
 	int count = 0;
 	struct llist_node *head;
 
-	head = llist_del_all(&conf->released_stripes);
+	head = llist_del_all(released);
 	head = llist_reverse_order(head);
 	llist_for_each_entry_safe(sh, t, head, release_list) {
 		int hash;
@@ -389,13 +430,56 @@ static int release_stripe_list(struct r5conf *conf,
 	return count;
 }
 
+/*
+ * Drain the stripes released without device_lock: the array wide list and
+ * @group's list, or every group's list if @group is ANY_GROUP.
+ */
+static int release_stripe_list(struct r5conf *conf, int group,
+			       struct list_head *temp_inactive_list)
+	__must_hold(&conf->device_lock)
+{
+	int i, count;
+
+	count = __release_stripe_list(conf, &conf->released_stripes,
+				      temp_inactive_list);
+	if (!conf->worker_cnt_per_group)
+		return count;
+
+	for (i = 0; i < conf->group_cnt; i++)
+		if (group == ANY_GROUP || group == i)
+			count += __release_stripe_list(conf,
+					&conf->worker_groups[i].released_stripes,
+					temp_inactive_list);
+	return count;
+}
+
+/*
+ * With worker threads, stripes go onto a list local to the releasing CPU's
+ * node and are drained by that node's workers. Otherwise every completion
+ * on every CPU would hit the same list head and raid5d.
+ */
+static void release_stripe_deferred(struct r5conf *conf,
+				    struct stripe_head *sh)
+{
+	struct r5worker_group *group;
+
+	if (!conf->worker_cnt_per_group) {
+		if (llist_add(&sh->release_list, &conf->released_stripes))
+			md_wakeup_thread(conf->mddev->thread);
+		return;
+	}
+
+	group = conf->worker_groups + cpu_to_group(raw_smp_processor_id());
+	if (llist_add(&sh->release_list, &group->released_stripes))
+		queue_work(raid5_wq, &group->workers[0].work);
+}
+
 void raid5_release_stripe(struct stripe_head *sh)
 {
 	struct r5conf *conf = sh->raid_conf;
 	unsigned long flags;
 	struct list_head list;
 	int hash;
-	bool wakeup;
 
 	/* Avoid release_list until the last reference.
 	 */
@@ -405,9 +489,7 @@ void raid5_release_stripe(struct stripe_head *sh)
 	if (unlikely(!conf->mddev->thread) ||
 		test_and_set_bit(STRIPE_ON_RELEASE_LIST, &sh->state))
 		goto slow_path;
-	wakeup = llist_add(&sh->release_list, &conf->released_stripes);
-	if (wakeup)
-		md_wakeup_thread(conf->mddev->thread);
+	release_stripe_deferred(conf, sh);
 	return;
 slow_path:
 	/* we are ok here if STRIPE_ON_RELEASE_LIST is set or not */
@@ -438,21 +520,42 @@ static inline void insert_hash(struct r5conf *conf, struct stripe_head *sh)
 	hlist_add_head(&sh->hash, hp);
 }
 
+/*
+ * Prefer a stripe whose pages are on this CPU's node, so the data copies and
+ * parity computation touch local memory, and fall back to any other node.
+ */
+static struct list_head *first_free_stripe(struct r5conf *conf, int hash)
+{
+	struct list_head *head;
+	int node;
+
+	head = stripe_inactive_list(conf, hash, numa_mem_id());
+	if (!list_empty(head))
+		return head->next;
+
+	for (node = 0; node < nr_node_ids; node++) {
+		head = stripe_inactive_list(conf, hash, node);
+		if (!list_empty(head))
+			return head->next;
+	}
+	return NULL;
+}
+
 /* find an idle stripe, make sure it is unhashed, and return it. */
 static struct stripe_head *get_free_stripe(struct r5conf *conf, int hash)
 {
 	struct stripe_head *sh = NULL;
 	struct list_head *first;
 
-	if (list_empty(conf->inactive_list + hash))
+	first = first_free_stripe(conf, hash);
+	if (!first)
 		goto out;
-	first = (conf->inactive_list + hash)->next;
 	sh = list_entry(first, struct stripe_head, lru);
 	list_del_init(first);
 	remove_hash(sh);
 	atomic_inc(&conf->active_stripes);
 	BUG_ON(hash != sh->hash_lock_index);
-	if (list_empty(conf->inactive_list + hash))
+	if (inactive_list_empty(conf, hash))
 		atomic_inc(&conf->empty_inactive_list_nr);
 out:
 	return sh;
@@ -486,7 +589,7 @@ static int alloc_stripe_pages(struct stripe_head *sh, gfp_t gfp)
 		if (sh->pages[i])
 			continue;
 
-		p = alloc_page(gfp);
+		p = alloc_pages_node(sh->numa_node, gfp, 0);
 		if (!p) {
 			free_stripe_pages(sh);
 			return -ENOMEM;
@@ -508,7 +611,8 @@ init_stripe_shared_pages(struct stripe_head *sh, struct r5conf *conf, int disks)
 	cnt = PAGE_SIZE / conf->stripe_size;
 	nr_pages = (disks + cnt - 1) / cnt;
 
-	sh->pages = kcalloc(nr_pages, sizeof(struct page *), GFP_KERNEL);
+	sh->pages = kcalloc_node(nr_pages, sizeof(struct page *), GFP_KERNEL,
+				 sh->numa_node);
 	if (!sh->pages)
 		return -ENOMEM;
 	sh->nr_pages = nr_pages;
@@ -549,7 +653,7 @@ static int grow_buffers(struct stripe_head *sh, gfp_t gfp)
 	for (i = 0; i < num; i++) {
 		struct page *page;
 
-		if (!(page = alloc_page(gfp))) {
+		if (!(page = alloc_pages_node(sh->numa_node, gfp, 0))) {
 			return 1;
 		}
 		sh->dev[i].page = page;
@@ -653,10 +757,10 @@ static struct stripe_head *find_get_stripe(struct r5conf *conf,
 		BUG_ON(list_empty(&sh->lru) &&
 		       !test_bit(STRIPE_EXPANDING, &sh->state));
 		inc_empty_inactive_list_flag = 0;
-		if (!list_empty(conf->inactive_list + hash))
+		if (!inactive_list_empty(conf, hash))
 			inc_empty_inactive_list_flag = 1;
 		list_del_init(&sh->lru);
-		if (list_empty(conf->inactive_list + hash) &&
+		if (inactive_list_empty(conf, hash) &&
 		    inc_empty_inactive_list_flag)
 			atomic_inc(&conf->empty_inactive_list_nr);
 		if (sh->group) {
@@ -790,7 +894,7 @@ struct stripe_request_ctx {
  */
 static bool is_inactive_blocked(struct r5conf *conf, int hash)
 {
-	if (list_empty(conf->inactive_list + hash))
+	if (inactive_list_empty(conf, hash))
 		return false;
 
 	if (!test_bit(R5_INACTIVE_BLOCKED, &conf->cache_state))
@@ -2362,11 +2466,11 @@ static void free_stripe(struct kmem_cache *sc, struct stripe_head *sh)
 }
 
 static struct stripe_head *alloc_stripe(struct kmem_cache *sc, gfp_t gfp,
-	int disks, struct r5conf *conf)
+	int disks, struct r5conf *conf, int node)
 {
 	struct stripe_head *sh;
 
-	sh = kmem_cache_zalloc(sc, gfp);
+	sh = kmem_cache_alloc_node(sc, gfp | __GFP_ZERO, node);
 	if (sh) {
 		spin_lock_init(&sh->stripe_lock);
 		spin_lock_init(&sh->batch_lock);
@@ -2377,9 +2481,10 @@ static struct stripe_head *alloc_stripe(struct kmem_cache *sc, gfp_t gfp,
 		atomic_set(&sh->count, 1);
 		sh->raid_conf = conf;
 		sh->log_start = MaxSector;
+		sh->numa_node = node;
 
 		if (raid5_has_ppl(conf)) {
-			sh->ppl_page = alloc_page(gfp);
+			sh->ppl_page = alloc_pages_node(node, gfp, 0);
 			if (!sh->ppl_page) {
 				free_stripe(sc, sh);
 				return NULL;
@@ -2394,11 +2499,33 @@ static struct stripe_head *alloc_stripe(struct kmem_cache *sc, gfp_t gfp,
 	}
 	return sh;
 }
+
+/*
+ * New stripes go round robin over the nodes with memory, one round per pass
+ * over the hash locks, so that every hash lock gets stripes on every node.
+ */
+static int stripe_alloc_node(struct r5conf *conf)
+{
+	int nr, node;
+
+	if (num_node_state(N_MEMORY) == 1)
+		return NUMA_NO_NODE;
+
+	nr = conf->max_nr_stripes / NR_STRIPE_HASH_LOCKS %
+		num_node_state(N_MEMORY);
+	for_each_node_state(node, N_MEMORY)
+		if (!nr--)
+			return node;
+
+	return NUMA_NO_NODE;
+}
+
 static int grow_one_stripe(struct r5conf *conf, gfp_t gfp)
 {
 	struct stripe_head *sh;
 
-	sh = alloc_stripe(conf->slab_cache, gfp, conf->pool_size, conf);
+	sh = alloc_stripe(conf->slab_cache, gfp, conf->pool_size, conf,
+			  stripe_alloc_node(conf));
 	if (!sh)
 		return 0;
 
@@ -2568,7 +2695,8 @@ static int resize_stripes(struct r5conf *conf, int newsize)
 	mutex_lock(&conf->cache_size_mutex);
 
 	for (i = conf->max_nr_stripes; i; i--) {
-		nsh = alloc_stripe(sc, GFP_KERNEL, newsize, conf);
+		nsh = alloc_stripe(sc, GFP_KERNEL, newsize, conf,
+				   NUMA_NO_NODE);
 		if (!nsh)
 			break;
 
@@ -2594,7 +2722,7 @@ static int resize_stripes(struct r5conf *conf, int newsize)
 	list_for_each_entry(nsh, &newstripes, lru) {
 		lock_device_hash_lock(conf, hash);
 		wait_event_cmd(conf->wait_for_stripe,
-				    !list_empty(conf->inactive_list + hash),
+				    !inactive_list_empty(conf, hash),
 				    unlock_device_hash_lock(conf, hash),
 				    lock_device_hash_lock(conf, hash));
 		osh = get_free_stripe(conf, hash);
@@ -2612,6 +2740,8 @@ static int resize_stripes(struct r5conf *conf, int newsize)
 			nsh->dev[i].offset = osh->dev[i].offset;
 		}
 		nsh->hash_lock_index = hash;
+		/* New pages go with the ones taken over */
+		nsh->numa_node = osh->numa_node;
 		free_stripe(conf->slab_cache, osh);
 		cnt++;
 		if (cnt >= conf->max_nr_stripes / NR_STRIPE_HASH_LOCKS +
@@ -2662,7 +2792,8 @@ static int resize_stripes(struct r5conf *conf, int newsize)
 		for (i = 0; i < nsh->nr_pages; i++) {
 			if (nsh->pages[i])
 				continue;
-			nsh->pages[i] = alloc_page(GFP_NOIO);
+			nsh->pages[i] = alloc_pages_node(nsh->numa_node,
+							 GFP_NOIO, 0);
 			if (!nsh->pages[i])
 				err = -ENOMEM;
 		}
@@ -2677,7 +2808,8 @@ static int resize_stripes(struct r5conf *conf, int newsize)
 #else
 		for (i=conf->raid_disks; i < newsize; i++)
 			if (nsh->dev[i].page == NULL) {
-				struct page *p = alloc_page(GFP_NOIO);
+				struct page *p = alloc_pages_node(nsh->numa_node,
+								  GFP_NOIO, 0);
 				nsh->dev[i].page = p;
 				nsh->dev[i].orig_page = p;
 				nsh->dev[i].offset = 0;
@@ -6695,7 +6827,8 @@ static void raid5_do_work(struct work_struct *work)
 	while (1) {
 		int batch_size, released;
 
-		released = release_stripe_list(conf, worker->temp_inactive_list);
+		released = release_stripe_list(conf, group_id,
+					       worker->temp_inactive_list);
 
 		batch_size = handle_active_stripes(conf, group_id, worker,
 						   worker->temp_inactive_list);
@@ -6747,7 +6880,8 @@ static void raid5d(struct md_thread *thread)
 		int batch_size, released;
 		unsigned int offset;
 
-		released = release_stripe_list(conf, conf->temp_inactive_list);
+		released = release_stripe_list(conf, ANY_GROUP,
+					       conf->temp_inactive_list);
 		if (released)
 			clear_bit(R5_DID_ALLOC, &conf->cache_state);
 
@@ -7255,6 +7389,7 @@ static int alloc_thread_groups(struct r5conf *conf, int cnt, int *group_cnt,
 		group = &(*worker_groups)[i];
 		INIT_LIST_HEAD(&group->handle_list);
 		INIT_LIST_HEAD(&group->loprio_list);
+		init_llist_head(&group->released_stripes);
 		group->conf = conf;
 		group->workers = workers + i * cnt;
 
@@ -7358,6 +7493,7 @@ static void free_conf(struct r5conf *conf)
 	kfree(conf->disks);
 	bioset_exit(&conf->bio_split);
 	kfree(conf->stripe_hashtbl);
+	kfree(conf->inactive_list);
 	kfree(conf->pending_data);
 	kfree(conf);
 }
@@ -7550,6 +7686,11 @@ static struct r5conf *setup_conf(struct mddev *mddev)
 	if (!conf->stripe_hashtbl)
 		goto abort;
 
+	conf->inactive_list = kcalloc(NR_STRIPE_HASH_LOCKS * nr_node_ids,
+				      sizeof(struct list_head), GFP_KERNEL);
+	if (!conf->inactive_list)
+		goto abort;
+
 	/* We init hash_locks[0] separately to that it can be used
 	 * as the reference lock in the spin_lock_nest_lock() call
 	 * in lock_all_device_hash_locks_irq in order to convince
@@ -7559,7 +7700,7 @@ static struct r5conf *setup_conf(struct mddev *mddev)
 	for (i = 1; i < NR_STRIPE_HASH_LOCKS; i++)
 		spin_lock_init(conf->hash_locks + i);
 
-	for (i = 0; i < NR_STRIPE_HASH_LOCKS; i++)
+	for (i = 0; i < NR_STRIPE_HASH_LOCKS * nr_node_ids; i++)
 		INIT_LIST_HEAD(conf->inactive_list + i);
 
 	for (i = 0; i < NR_STRIPE_HASH_LOCKS; i++)
@@ -94,8 +94,9 @@
  * not hashed must be on the inactive_list, and will normally be at
  * the front.  All stripes start life this way.
  *
- * The inactive_list, handle_list and hash bucket lists are all protected by the
- * device_lock.
+ * The inactive_list is split per hash lock and per node, and each part is
+ * protected by its hash lock.  The handle_list and hash bucket lists are
+ * protected by the device_lock.
  *  - stripes have a reference counter. If count==0, they are on a list.
  *  - If a stripe might need handling, STRIPE_HANDLE is set.
  *  - When refcount reaches zero, then if STRIPE_HANDLE it is put on
@@ -221,6 +222,7 @@ struct stripe_head {
 	enum reconstruct_states reconstruct_state;
 	spinlock_t		stripe_lock;
 	int			cpu;
+	int			numa_node;	/* node its pages are on */
 	struct r5worker_group	*group;
 
 	struct stripe_head	*batch_head; /* protected by stripe lock */
@@ -517,6 +519,8 @@ struct r5worker_group {
 	struct r5conf *conf;
 	struct r5worker *workers;
 	int stripes_cnt;
+	/* stripes released on this group's CPUs, drained by its workers */
+	struct llist_head released_stripes ____cacheline_aligned_in_smp;
 };
 
 /*
@@ -655,7 +659,8 @@ struct r5conf {
 	 * Free stripes pool
 	 */
 	atomic_t		active_stripes;
-	struct list_head	inactive_list[NR_STRIPE_HASH_LOCKS];
+	/* NR_STRIPE_HASH_LOCKS * nr_node_ids lists, see stripe_inactive_list() */
+	struct list_head	*inactive_list;
 
 	atomic_t		r5c_cached_full_stripes;
 	struct list_head	r5c_full_stripe_list;
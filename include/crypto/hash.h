@@ -154,6 +154,9 @@ struct shash_desc {
 
 #define HASH_MAX_DIGESTSIZE	 64
 
+/* Maximum number of messages that can be passed to crypto_shash_finup_mb() */
+#define HASH_MAX_MB_MSGS	2
+
 /*
  * Worst case is hmac(sha3-224-generic).  Its context is a nested 'shash_desc'
  * containing a 'struct sha3_state'.
@@ -173,6 +176,16 @@ struct shash_desc {
  * @update: see struct ahash_alg
  * @final: see struct ahash_alg
  * @finup: see struct ahash_alg
+ * @finup_mb: **[optional]** Multi-buffer hashing support.  Finish calculating
+ *	      the digests of multiple messages, interleaving the instructions to
+ *	      potentially achieve better performance than hashing each message
+ *	      individually.  The num_msgs argument will be between 2 and
+ *	      @mb_max_msgs inclusively.  If there are particular values of len
+ *	      or num_msgs, or a particular calling context (e.g. no-SIMD) that
+ *	      the implementation does not support with this method, the
+ *	      implementation may return -EOPNOTSUPP from this method in those
+ *	      cases to cause the crypto API to fall back to repeated finups.
+ * @mb_max_msgs: Maximum supported value of num_msgs argument to @finup_mb
  * @digest: see struct ahash_alg
  * @export: see struct ahash_alg
  * @import: see struct ahash_alg
@@ -202,6 +215,9 @@ struct shash_alg {
 	int (*final)(struct shash_desc *desc, u8 *out);
 	int (*finup)(struct shash_desc *desc, const u8 *data,
 		     unsigned int len, u8 *out);
+	int (*finup_mb)(struct shash_desc *desc, const u8 * const data[],
+			unsigned int len, u8 * const outs[],
+			unsigned int num_msgs);
 	int (*digest)(struct shash_desc *desc, const u8 *data,
 		      unsigned int len, u8 *out);
 	int (*export)(struct shash_desc *desc, void *out);
@@ -212,6 +228,7 @@ struct shash_alg {
 	void (*exit_tfm)(struct crypto_shash *tfm);
 
 	unsigned int descsize;
+	unsigned int mb_max_msgs;
 
 	/* These fields must match hash_alg_common. */
 	unsigned int digestsize
@@ -795,6 +812,21 @@ static inline unsigned int crypto_shash_statesize(struct crypto_shash *tfm)
 	return crypto_shash_alg(tfm)->statesize;
 }
 
+/**
+ * crypto_shash_mb_max_msgs() - obtain max messages for multi-buffer hashing
+ * @tfm: cipher handle
+ *
+ * Return the maximum number of messages that crypto_shash_finup_mb() can
+ * process at once.  A value of 1 means the algorithm has no multi-buffer
+ * support and crypto_shash_finup_mb() will just hash the messages one by one.
+ *
+ * Return: maximum number of messages, between 1 and HASH_MAX_MB_MSGS
+ */
+static inline unsigned int crypto_shash_mb_max_msgs(struct crypto_shash *tfm)
+{
+	return crypto_shash_alg(tfm)->mb_max_msgs;
+}
+
 static inline u32 crypto_shash_get_flags(struct crypto_shash *tfm)
 {
 	return crypto_tfm_get_flags(crypto_shash_tfm(tfm));
@@ -998,6 +1030,29 @@ int crypto_shash_final(struct shash_desc *desc, u8 *out);
 int crypto_shash_finup(struct shash_desc *desc, const u8 *data,
 		       unsigned int len, u8 *out);
 
+/**
+ * crypto_shash_finup_mb() - multi-buffer message hashing
+ * @desc: the starting state that is forked for each message.  It contains the
+ *	  state after hashing a (possibly-empty) common prefix of the messages.
+ * @data: the data of each message (not including any common prefix from @desc)
+ * @len: length of each data buffer in bytes
+ * @outs: output buffer for each message digest
+ * @num_msgs: number of messages, i.e. the number of entries in @data and @outs.
+ *	      This can't be more than crypto_shash_mb_max_msgs().
+ *
+ * This function provides support for hashing multiple messages of the same
+ * length in a single call.  Algorithms that set &shash_alg.finup_mb interleave
+ * the work of the messages, which on CPUs with serial hash instructions is
+ * substantially faster than hashing them one at a time.  All other algorithms
+ * hash the messages one by one.  @desc itself is not modified.
+ *
+ * Context: Any context.
+ * Return: 0 on success; a negative errno value on failure.
+ */
+int crypto_shash_finup_mb(struct shash_desc *desc, const u8 * const data[],
+			  unsigned int len, u8 * const outs[],
+			  unsigned int num_msgs);
+
 static inline void shash_desc_zero(struct shash_desc *desc)
 {
 	memzero_explicit(desc,
@@ -8,6 +8,18 @@
 
 #define XTS_BLOCK_SIZE 16
 
+/*
+ * IV of "xts-plain64(aes)": the request covers consecutive data units of
+ * 1 << @du_bits bytes. The first one is encrypted with @sector as its
+ * plain64 tweak and each following one with the next sector number, so a
+ * disk encryption driver can hand over many sectors in one request.
+ */
+struct xts_plain64_iv {
+	__le64	sector;
+	u8	du_bits;
+	u8	reserved[7];
+};
+
 static inline int xts_check_key(struct crypto_tfm *tfm,
 				const u8 *key, unsigned int keylen)
 {
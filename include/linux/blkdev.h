@@ -39,6 +39,7 @@ struct pr_ops;
 struct rq_qos;
 struct blk_queue_stats;
 struct blk_stat_callback;
+struct blk_mq_poll_adapt;
 struct blk_crypto_profile;
 
 extern const struct device_type disk_type;
@@ -50,6 +51,8 @@ extern struct class block_class;
 
 /* Doing classic polling */
 #define BLK_MQ_POLL_CLASSIC -1
+/* Sleep for a learned fraction of the per-hctx completion time, then poll */
+#define BLK_MQ_POLL_ADAPTIVE -2
 
 /*
  * Maximum number of blkcg policies allowed to be registered concurrently.
@@ -474,6 +477,7 @@ struct request_queue {
 
 	struct blk_stat_callback	*poll_cb;
 	struct blk_rq_stat	*poll_stat;
+	struct blk_mq_poll_adapt	*poll_adapt;
 
 	struct timer_list	timeout;
 	struct work_struct	timeout_work;
@@ -5,6 +5,7 @@
 #include <linux/task_work.h>
 #include <linux/bitmap.h>
 #include <linux/llist.h>
+#include <linux/hashtable.h>
 #include <uapi/linux/io_uring.h>
 
 struct io_wq_work_node {
@@ -250,6 +251,11 @@ struct io_ring_ctx {
 		struct list_head	cq_overflow_list;
 		struct io_alloc_cache	apoll_cache;
 		struct io_alloc_cache	netmsg_cache;
+
+#ifdef CONFIG_FUTEX
+		/* pending futex waits, protected by ->uring_lock */
+		struct hlist_head	futex_list;
+#endif
 	} ____cacheline_aligned_in_smp;
 
 	/* IRQ completion list, under ->completion_lock */
@@ -261,6 +267,10 @@ struct io_ring_ctx {
 
 	struct wait_queue_head	sqo_sq_wait;
 	struct list_head	sqd_list;
+	/* SQPOLL fair share and accounting, protected by sqd->lock */
+	s64			sq_deficit;
+	u64			sq_work_time;
+	u64			sq_submitted;
 
 	unsigned long		check_cq;
 
@@ -355,6 +365,18 @@ struct io_ring_ctx {
 	unsigned			sq_thread_idle;
 	/* protected by ->completion_lock */
 	unsigned			evfd_last_cq_tail;
+
+#ifdef CONFIG_NET_RX_BUSY_POLL
+	/* NAPI ids of sockets with armed poll requests, see napi.c */
+	struct list_head		napi_list;
+	spinlock_t			napi_lock;
+	DECLARE_HASHTABLE(napi_ht, 4);
+
+	/* busy poll timeout in usec, 0 disables busy polling */
+	unsigned int			napi_busy_poll_to;
+	bool				napi_prefer_busy_poll;
+	bool				napi_enabled;
+#endif
 };
 
 enum {
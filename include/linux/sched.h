@@ -389,6 +389,11 @@ struct sched_info {
 	/* When were we last queued to run? */
 	unsigned long long		last_queued;
 
+#ifdef CONFIG_SCHED_LAT_HIST
+	/* Were we last queued by a wakeup? */
+	unsigned int			queued_by_wakeup;
+#endif
+
 #endif /* CONFIG_SCHED_INFO */
 };
 
@@ -561,6 +566,8 @@ struct sched_entity {
 #ifdef CONFIG_SCHED_BORE
 	u64				prev_burst_time;
 	u64				burst_time;
+	u64				child_burst;
+	u64				child_burst_last_cached;
 	u8				burst_score;
 #endif // CONFIG_SCHED_BORE
 
@@ -410,6 +410,15 @@ int do_tcp_getsockopt(struct sock *sk, int level,
 		      int optname, sockptr_t optval, sockptr_t optlen);
 int tcp_getsockopt(struct sock *sk, int level, int optname,
 		   char __user *optval, int __user *optlen);
+#if IS_ENABLED(CONFIG_INET) && defined(CONFIG_MMU)
+int tcp_zerocopy_receive_sk(struct sock *sk, struct tcp_zerocopy_receive *zc);
+#else
+static inline int tcp_zerocopy_receive_sk(struct sock *sk,
+					  struct tcp_zerocopy_receive *zc)
+{
+	return -EOPNOTSUPP;
+}
+#endif
 bool tcp_bpf_bypass_getsockopt(int level, int optname);
 int do_tcp_setsockopt(struct sock *sk, int level, int optname,
 		      sockptr_t optval, unsigned int optlen);
@@ -57,6 +57,7 @@ struct io_uring_sqe {
 		__u32		xattr_flags;
 		__u32		msg_ring_flags;
 		__u32		uring_cmd_flags;
+		__u32		futex_flags;
 	};
 	__u64	user_data;	/* data to be passed back at completion time */
 	/* pack this to avoid bogus arm OABI complaints */
@@ -215,6 +216,12 @@ enum io_uring_op {
 	IORING_OP_URING_CMD,
 	IORING_OP_SEND_ZC,
 	IORING_OP_SENDMSG_ZC,
+	IORING_OP_READ_MULTISHOT,
+	IORING_OP_WAITID,
+	IORING_OP_FUTEX_WAIT,
+	IORING_OP_FUTEX_WAKE,
+	IORING_OP_FUTEX_WAITV,
+	IORING_OP_RECV_ZC_COPYLESS,	/* not the same as IORING_OP_RECV_ZC */
 
 	/* this goes last, obviously */
 	IORING_OP_LAST,
@@ -508,6 +515,13 @@ enum {
 	/* register a range of fixed file slots for automatic slot allocation */
 	IORING_REGISTER_FILE_ALLOC_RANGE	= 25,
 
+	/* register/unregister NAPI busy polling settings */
+	IORING_REGISTER_NAPI			= 27,
+	IORING_UNREGISTER_NAPI			= 28,
+
+	/* share registered buffers from another ring */
+	IORING_REGISTER_CLONE_BUFFERS		= 30,
+
 	/* this goes last */
 	IORING_REGISTER_LAST
 };
@@ -677,6 +691,30 @@ struct io_uring_file_index_range {
 	__u64	resv;
 };
 
+/*
+ * Argument for IORING_(UN)REGISTER_NAPI
+ */
+struct io_uring_napi {
+	__u32	busy_poll_to;
+	__u8	prefer_busy_poll;
+	__u8	pad[3];
+	__u64	resv;
+};
+
+/*
+ * Argument for IORING_REGISTER_CLONE_BUFFERS. Buffers
+ * [src_off, src_off + nr) of the ring src_fd are installed at
+ * [dst_off, dst_off + nr), nr == 0 means all buffers from src_off on.
+ */
+struct io_uring_clone_buffers {
+	__u32	src_fd;
+	__u32	flags;
+	__u32	src_off;
+	__u32	dst_off;
+	__u32	nr;
+	__u32	pad[3];
+};
+
 struct io_uring_recvmsg_out {
 	__u32 namelen;
 	__u32 controllen;
@@ -38,10 +38,23 @@
  *
  *      It is only used if ublksrv set UBLK_F_NEED_GET_DATA flag
  *      while starting a ublk device.
+ *
+ * REGISTER_IO_BUF: only used with UBLK_F_SUPPORT_ZERO_COPY, issued on the
+ *      ring that FETCH_REQ was issued on while ublksrv owns the request of
+ *      @tag. The request's data pages are installed as registered buffer
+ *      @addr of that ring, starting at buffer address 0, and can then be
+ *      passed to the backing device with READ_FIXED/WRITE_FIXED. The
+ *      buffer only moves data the way the request does. The request is not
+ *      completed until the buffer is unregistered and no longer in use.
+ *
+ * UNREGISTER_IO_BUF: drops registered buffer @addr installed by
+ *      REGISTER_IO_BUF.
  */
 #define	UBLK_IO_FETCH_REQ		0x20
 #define	UBLK_IO_COMMIT_AND_FETCH_REQ	0x21
 #define	UBLK_IO_NEED_GET_DATA	0x22
+#define	UBLK_IO_REGISTER_IO_BUF		0x23
+#define	UBLK_IO_UNREGISTER_IO_BUF	0x24
 
 /* only ABORT means that no re-fetch */
 #define UBLK_IO_RES_OK			0
@@ -55,8 +68,9 @@
 #define UBLK_MAX_QUEUE_DEPTH	4096
 
 /*
- * zero copy requires 4k block size, and can remap ublk driver's io
- * request into ublksrv's vm space
+ * zero copy: io data is never copied into ublksrv's buffer, instead the
+ * request's pages are lent to ublksrv's io_uring with REGISTER_IO_BUF and
+ * io->addr is unused. Implies !UBLK_F_NEED_GET_DATA.
  */
 #define UBLK_F_SUPPORT_ZERO_COPY	(1ULL << 0)
 
@@ -11,6 +11,7 @@
 
 #include "io_uring.h"
 #include "sqpoll.h"
+#include "tctx.h"
 #include "fdinfo.h"
 #include "cancel.h"
 #include "rsrc.h"
@@ -146,6 +147,11 @@ static __cold void __io_uring_show_fdinfo(struct io_ring_ctx *ctx,
 
 	seq_printf(m, "SqThread:\t%d\n", sq ? task_pid_nr(sq->thread) : -1);
 	seq_printf(m, "SqThreadCpu:\t%d\n", sq ? task_cpu(sq->thread) : -1);
+	seq_printf(m, "SqThreadIdle:\t%u\n",
+		   sq ? jiffies_to_msecs(sq->sq_thread_idle_cur) : 0);
+	seq_printf(m, "SqWorkTime:\t%llu\n",
+		   div_u64(READ_ONCE(ctx->sq_work_time), NSEC_PER_USEC));
+	seq_printf(m, "SqSubmitted:\t%llu\n", READ_ONCE(ctx->sq_submitted));
 	seq_printf(m, "UserFiles:\t%u\n", ctx->nr_user_files);
 	for (i = 0; has_lock && i < ctx->nr_user_files; i++) {
 		struct file *f = io_file_from_index(&ctx->file_table, i);
@@ -162,6 +168,19 @@ static __cold void __io_uring_show_fdinfo(struct io_ring_ctx *ctx,
 
 		seq_printf(m, "%5u: 0x%llx/%u\n", i, buf->ubuf, len);
 	}
+	if (has_lock) {
+		struct io_wq_stats stats = { };
+		struct io_tctx_node *node;
+
+		list_for_each_entry(node, &ctx->tctx_list, ctx_node) {
+			struct io_uring_task *tctx = node->task->io_uring;
+
+			if (tctx && tctx->io_wq)
+				io_wq_get_stats(tctx->io_wq, &stats);
+		}
+		seq_printf(m, "IoWqSteals:\t%lu\n", stats.steals);
+		seq_printf(m, "IoWqHashStalls:\t%lu\n", stats.hash_stalls);
+	}
 	if (has_lock && !xa_empty(&ctx->personalities)) {
 		unsigned long index;
 		const struct cred *cred;
@@ -204,6 +223,18 @@ static __cold void __io_uring_show_fdinfo(struct io_ring_ctx *ctx,
 	}
 
 	spin_unlock(&ctx->completion_lock);
+
+#ifdef CONFIG_NET_RX_BUSY_POLL
+	if (READ_ONCE(ctx->napi_enabled)) {
+		seq_puts(m, "NAPI:\tenabled\n");
+		seq_printf(m, "napi_busy_poll_to:\t%u\n",
+			   READ_ONCE(ctx->napi_busy_poll_to));
+		seq_printf(m, "napi_prefer_busy_poll:\t%u\n",
+			   READ_ONCE(ctx->napi_prefer_busy_poll));
+	} else {
+		seq_puts(m, "NAPI:\tdisabled\n");
+	}
+#endif
 }
 
 __cold void io_uring_show_fdinfo(struct seq_file *m, struct file *f)
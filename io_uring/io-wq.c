@@ -107,6 +107,10 @@ struct io_wqe {
 	struct io_wq_work *hash_tail[IO_WQ_NR_HASH_BUCKETS];
 
 	cpumask_var_t cpu_mask;
+
+	/* other nodes, nearest first, that idle workers may steal from */
+	int *steal_order;
+	int nr_steal;
 };
 
 /*
@@ -120,6 +124,9 @@ struct io_wq {
 
 	struct io_wq_hash *hash;
 
+	atomic_long_t nr_steals;
+	atomic_long_t nr_hash_stalls;
+
 	atomic_t worker_refs;
 	struct completion worker_done;
 
@@ -502,6 +509,7 @@ static struct io_wq_work *io_get_next_work(struct io_wqe_acct *acct,
 	if (stall_hash != -1U) {
 		bool unstalled;
 
+		atomic_long_inc(&wqe->wq->nr_hash_stalls);
 		/*
 		 * Set this before dropping the lock to avoid racing with new
 		 * work being added and clearing the stalled bit.
@@ -536,13 +544,71 @@ static void io_assign_current_work(struct io_worker *worker,
 
 static void io_wqe_enqueue(struct io_wqe *wqe, struct io_wq_work *work);
 
-static void io_worker_handle_work(struct io_worker *worker)
+/*
+ * Run @work, which has already been removed from a work list, along with
+ * any hashed work and dependent links that follow it.
+ */
+static void io_worker_run_work(struct io_worker *worker,
+			       struct io_wq_work *work)
 {
 	struct io_wqe_acct *acct = io_wqe_get_acct(worker);
 	struct io_wqe *wqe = worker->wqe;
 	struct io_wq *wq = wqe->wq;
 	bool do_kill = test_bit(IO_WQ_BIT_EXIT, &wq->state);
 
+	__io_worker_busy(wqe, worker);
+
+	/*
+	 * Make sure cancelation can find this, even before it becomes the
+	 * active work. That avoids a window where the work has been removed
+	 * from our general work list, but isn't yet discoverable as the
+	 * current work item for this worker.
+	 */
+	raw_spin_lock(&worker->lock);
+	worker->next_work = work;
+	raw_spin_unlock(&worker->lock);
+
+	io_assign_current_work(worker, work);
+	__set_current_state(TASK_RUNNING);
+
+	/* handle a whole dependent link */
+	do {
+		struct io_wq_work *next_hashed, *linked;
+		unsigned int hash = io_get_work_hash(work);
+
+		next_hashed = wq_next_work(work);
+
+		if (unlikely(do_kill) && (work->flags & IO_WQ_WORK_UNBOUND))
+			work->flags |= IO_WQ_WORK_CANCEL;
+		wq->do_work(work);
+		io_assign_current_work(worker, NULL);
+
+		linked = wq->free_work(work);
+		work = next_hashed;
+		if (!work && linked && !io_wq_is_hashed(linked)) {
+			work = linked;
+			linked = NULL;
+		}
+		io_assign_current_work(worker, work);
+		if (linked)
+			io_wqe_enqueue(wqe, linked);
+
+		if (hash != -1U && !next_hashed) {
+			/* serialize hash clear with wake_up() */
+			spin_lock_irq(&wq->hash->wait.lock);
+			clear_bit(hash, &wq->hash->map);
+			clear_bit(IO_ACCT_STALLED_BIT, &acct->flags);
+			spin_unlock_irq(&wq->hash->wait.lock);
+			if (wq_has_sleeper(&wq->hash->wait))
+				wake_up(&wq->hash->wait);
+		}
+	} while (work);
+}
+
+static void io_worker_handle_work(struct io_worker *worker)
+{
+	struct io_wqe_acct *acct = io_wqe_get_acct(worker);
+
 	do {
 		struct io_wq_work *work;
 
@@ -556,60 +622,77 @@ static void io_worker_handle_work(struct io_worker *worker)
 		raw_spin_lock(&acct->lock);
 		work = io_get_next_work(acct, worker);
 		raw_spin_unlock(&acct->lock);
-		if (work) {
-			__io_worker_busy(wqe, worker);
-
-			/*
-			 * Make sure cancelation can find this, even before
-			 * it becomes the active work. That avoids a window
-			 * where the work has been removed from our general
-			 * work list, but isn't yet discoverable as the
-			 * current work item for this worker.
-			 */
-			raw_spin_lock(&worker->lock);
-			worker->next_work = work;
-			raw_spin_unlock(&worker->lock);
-		} else {
+		if (!work)
 			break;
-		}
-		io_assign_current_work(worker, work);
-		__set_current_state(TASK_RUNNING);
-
-		/* handle a whole dependent link */
-		do {
-			struct io_wq_work *next_hashed, *linked;
-			unsigned int hash = io_get_work_hash(work);
-
-			next_hashed = wq_next_work(work);
-
-			if (unlikely(do_kill) && (work->flags & IO_WQ_WORK_UNBOUND))
-				work->flags |= IO_WQ_WORK_CANCEL;
-			wq->do_work(work);
-			io_assign_current_work(worker, NULL);
-
-			linked = wq->free_work(work);
-			work = next_hashed;
-			if (!work && linked && !io_wq_is_hashed(linked)) {
-				work = linked;
-				linked = NULL;
-			}
-			io_assign_current_work(worker, work);
-			if (linked)
-				io_wqe_enqueue(wqe, linked);
-
-			if (hash != -1U && !next_hashed) {
-				/* serialize hash clear with wake_up() */
-				spin_lock_irq(&wq->hash->wait.lock);
-				clear_bit(hash, &wq->hash->map);
-				clear_bit(IO_ACCT_STALLED_BIT, &acct->flags);
-				spin_unlock_irq(&wq->hash->wait.lock);
-				if (wq_has_sleeper(&wq->hash->wait))
-					wake_up(&wq->hash->wait);
-			}
-		} while (work);
+		io_worker_run_work(worker, work);
 	} while (1);
 }
 
+/*
+ * Nothing runnable on our own node. Look for unhashed work queued on other
+ * nodes that have no idle worker of their own, nearest node first. Hashed
+ * work is serialized through the owning node's hash_tail[] and is always
+ * left for that node to run.
+ */
+static struct io_wq_work *io_wqe_steal_work(struct io_worker *worker)
+{
+	struct io_wqe *wqe = worker->wqe;
+	struct io_wq *wq = wqe->wq;
+	int index = io_wqe_get_acct(worker)->index;
+	int i;
+
+	for (i = 0; i < wqe->nr_steal; i++) {
+		struct io_wqe *victim = wq->wqes[wqe->steal_order[i]];
+		struct io_wqe_acct *acct = &victim->acct[index];
+		struct io_wq_work_node *node, *prev;
+
+		if (wq_list_empty(&acct->work_list) ||
+		    !hlist_nulls_empty(&victim->free_list))
+			continue;
+
+		raw_spin_lock(&acct->lock);
+		wq_list_for_each(node, prev, &acct->work_list) {
+			struct io_wq_work *work;
+
+			work = container_of(node, struct io_wq_work, list);
+			if (io_wq_is_hashed(work))
+				continue;
+			wq_list_del(&acct->work_list, node, prev);
+			raw_spin_unlock(&acct->lock);
+			atomic_long_inc(&wq->nr_steals);
+			return work;
+		}
+		raw_spin_unlock(&acct->lock);
+	}
+
+	return NULL;
+}
+
+/*
+ * @wqe has no free worker for unhashed work and can't create another one.
+ * Wake an idle worker on the nearest node that has one, it'll steal the
+ * work from us.
+ */
+static bool io_wqe_wake_remote_worker(struct io_wqe *wqe, int index)
+{
+	int i;
+
+	for (i = 0; i < wqe->nr_steal; i++) {
+		struct io_wqe *other = wqe->wq->wqes[wqe->steal_order[i]];
+		bool woken;
+
+		raw_spin_lock(&other->lock);
+		rcu_read_lock();
+		woken = io_wqe_activate_free_worker(other, &other->acct[index]);
+		rcu_read_unlock();
+		raw_spin_unlock(&other->lock);
+		if (woken)
+			return true;
+	}
+
+	return false;
+}
+
 static int io_wqe_worker(void *data)
 {
 	struct io_worker *worker = data;
@@ -625,12 +708,20 @@ static int io_wqe_worker(void *data)
 	set_task_comm(current, buf);
 
 	while (!test_bit(IO_WQ_BIT_EXIT, &wq->state)) {
+		struct io_wq_work *work;
 		long ret;
 
 		set_current_state(TASK_INTERRUPTIBLE);
 		while (io_acct_run_queue(acct))
 			io_worker_handle_work(worker);
 
+		work = io_wqe_steal_work(worker);
+		if (work) {
+			io_worker_run_work(worker, work);
+			last_timeout = false;
+			continue;
+		}
+
 		raw_spin_lock(&wqe->lock);
 		/* timed out, exit unless we're the last worker */
 		if (last_timeout && acct->nr_workers > 1) {
@@ -929,6 +1020,12 @@ static void io_wqe_enqueue(struct io_wqe *wqe, struct io_wq_work *work)
 
 	raw_spin_unlock(&wqe->lock);
 
+	/* saturated here, let an idle worker on another node take it */
+	if (do_create && !(work_flags & IO_WQ_WORK_HASHED) &&
+	    READ_ONCE(acct->nr_workers) >= acct->max_workers &&
+	    io_wqe_wake_remote_worker(wqe, acct->index))
+		return;
+
 	if (do_create && ((work_flags & IO_WQ_WORK_CONCURRENT) ||
 	    !atomic_read(&acct->nr_running))) {
 		bool did_create;
@@ -1132,6 +1229,36 @@ static int io_wqe_hash_wake(struct wait_queue_entry *wait, unsigned mode,
 	return 1;
 }
 
+static int io_wqe_init_steal_order(struct io_wqe *wqe, int node)
+{
+	int other, i, nr = 0;
+
+	if (num_possible_nodes() == 1)
+		return 0;
+
+	wqe->steal_order = kcalloc(num_possible_nodes() - 1, sizeof(int),
+				   GFP_KERNEL);
+	if (!wqe->steal_order)
+		return -ENOMEM;
+
+	/* insertion sort by distance, nearest node first */
+	for_each_node(other) {
+		if (other == node)
+			continue;
+		for (i = nr; i > 0; i--) {
+			int prev = wqe->steal_order[i - 1];
+
+			if (node_distance(node, prev) <= node_distance(node, other))
+				break;
+			wqe->steal_order[i] = prev;
+		}
+		wqe->steal_order[i] = other;
+		nr++;
+	}
+	wqe->nr_steal = nr;
+	return 0;
+}
+
 struct io_wq *io_wq_create(unsigned bounded, struct io_wq_data *data)
 {
 	int ret, node, i;
@@ -1188,6 +1315,12 @@ struct io_wq *io_wq_create(unsigned bounded, struct io_wq_data *data)
 		INIT_LIST_HEAD(&wqe->all_list);
 	}
 
+	for_each_node(node) {
+		ret = io_wqe_init_steal_order(wq->wqes[node], node);
+		if (ret)
+			goto err;
+	}
+
 	wq->task = get_task_struct(data->task);
 	atomic_set(&wq->worker_refs, 1);
 	init_completion(&wq->worker_done);
@@ -1199,6 +1332,7 @@ struct io_wq *io_wq_create(unsigned bounded, struct io_wq_data *data)
 		if (!wq->wqes[node])
 			continue;
 		free_cpumask_var(wq->wqes[node]->cpu_mask);
+		kfree(wq->wqes[node]->steal_order);
 		kfree(wq->wqes[node]);
 	}
 err_wq:
@@ -1206,6 +1340,12 @@ struct io_wq *io_wq_create(unsigned bounded, struct io_wq_data *data)
 	return ERR_PTR(ret);
 }
 
+void io_wq_get_stats(struct io_wq *wq, struct io_wq_stats *stats)
+{
+	stats->steals += atomic_long_read(&wq->nr_steals);
+	stats->hash_stalls += atomic_long_read(&wq->nr_hash_stalls);
+}
+
 static bool io_task_work_match(struct callback_head *cb, void *data)
 {
 	struct io_worker *worker;
@@ -1281,6 +1421,7 @@ static void io_wq_destroy(struct io_wq *wq)
 		};
 		io_wqe_cancel_pending_work(wqe, &match);
 		free_cpumask_var(wqe->cpu_mask);
+		kfree(wqe->steal_order);
 		kfree(wqe);
 	}
 	io_wq_put_hash(wq->hash);
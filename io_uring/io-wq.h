@@ -53,6 +53,13 @@ void io_wq_hash_work(struct io_wq_work *work, void *val);
 int io_wq_cpu_affinity(struct io_wq *wq, cpumask_var_t mask);
 int io_wq_max_workers(struct io_wq *wq, int *new_count);
 
+struct io_wq_stats {
+	unsigned long steals;		/* work run by another node's worker */
+	unsigned long hash_stalls;	/* workers blocked behind hashed work */
+};
+
+void io_wq_get_stats(struct io_wq *wq, struct io_wq_stats *stats);
+
 static inline bool io_wq_is_hashed(struct io_wq_work *work)
 {
 	return work->flags & IO_WQ_WORK_HASHED;
@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <linux/kernel.h>
+#include <linux/errno.h>
+#include <linux/slab.h>
+#include <linux/hashtable.h>
+#include <linux/rculist.h>
+#include <linux/uaccess.h>
+#include <linux/io_uring.h>
+
+#include <uapi/linux/io_uring.h>
+
+#include "io_uring.h"
+#include "napi.h"
+
+#ifdef CONFIG_NET_RX_BUSY_POLL
+
+/* NAPI ids that saw no new poll arming for this long are dropped */
+#define NAPI_TIMEOUT		(60 * HZ)
+
+struct io_napi_entry {
+	unsigned int		napi_id;
+	struct list_head	list;
+
+	unsigned long		timeout;
+	struct hlist_node	node;
+
+	struct rcu_head		rcu;
+};
+
+static struct io_napi_entry *io_napi_hash_find(struct hlist_head *hash_list,
+					       unsigned int napi_id)
+{
+	struct io_napi_entry *e;
+
+	hlist_for_each_entry_rcu(e, hash_list, node) {
+		if (e->napi_id != napi_id)
+			continue;
+		WRITE_ONCE(e->timeout, jiffies + NAPI_TIMEOUT);
+		return e;
+	}
+
+	return NULL;
+}
+
+void __io_napi_add(struct io_ring_ctx *ctx, struct socket *sock)
+{
+	struct hlist_head *hash_list;
+	struct io_napi_entry *e;
+	unsigned int napi_id;
+	struct sock *sk;
+
+	sk = sock->sk;
+	if (!sk)
+		return;
+
+	napi_id = READ_ONCE(sk->sk_napi_id);
+
+	/* Non-NAPI IDs can be rejected */
+	if (napi_id < MIN_NAPI_ID)
+		return;
+
+	hash_list = &ctx->napi_ht[hash_min(napi_id, HASH_BITS(ctx->napi_ht))];
+
+	rcu_read_lock();
+	e = io_napi_hash_find(hash_list, napi_id);
+	rcu_read_unlock();
+	if (e)
+		return;
+
+	e = kmalloc(sizeof(*e), GFP_NOWAIT);
+	if (!e)
+		return;
+
+	e->napi_id = napi_id;
+	e->timeout = jiffies + NAPI_TIMEOUT;
+
+	spin_lock(&ctx->napi_lock);
+	if (unlikely(io_napi_hash_find(hash_list, napi_id))) {
+		spin_unlock(&ctx->napi_lock);
+		kfree(e);
+		return;
+	}
+
+	hlist_add_tail_rcu(&e->node, hash_list);
+	list_add_tail_rcu(&e->list, &ctx->napi_list);
+	spin_unlock(&ctx->napi_lock);
+}
+
+static void io_napi_remove_stale(struct io_ring_ctx *ctx)
+{
+	struct io_napi_entry *e;
+	struct hlist_node *tmp;
+	unsigned int i;
+
+	spin_lock(&ctx->napi_lock);
+	hash_for_each_safe(ctx->napi_ht, i, tmp, e, node) {
+		if (time_after(jiffies, READ_ONCE(e->timeout))) {
+			list_del_rcu(&e->list);
+			hash_del_rcu(&e->node);
+			kfree_rcu(e, rcu);
+		}
+	}
+	spin_unlock(&ctx->napi_lock);
+}
+
+static inline bool io_napi_busy_loop_timeout(unsigned long start_time,
+					     unsigned long bp_usec)
+{
+	if (bp_usec) {
+		unsigned long end_time = start_time + bp_usec;
+		unsigned long now = busy_loop_current_time();
+
+		return time_after(now, end_time);
+	}
+
+	return true;
+}
+
+static bool io_napi_busy_loop_should_end(struct io_wait_queue *iowq,
+					 unsigned long start_time,
+					 unsigned long bp_usec)
+{
+	if (signal_pending(current))
+		return true;
+	if (io_should_wake(iowq) || io_has_work(iowq->ctx))
+		return true;
+	if (io_napi_busy_loop_timeout(start_time, bp_usec))
+		return true;
+
+	return false;
+}
+
+/*
+ * Poll every tracked NAPI context once. napi_busy_loop() without a loop_end
+ * callback does a single pass and never sleeps, so this is safe under RCU.
+ * Returns true if any of the entries has gone stale.
+ */
+static bool __io_napi_do_busy_loop(struct io_ring_ctx *ctx,
+				   bool prefer_busy_poll)
+{
+	struct io_napi_entry *e;
+	bool is_stale = false;
+
+	list_for_each_entry_rcu(e, &ctx->napi_list, list) {
+		napi_busy_loop(e->napi_id, NULL, NULL, prefer_busy_poll,
+			       BUSY_POLL_BUDGET);
+
+		if (time_after(jiffies, READ_ONCE(e->timeout)))
+			is_stale = true;
+	}
+
+	return is_stale;
+}
+
+/*
+ * Busy poll the NAPI contexts of the ring's sockets for up to the ring's
+ * busy poll timeout, or until the wait condition is satisfied. Never spins
+ * past the wait timeout the application passed in.
+ */
+void __io_napi_busy_loop(struct io_ring_ctx *ctx, struct io_wait_queue *iowq)
+{
+	unsigned long bp_usec = READ_ONCE(ctx->napi_busy_poll_to);
+	bool prefer_busy_poll = READ_ONCE(ctx->napi_prefer_busy_poll);
+	unsigned long start_time;
+	bool is_stale = false;
+
+	if (!bp_usec || list_empty_careful(&ctx->napi_list))
+		return;
+
+	if (iowq->timeout != KTIME_MAX) {
+		ktime_t left = ktime_sub(iowq->timeout, ktime_get());
+
+		if (ktime_to_ns(left) <= 0)
+			return;
+		bp_usec = min_t(u64, bp_usec, ktime_to_us(left));
+	}
+
+	start_time = busy_loop_current_time();
+
+	rcu_read_lock();
+	do {
+		is_stale = __io_napi_do_busy_loop(ctx, prefer_busy_poll);
+	} while (!io_napi_busy_loop_should_end(iowq, start_time, bp_usec) &&
+		 !need_resched());
+	rcu_read_unlock();
+
+	if (is_stale)
+		io_napi_remove_stale(ctx);
+}
+
+/*
+ * Called by the SQPOLL thread for each of its rings. Does a single pass over
+ * the tracked NAPI contexts and reports whether there was anything to poll,
+ * so that the thread keeps spinning rather than going idle.
+ */
+int io_napi_sqpoll_busy_poll(struct io_ring_ctx *ctx)
+{
+	bool is_stale;
+
+	if (!READ_ONCE(ctx->napi_busy_poll_to) ||
+	    list_empty_careful(&ctx->napi_list))
+		return 0;
+
+	rcu_read_lock();
+	is_stale = __io_napi_do_busy_loop(ctx,
+					  READ_ONCE(ctx->napi_prefer_busy_poll));
+	rcu_read_unlock();
+
+	if (is_stale)
+		io_napi_remove_stale(ctx);
+
+	return 1;
+}
+
+void io_napi_init(struct io_ring_ctx *ctx)
+{
+	INIT_LIST_HEAD(&ctx->napi_list);
+	spin_lock_init(&ctx->napi_lock);
+	hash_init(ctx->napi_ht);
+	ctx->napi_busy_poll_to = READ_ONCE(sysctl_net_busy_poll);
+	ctx->napi_prefer_busy_poll = false;
+	ctx->napi_enabled = false;
+}
+
+void io_napi_free(struct io_ring_ctx *ctx)
+{
+	struct io_napi_entry *e;
+	struct hlist_node *tmp;
+	unsigned int i;
+
+	spin_lock(&ctx->napi_lock);
+	hash_for_each_safe(ctx->napi_ht, i, tmp, e, node) {
+		list_del_rcu(&e->list);
+		hash_del_rcu(&e->node);
+		kfree_rcu(e, rcu);
+	}
+	spin_unlock(&ctx->napi_lock);
+}
+
+/*
+ * Enable NAPI busy polling for the ring. The previous settings are copied
+ * back to the user.
+ */
+int io_register_napi(struct io_ring_ctx *ctx, void __user *arg)
+{
+	const struct io_uring_napi curr = {
+		.busy_poll_to	  = ctx->napi_busy_poll_to,
+		.prefer_busy_poll = ctx->napi_prefer_busy_poll,
+	};
+	struct io_uring_napi napi;
+
+	if (copy_from_user(&napi, arg, sizeof(napi)))
+		return -EFAULT;
+	if (napi.pad[0] || napi.pad[1] || napi.pad[2] || napi.resv)
+		return -EINVAL;
+
+	if (copy_to_user(arg, &curr, sizeof(curr)))
+		return -EFAULT;
+
+	WRITE_ONCE(ctx->napi_busy_poll_to, napi.busy_poll_to);
+	WRITE_ONCE(ctx->napi_prefer_busy_poll, !!napi.prefer_busy_poll);
+	WRITE_ONCE(ctx->napi_enabled, true);
+	return 0;
+}
+
+/*
+ * Disable NAPI busy polling for the ring. If @arg is non-NULL, the current
+ * settings are copied back to the user.
+ */
+int io_unregister_napi(struct io_ring_ctx *ctx, void __user *arg)
+{
+	const struct io_uring_napi curr = {
+		.busy_poll_to	  = ctx->napi_busy_poll_to,
+		.prefer_busy_poll = ctx->napi_prefer_busy_poll,
+	};
+
+	if (arg && copy_to_user(arg, &curr, sizeof(curr)))
+		return -EFAULT;
+
+	WRITE_ONCE(ctx->napi_busy_poll_to, 0);
+	WRITE_ONCE(ctx->napi_prefer_busy_poll, false);
+	WRITE_ONCE(ctx->napi_enabled, false);
+	return 0;
+}
+
+#endif /* CONFIG_NET_RX_BUSY_POLL */
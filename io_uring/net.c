@@ -6,6 +6,7 @@
 #include <linux/net.h>
 #include <linux/compat.h>
 #include <net/compat.h>
+#include <net/tcp.h>
 #include <linux/io_uring.h>
 
 #include <uapi/linux/io_uring.h>
@@ -918,6 +919,119 @@ int io_recv(struct io_kiocb *req, unsigned int issue_flags)
 	return ret;
 }
 
+/*
+ * Zero copy receive: instead of copying, whole pages of payload are mapped
+ * into the selected provided buffer, which must be page aligned and lie
+ * inside a tcp_mmap() area of the socket. The application hands the buffer
+ * back to its group once it's done with the data, the next receive into it
+ * replaces the mapping. Data that can't be mapped, because it's less than a
+ * page or isn't page aligned in the skb, is left in the socket and flagged
+ * with a zero length IORING_CQE_F_SOCK_NONEMPTY completion, to be read with
+ * a regular receive.
+ */
+int io_recvzc_prep(struct io_kiocb *req, const struct io_uring_sqe *sqe)
+{
+	struct io_sr_msg *zc = io_kiocb_to_cmd(req, struct io_sr_msg);
+
+	if (unlikely(sqe->file_index || sqe->addr2 || sqe->addr ||
+		     sqe->msg_flags))
+		return -EINVAL;
+	if (!(req->flags & REQ_F_BUFFER_SELECT))
+		return -EINVAL;
+
+	zc->len = READ_ONCE(sqe->len);
+	zc->flags = READ_ONCE(sqe->ioprio);
+	if (zc->flags & ~(RECVMSG_FLAGS))
+		return -EINVAL;
+	if (zc->flags & IORING_RECV_MULTISHOT) {
+		if (zc->len)
+			return -EINVAL;
+		req->flags |= REQ_F_APOLL_MULTISHOT;
+		zc->buf_group = req->buf_index;
+	}
+	zc->done_io = 0;
+	return 0;
+}
+
+int io_recvzc(struct io_kiocb *req, unsigned int issue_flags)
+{
+	struct io_sr_msg *zc = io_kiocb_to_cmd(req, struct io_sr_msg);
+	struct tcp_zerocopy_receive tzc;
+	struct socket *sock;
+	unsigned int cflags;
+	size_t len;
+	int ret;
+
+	if (!(req->flags & REQ_F_POLLED) &&
+	    (zc->flags & IORING_RECVSEND_POLL_FIRST))
+		return -EAGAIN;
+
+	sock = sock_from_file(req->file);
+	if (unlikely(!sock))
+		return -ENOTSOCK;
+	if (!sk_is_tcp(sock->sk))
+		return -EOPNOTSUPP;
+
+retry_multishot:
+	len = zc->len;
+	memset(&tzc, 0, sizeof(tzc));
+	tzc.address = (unsigned long) io_buffer_select(req, &len, issue_flags);
+	if (!tzc.address)
+		return -ENOBUFS;
+	tzc.length = len;
+
+	ret = tcp_zerocopy_receive_sk(sock->sk, &tzc);
+	if (!ret && !tzc.length && !tzc.recv_skip_hint) {
+		/* nothing queued yet, wait for more */
+		io_kbuf_recycle(req, issue_flags);
+		if (issue_flags & IO_URING_F_MULTISHOT)
+			return IOU_ISSUE_SKIP_COMPLETE;
+		return -EAGAIN;
+	}
+
+	if (!ret && !tzc.length && (req->flags & REQ_F_APOLL_MULTISHOT)) {
+		/*
+		 * Only data that can't be mapped is queued. Multishot stays
+		 * armed: tell the application to copy it out, once per wakeup
+		 * of the poll handler, and wait for more. Not from the first
+		 * issue, the poll handler runs right after arming and would
+		 * report it again.
+		 */
+		io_kbuf_recycle(req, issue_flags);
+		if (!(issue_flags & IO_URING_F_MULTISHOT))
+			return -EAGAIN;
+		if (io_post_aux_cqe(req->ctx, req->cqe.user_data, 0,
+				    IORING_CQE_F_SOCK_NONEMPTY | IORING_CQE_F_MORE,
+				    false))
+			return IOU_ISSUE_SKIP_COMPLETE;
+		/* the CQ ring overflowed, end multishot below */
+	}
+
+	cflags = 0;
+	if (!ret) {
+		/* with nothing mapped, what is left must be copied out */
+		if (tzc.inq > 0)
+			cflags |= IORING_CQE_F_SOCK_NONEMPTY;
+		ret = tzc.length;
+	} else if (ret == -EIO) {
+		/* connection closed and everything read */
+		ret = 0;
+	} else {
+		if (ret == -ERESTARTSYS)
+			ret = -EINTR;
+		req_set_fail(req);
+	}
+	if (ret <= 0)
+		io_kbuf_recycle(req, issue_flags);
+
+	cflags |= io_put_kbuf(req, issue_flags);
+
+	if (!io_recv_finish(req, &ret, cflags, ret <= 0, issue_flags))
+		goto retry_multishot;
+
+	return ret;
+}
+
 void io_send_zc_cleanup(struct io_kiocb *req)
 {
 	struct io_sr_msg *zc = io_kiocb_to_cmd(req, struct io_sr_msg);
@@ -9,6 +9,7 @@
 #include <linux/hugetlb.h>
 #include <linux/compat.h>
 #include <linux/io_uring.h>
+#include <linux/blk-mq.h>
 
 #include <uapi/linux/io_uring.h>
 
@@ -23,6 +24,15 @@ struct io_rsrc_update {
 	u32				offset;
 };
 
+struct io_imu_folio_data {
+	/* pages used in the first folio, which may start at an offset */
+	unsigned int	nr_pages_head;
+	/* pages in every other folio */
+	unsigned int	nr_pages_mid;
+	unsigned int	folio_shift;
+	unsigned int	nr_folios;
+};
+
 static int io_sqe_buffer_register(struct io_ring_ctx *ctx, struct iovec *iov,
 				  struct io_mapped_ubuf **pimu,
 				  struct page **last_hpage);
@@ -141,14 +151,20 @@ static void io_buffer_unmap(struct io_ring_ctx *ctx, struct io_mapped_ubuf **slo
 	struct io_mapped_ubuf *imu = *slot;
 	unsigned int i;
 
-	if (imu != ctx->dummy_ubuf) {
-		for (i = 0; i < imu->nr_bvecs; i++)
-			unpin_user_page(imu->bvec[i].bv_page);
+	*slot = NULL;
+	if (imu == ctx->dummy_ubuf)
+		return;
+	/* may still be in use by a ring it was cloned into */
+	if (refcount_dec_and_test(&imu->refs)) {
+		if (imu->release)
+			imu->release(imu->priv);
+		else
+			for (i = 0; i < imu->nr_bvecs; i++)
+				unpin_user_page(imu->bvec[i].bv_page);
 		if (imu->acct_pages)
 			io_unaccount_mem(ctx, imu->acct_pages);
 		kvfree(imu);
 	}
-	*slot = NULL;
 }
 
 void io_rsrc_refs_refill(struct io_ring_ctx *ctx)
@@ -1183,13 +1199,96 @@ struct page **io_pin_pages(unsigned long ubuf, unsigned long len, int *npages)
 	return pages;
 }
 
+/*
+ * Check if the pinned pages can be described by one bvec per folio. That
+ * requires all folios to be the same size, the pages within each to be
+ * contiguous, and every folio but the first to be used from its start and
+ * every folio but the last up to its end.
+ */
+static bool io_check_coalesce_buffer(struct page **pages, int nr_pages,
+				     struct io_imu_folio_data *data)
+{
+	struct folio *folio = page_folio(pages[0]);
+	unsigned int count = 1, nr_folios = 1;
+	int i;
+
+	if (nr_pages <= 1 || folio_nr_pages(folio) == 1)
+		return false;
+
+	data->nr_pages_mid = folio_nr_pages(folio);
+	data->folio_shift = folio_shift(folio);
+
+	for (i = 1; i < nr_pages; i++) {
+		if (page_folio(pages[i]) == folio &&
+		    pages[i] == nth_page(pages[i - 1], 1)) {
+			count++;
+			continue;
+		}
+
+		if (nr_folios == 1) {
+			if (folio_page_idx(folio, pages[0]) + count !=
+			    data->nr_pages_mid)
+				return false;
+			data->nr_pages_head = count;
+		} else if (count != data->nr_pages_mid) {
+			return false;
+		}
+
+		folio = page_folio(pages[i]);
+		if (folio_size(folio) != (1UL << data->folio_shift) ||
+		    folio_page_idx(folio, pages[i]) != 0)
+			return false;
+
+		count = 1;
+		nr_folios++;
+	}
+	if (nr_folios == 1)
+		data->nr_pages_head = count;
+
+	data->nr_folios = nr_folios;
+	return true;
+}
+
+/*
+ * Fill @imu with one bvec per folio. Each folio keeps the pin of the first
+ * page we use from it, the pins of the others are dropped again.
+ */
+static void io_coalesce_buffer(struct io_mapped_ubuf *imu, struct page **pages,
+			       struct io_imu_folio_data *data,
+			       unsigned long off, size_t size)
+{
+	unsigned int i, j = 0;
+
+	off += folio_page_idx(page_folio(pages[0]), pages[0]) << PAGE_SHIFT;
+	for (i = 0; i < data->nr_folios; i++) {
+		unsigned int nr = i ? data->nr_pages_mid : data->nr_pages_head;
+		struct folio *folio = page_folio(pages[j]);
+		size_t vec_len;
+
+		if (nr > 1)
+			unpin_user_pages(&pages[j + 1], nr - 1);
+
+		vec_len = min_t(size_t, size, folio_size(folio) - off);
+		imu->bvec[i].bv_page = folio_page(folio, 0);
+		imu->bvec[i].bv_len = vec_len;
+		imu->bvec[i].bv_offset = off;
+		off = 0;
+		size -= vec_len;
+		j += nr;
+	}
+	imu->folio_shift = data->folio_shift;
+	imu->nr_bvecs = data->nr_folios;
+}
+
 static int io_sqe_buffer_register(struct io_ring_ctx *ctx, struct iovec *iov,
 				  struct io_mapped_ubuf **pimu,
 				  struct page **last_hpage)
 {
 	struct io_mapped_ubuf *imu = NULL;
+	struct io_imu_folio_data data;
 	struct page **pages = NULL;
 	unsigned long off;
+	bool coalesce;
 	size_t size;
 	int ret, nr_pages, i;
 
@@ -1206,9 +1305,13 @@ static int io_sqe_buffer_register(struct io_ring_ctx *ctx, struct iovec *iov,
 		goto done;
 	}
 
-	imu = kvmalloc(struct_size(imu, bvec, nr_pages), GFP_KERNEL);
-	if (!imu)
+	coalesce = io_check_coalesce_buffer(pages, nr_pages, &data);
+	imu = kvmalloc(struct_size(imu, bvec, coalesce ? data.nr_folios : nr_pages),
+		       GFP_KERNEL);
+	if (!imu) {
+		unpin_user_pages(pages, nr_pages);
 		goto done;
+	}
 
 	ret = io_buffer_account_pin(ctx, pages, nr_pages, imu, last_hpage);
 	if (ret) {
@@ -1218,20 +1321,28 @@ static int io_sqe_buffer_register(struct io_ring_ctx *ctx, struct iovec *iov,
 
 	off = (unsigned long) iov->iov_base & ~PAGE_MASK;
 	size = iov->iov_len;
-	for (i = 0; i < nr_pages; i++) {
-		size_t vec_len;
-
-		vec_len = min_t(size_t, size, PAGE_SIZE - off);
-		imu->bvec[i].bv_page = pages[i];
-		imu->bvec[i].bv_len = vec_len;
-		imu->bvec[i].bv_offset = off;
-		off = 0;
-		size -= vec_len;
-	}
+	refcount_set(&imu->refs, 1);
+	imu->release = NULL;
+	imu->dir = (1 << READ) | (1 << WRITE);
 	/* store original address for later verification */
 	imu->ubuf = (unsigned long) iov->iov_base;
 	imu->ubuf_end = imu->ubuf + iov->iov_len;
-	imu->nr_bvecs = nr_pages;
+	if (coalesce) {
+		io_coalesce_buffer(imu, pages, &data, off, size);
+	} else {
+		for (i = 0; i < nr_pages; i++) {
+			size_t vec_len;
+
+			vec_len = min_t(size_t, size, PAGE_SIZE - off);
+			imu->bvec[i].bv_page = pages[i];
+			imu->bvec[i].bv_len = vec_len;
+			imu->bvec[i].bv_offset = off;
+			off = 0;
+			size -= vec_len;
+		}
+		imu->folio_shift = PAGE_SHIFT;
+		imu->nr_bvecs = nr_pages;
+	}
 	*pimu = imu;
 	ret = 0;
 done:
@@ -1306,6 +1417,114 @@ int io_sqe_buffers_register(struct io_ring_ctx *ctx, void __user *arg,
 	return ret;
 }
 
+static void lock_two_rings(struct io_ring_ctx *ctx1, struct io_ring_ctx *ctx2)
+{
+	if (ctx1 > ctx2)
+		swap(ctx1, ctx2);
+	mutex_lock(&ctx1->uring_lock);
+	mutex_lock_nested(&ctx2->uring_lock, SINGLE_DEPTH_NESTING);
+}
+
+static int io_clone_buffers(struct io_ring_ctx *ctx, struct io_ring_ctx *src_ctx,
+			    struct io_uring_clone_buffers *arg)
+	__must_hold(&ctx->uring_lock)
+	__must_hold(&src_ctx->uring_lock)
+{
+	struct io_rsrc_data *data;
+	unsigned int nr, end, i;
+	int ret;
+
+	if (ctx->user_bufs)
+		return -EBUSY;
+	if (!src_ctx->nr_user_bufs)
+		return -ENXIO;
+	/* the last ring to drop a buffer unaccounts it */
+	if (src_ctx->user != ctx->user || src_ctx->mm_account != ctx->mm_account)
+		return -EPERM;
+	if (arg->src_off > src_ctx->nr_user_bufs)
+		return -EINVAL;
+
+	nr = arg->nr ?: src_ctx->nr_user_bufs - arg->src_off;
+	if (!nr || check_add_overflow(arg->src_off, nr, &end) ||
+	    end > src_ctx->nr_user_bufs)
+		return -EINVAL;
+	if (check_add_overflow(arg->dst_off, nr, &end) ||
+	    end > IORING_MAX_REG_BUFFERS)
+		return -EINVAL;
+
+	ret = io_rsrc_node_switch_start(ctx);
+	if (ret)
+		return ret;
+	ret = io_rsrc_data_alloc(ctx, io_rsrc_buf_put, NULL, end, &data);
+	if (ret)
+		return ret;
+	ret = io_buffers_map_alloc(ctx, end);
+	if (ret) {
+		io_rsrc_data_free(data);
+		return ret;
+	}
+
+	for (i = 0; i < end; i++) {
+		struct io_mapped_ubuf *imu = src_ctx->dummy_ubuf;
+
+		if (i >= arg->dst_off)
+			imu = src_ctx->user_bufs[arg->src_off + i - arg->dst_off];
+		/* lent kernel pages belong to the source ring's server */
+		if (imu == src_ctx->dummy_ubuf || imu->release) {
+			ctx->user_bufs[i] = ctx->dummy_ubuf;
+		} else {
+			refcount_inc(&imu->refs);
+			ctx->user_bufs[i] = imu;
+		}
+	}
+
+	WARN_ON_ONCE(ctx->buf_data);
+	ctx->buf_data = data;
+	ctx->nr_user_bufs = end;
+	io_rsrc_node_switch(ctx, NULL);
+	return 0;
+}
+
+/*
+ * Share a range of another ring's registered buffers with this ring. The
+ * pages stay pinned once and are released when the last ring that has them
+ * registered drops them, so rings serving the same memory can start up
+ * without pinning and mapping it all again.
+ */
+int io_register_clone_buffers(struct io_ring_ctx *ctx, void __user *arg)
+	__must_hold(&ctx->uring_lock)
+{
+	struct io_uring_clone_buffers buf;
+	struct io_ring_ctx *src_ctx;
+	struct file *file;
+	int ret;
+
+	if (copy_from_user(&buf, arg, sizeof(buf)))
+		return -EFAULT;
+	if (buf.flags || memchr_inv(buf.pad, 0, sizeof(buf.pad)))
+		return -EINVAL;
+
+	file = fget(buf.src_fd);
+	if (!file)
+		return -EBADF;
+	if (!io_is_uring_fops(file)) {
+		fput(file);
+		return -EBADF;
+	}
+	src_ctx = file->private_data;
+	if (src_ctx == ctx) {
+		fput(file);
+		return -EINVAL;
+	}
+
+	mutex_unlock(&ctx->uring_lock);
+	lock_two_rings(ctx, src_ctx);
+	ret = io_clone_buffers(ctx, src_ctx, &buf);
+	mutex_unlock(&src_ctx->uring_lock);
+	fput(file);
+	return ret;
+}
+
 int io_import_fixed(int ddir, struct iov_iter *iter,
 			   struct io_mapped_ubuf *imu,
 			   u64 buf_addr, size_t len)
@@ -1320,6 +1539,9 @@ int io_import_fixed(int ddir, struct iov_iter *iter,
 	/* not inside the mapped region */
 	if (unlikely(buf_addr < imu->ubuf || buf_end > imu->ubuf_end))
 		return -EFAULT;
+	/* a driver's pages may only move the way its request does */
+	if (unlikely(!(imu->dir & (1 << ddir))))
+		return -EFAULT;
 
 	/*
 	 * May not be a start of buffer, set size appropriately
@@ -1328,6 +1550,12 @@ int io_import_fixed(int ddir, struct iov_iter *iter,
 	offset = buf_addr - imu->ubuf;
 	iov_iter_bvec(iter, ddir, imu->bvec, imu->nr_bvecs, offset + len);
 
+	/* the bvecs of a block request needn't be of uniform size */
+	if (offset && imu->release) {
+		iov_iter_advance(iter, offset);
+		return 0;
+	}
+
 	if (offset) {
 		/*
 		 * Don't use iov_iter_advance() here, as it's really slow for
@@ -1336,8 +1564,9 @@ int io_import_fixed(int ddir, struct iov_iter *iter,
 		 * we know that:
 		 *
 		 * 1) it's a BVEC iter, we set it up
-		 * 2) all bvecs are PAGE_SIZE in size, except potentially the
-		 *    first and last bvec
+		 * 2) all bvecs are the same size (PAGE_SIZE, or the folio
+		 *    size if the buffer was coalesced), except potentially
+		 *    the first and last bvec
 		 *
 		 * So just find our index, and adjust the iterator afterwards.
 		 * If the offset is within the first bvec (or the whole first
@@ -1354,14 +1583,129 @@ int io_import_fixed(int ddir, struct iov_iter *iter,
 
 			/* skip first vec */
 			offset -= bvec->bv_len;
-			seg_skip = 1 + (offset >> PAGE_SHIFT);
+			seg_skip = 1 + (offset >> imu->folio_shift);
 
 			iter->bvec = bvec + seg_skip;
 			iter->nr_segs -= seg_skip;
 			iter->count -= bvec->bv_len + offset;
-			iter->iov_offset = offset & ~PAGE_MASK;
+			iter->iov_offset = offset & ((1UL << imu->folio_shift) - 1);
 		}
 	}
 
 	return 0;
 }
+
+/**
+ * io_buffer_register_bvec - lend the pages of a block request to a ring
+ * @cmd: uring_cmd the request is being registered from
+ * @rq: the request whose data pages become the buffer
+ * @release: called with @rq once the buffer is no longer in use
+ * @index: slot in the ring's registered buffer table, must be empty
+ * @issue_flags: issue flags of @cmd
+ *
+ * Makes the data of @rq available to READ_FIXED/WRITE_FIXED style requests
+ * at buffer @index without copying it. The buffer starts at address 0 and
+ * may only be used in the direction matching @rq: a write request's pages
+ * can be written out from, a read request's pages can be read into.
+ */
+int io_buffer_register_bvec(struct io_uring_cmd *cmd, struct request *rq,
+			    void (*release)(void *), unsigned int index,
+			    unsigned int issue_flags)
+{
+	struct io_ring_ctx *ctx = cmd_to_io_kiocb(cmd)->ctx;
+	struct req_iterator rq_iter;
+	struct io_mapped_ubuf *imu;
+	struct bio_vec bv, *bvec;
+	unsigned int nr_bvecs = 0;
+	int ret = 0;
+
+	io_ring_submit_lock(ctx, issue_flags);
+	if (!ctx->buf_data) {
+		ret = -ENXIO;
+		goto unlock;
+	}
+	if (index >= ctx->nr_user_bufs) {
+		ret = -EINVAL;
+		goto unlock;
+	}
+	index = array_index_nospec(index, ctx->nr_user_bufs);
+	if (ctx->user_bufs[index] != ctx->dummy_ubuf) {
+		ret = -EBUSY;
+		goto unlock;
+	}
+
+	rq_for_each_bvec(bv, rq, rq_iter)
+		nr_bvecs++;
+	imu = kvmalloc(struct_size(imu, bvec, nr_bvecs), GFP_KERNEL);
+	if (!imu) {
+		ret = -ENOMEM;
+		goto unlock;
+	}
+
+	bvec = imu->bvec;
+	rq_for_each_bvec(bv, rq, rq_iter)
+		*bvec++ = bv;
+
+	imu->ubuf = 0;
+	imu->ubuf_end = blk_rq_bytes(rq);
+	imu->nr_bvecs = nr_bvecs;
+	imu->folio_shift = PAGE_SHIFT;
+	refcount_set(&imu->refs, 1);
+	imu->acct_pages = 0;
+	imu->release = release;
+	imu->priv = rq;
+	imu->dir = 1 << rq_data_dir(rq);
+
+	ctx->user_bufs[index] = imu;
+	*io_get_tag_slot(ctx->buf_data, index) = 0;
+unlock:
+	io_ring_submit_unlock(ctx, issue_flags);
+	return ret;
+}
+EXPORT_SYMBOL_GPL(io_buffer_register_bvec);
+
+/**
+ * io_buffer_unregister_bvec - drop a buffer added by io_buffer_register_bvec()
+ * @cmd: uring_cmd the buffer is being unregistered from
+ * @index: slot in the ring's registered buffer table
+ * @issue_flags: issue flags of @cmd
+ *
+ * Empties slot @index. The release callback runs once requests still using
+ * the buffer have finished with it.
+ */
+int io_buffer_unregister_bvec(struct io_uring_cmd *cmd, unsigned int index,
+			      unsigned int issue_flags)
+{
+	struct io_ring_ctx *ctx = cmd_to_io_kiocb(cmd)->ctx;
+	struct io_mapped_ubuf *imu;
+	int ret;
+
+	io_ring_submit_lock(ctx, issue_flags);
+	if (!ctx->buf_data) {
+		ret = -ENXIO;
+		goto unlock;
+	}
+	if (index >= ctx->nr_user_bufs) {
+		ret = -EINVAL;
+		goto unlock;
+	}
+	index = array_index_nospec(index, ctx->nr_user_bufs);
+	imu = ctx->user_bufs[index];
+	if (imu == ctx->dummy_ubuf || !imu->release) {
+		ret = -EINVAL;
+		goto unlock;
+	}
+
+	ret = io_rsrc_node_switch_start(ctx);
+	if (ret)
+		goto unlock;
+	ret = io_queue_rsrc_removal(ctx->buf_data, index, ctx->rsrc_node, imu);
+	if (ret)
+		goto unlock;
+	ctx->user_bufs[index] = ctx->dummy_ubuf;
+	io_rsrc_node_switch(ctx, ctx->buf_data);
+unlock:
+	io_ring_submit_unlock(ctx, issue_flags);
+	return ret;
+}
+EXPORT_SYMBOL_GPL(io_buffer_unregister_bvec);
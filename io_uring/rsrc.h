@@ -49,7 +49,16 @@ struct io_mapped_ubuf {
 	u64		ubuf;
 	u64		ubuf_end;
 	unsigned int	nr_bvecs;
+	/* size of each bvec but the first and last, PAGE_SHIFT or a folio's */
+	unsigned int	folio_shift;
+	/* one per ring that has this buffer registered */
+	refcount_t	refs;
 	unsigned long	acct_pages;
+	/* set for kernel pages lent by a driver, see io_buffer_register_bvec() */
+	void		(*release)(void *);
+	void		*priv;
+	/* directions the buffer may be imported for, 1 << READ/WRITE */
+	u8		dir;
 	struct bio_vec	bvec[];
 };
 
@@ -72,6 +81,7 @@ void __io_sqe_buffers_unregister(struct io_ring_ctx *ctx);
 int io_sqe_buffers_unregister(struct io_ring_ctx *ctx);
 int io_sqe_buffers_register(struct io_ring_ctx *ctx, void __user *arg,
 			    unsigned int nr_args, u64 __user *tags);
+int io_register_clone_buffers(struct io_ring_ctx *ctx, void __user *arg);
 void __io_sqe_files_unregister(struct io_ring_ctx *ctx);
 int io_sqe_files_unregister(struct io_ring_ctx *ctx);
 int io_sqe_files_register(struct io_ring_ctx *ctx, void __user *arg,
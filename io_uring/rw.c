@@ -840,6 +840,121 @@ int io_read(struct io_kiocb *req, unsigned int issue_flags)
 	return kiocb_done(req, ret, issue_flags);
 }
 
+int io_read_mshot_prep(struct io_kiocb *req, const struct io_uring_sqe *sqe)
+{
+	struct io_rw *rw = io_kiocb_to_cmd(req, struct io_rw);
+	int ret;
+
+	/* must be used with provided buffers */
+	if (!(req->flags & REQ_F_BUFFER_SELECT))
+		return -EINVAL;
+
+	ret = io_prep_rw(req, sqe);
+	if (unlikely(ret))
+		return ret;
+
+	/* buffer address and size come from the selected buffer */
+	if (rw->addr || rw->len)
+		return -EINVAL;
+
+	req->flags |= REQ_F_APOLL_MULTISHOT;
+	return 0;
+}
+
+/*
+ * Multishot read. Keeps reading into provided buffers and posting a CQE with
+ * IORING_CQE_F_MORE set for each chunk, until the file runs dry. At that
+ * point poll is (re)armed and takes over, and we get called again when more
+ * data is available. The request is terminated on EOF, error, running out
+ * of buffers or if a CQE can't be posted.
+ */
+int io_read_mshot(struct io_kiocb *req, unsigned int issue_flags)
+{
+	struct io_rw *rw = io_kiocb_to_cmd(req, struct io_rw);
+	struct io_rw_state __s, *s = &__s;
+	struct kiocb *kiocb = &rw->kiocb;
+	struct io_ring_ctx *ctx = req->ctx;
+	unsigned int lock_flags = issue_flags;
+	unsigned int cflags = 0;
+	struct iovec *iovec;
+	loff_t *ppos;
+	ssize_t ret;
+
+	/* we rely on poll to retry, so the file must be pollable */
+	if (!file_can_poll(req->file))
+		return -EBADFD;
+
+	ret = io_rw_init_file(req, FMODE_READ);
+	if (unlikely(ret))
+		return ret;
+
+	/* reads must never block, waiting for data is left to poll */
+	if (!io_file_supports_nowait(req))
+		return -EBADFD;
+	kiocb->ki_flags |= IOCB_NOWAIT;
+
+	/*
+	 * io-wq doesn't hold uring_lock. Grab it for the duration, so that a
+	 * selected ring buffer isn't committed until the read is done, and the
+	 * buffer group gets restored when the buffer is put.
+	 */
+	io_ring_submit_lock(ctx, lock_flags);
+	issue_flags &= ~IO_URING_F_UNLOCKED;
+
+retry_multishot:
+	ret = io_import_iovec(READ, req, &iovec, s, issue_flags);
+	if (unlikely(ret < 0))
+		goto done;
+
+	ppos = io_kiocb_update_pos(req);
+	ret = rw_verify_area(READ, req->file, ppos, iov_iter_count(&s->iter));
+	if (likely(!ret))
+		ret = io_iter_do_read(rw, &s->iter);
+
+	if (ret == -EAGAIN) {
+		/* reset the length, so the next buffer isn't clamped by this one */
+		io_kbuf_recycle(req, issue_flags);
+		rw->len = 0;
+		if (issue_flags & IO_URING_F_MULTISHOT)
+			ret = IOU_ISSUE_SKIP_COMPLETE;
+		goto out_unlock;
+	}
+
+	if (ret <= 0) {
+		io_kbuf_recycle(req, issue_flags);
+		goto done;
+	}
+
+	if (req->flags & REQ_F_CUR_POS)
+		req->file->f_pos = kiocb->ki_pos;
+	cflags = io_put_kbuf(req, issue_flags);
+	rw->len = 0;
+
+	if (io_post_aux_cqe(ctx, req->cqe.user_data, ret,
+			    cflags | IORING_CQE_F_MORE, false))
+		goto retry_multishot;
+
+	/*
+	 * Failed to post the CQE, stop multishot and use this result to
+	 * terminate the request.
+	 */
+done:
+	if (ret < 0) {
+		if (ret == -ERESTARTSYS)
+			ret = -EINTR;
+		req_set_fail(req);
+	}
+	io_req_set_res(req, ret, cflags);
+
+	if (issue_flags & IO_URING_F_MULTISHOT)
+		ret = IOU_STOP_MULTISHOT;
+	else
+		ret = IOU_OK;
+out_unlock:
+	io_ring_submit_unlock(ctx, lock_flags);
+	return ret;
+}
+
 int io_write(struct io_kiocb *req, unsigned int issue_flags)
 {
 	struct io_rw *rw = io_kiocb_to_cmd(req, struct io_rw);
@@ -989,10 +1104,39 @@ void io_rw_fail(struct io_kiocb *req)
 	io_req_set_res(req, res, req->cqe.flags);
 }
 
+/*
+ * The hardware queue a polled block request was issued to, or BLK_QC_T_NONE
+ * if it isn't known. As in iocb_bio_iopoll(), the bio may have completed and
+ * been reused, which at worst makes us poll a queue once more or once less
+ * in this pass.
+ */
+static blk_qc_t io_iopoll_cookie(struct io_kiocb *req)
+{
+	struct io_rw *rw = io_kiocb_to_cmd(req, struct io_rw);
+	blk_qc_t cookie = BLK_QC_T_NONE;
+	struct bio *bio;
+
+	if (req->opcode == IORING_OP_URING_CMD ||
+	    req->file->f_op->iopoll != iocb_bio_iopoll)
+		return BLK_QC_T_NONE;
+
+	rcu_read_lock();
+	bio = READ_ONCE(rw->kiocb.private);
+	if (bio)
+		cookie = READ_ONCE(bio->bi_cookie);
+	rcu_read_unlock();
+
+	return cookie;
+}
+
 int io_do_iopoll(struct io_ring_ctx *ctx, bool force_nonspin)
 {
-	struct io_wq_work_node *pos, *start, *prev;
+	struct io_wq_work_node *pos, *start, *prev, *next;
 	unsigned int poll_flags = BLK_POLL_NOSLEEP;
+	bool multi_queue = ctx->poll_multi_queue;
+	struct io_wq_work_list done;
+	struct file *last_file = NULL;
+	blk_qc_t last_cookie = BLK_QC_T_NONE;
 	DEFINE_IO_COMP_BATCH(iob);
 	int nr_events = 0;
 
@@ -1000,7 +1144,7 @@ int io_do_iopoll(struct io_ring_ctx *ctx, bool force_nonspin)
 	 * Only spin for completions if we don't have multiple devices hanging
 	 * off our complete list.
 	 */
-	if (ctx->poll_multi_queue || force_nonspin)
+	if (multi_queue || force_nonspin)
 		poll_flags |= BLK_POLL_ONESHOT;
 
 	wq_list_for_each(pos, start, &ctx->iopoll_list) {
@@ -1012,9 +1156,26 @@ int io_do_iopoll(struct io_ring_ctx *ctx, bool force_nonspin)
 		 * Move completed and retryable entries to our local lists.
 		 * If we find a request that requires polling, break out
 		 * and complete those lists first, if we have entries there.
+		 * With multiple queues, poll each of them once instead and
+		 * gather everything they have into @iob, so all of it is
+		 * ended and posted as one batch. A request is skipped only if
+		 * the one before it went to the same hardware queue, requests
+		 * whose queue isn't known are always polled.
 		 */
-		if (READ_ONCE(req->iopoll_completed))
-			break;
+		if (READ_ONCE(req->iopoll_completed)) {
+			if (!multi_queue)
+				break;
+			continue;
+		}
+		if (multi_queue) {
+			blk_qc_t cookie = io_iopoll_cookie(req);
+
+			if (cookie != BLK_QC_T_NONE && file == last_file &&
+			    cookie == last_cookie)
+				continue;
+			last_file = file;
+			last_cookie = cookie;
+		}
 
 		if (req->opcode == IORING_OP_URING_CMD) {
 			struct io_uring_cmd *ioucmd;
@@ -1033,23 +1194,43 @@ int io_do_iopoll(struct io_ring_ctx *ctx, bool force_nonspin)
 			poll_flags |= BLK_POLL_ONESHOT;
 
 		/* iopoll may have completed current req */
-		if (!rq_list_empty(iob.req_list) ||
-		    READ_ONCE(req->iopoll_completed))
+		if (!multi_queue && (!rq_list_empty(iob.req_list) ||
+				     READ_ONCE(req->iopoll_completed)))
 			break;
 	}
 
 	if (!rq_list_empty(iob.req_list))
 		iob.complete(&iob);
-	else if (!pos)
+	else if (!pos && !multi_queue)
 		return 0;
 
-	prev = start;
-	wq_list_for_each_resume(pos, prev) {
+	/*
+	 * Reap the run of completions we stopped at or, with multiple queues,
+	 * every completed request on the list since they finish out of order.
+	 */
+	INIT_WQ_LIST(&done);
+	if (multi_queue) {
+		pos = ctx->iopoll_list.first;
+		prev = NULL;
+	} else {
+		prev = start;
+	}
+	while (pos) {
 		struct io_kiocb *req = container_of(pos, struct io_kiocb, comp_list);
 
+		next = pos->next;
 		/* order with io_complete_rw_iopoll(), e.g. ->result updates */
-		if (!smp_load_acquire(&req->iopoll_completed))
-			break;
+		if (!smp_load_acquire(&req->iopoll_completed)) {
+			if (!multi_queue)
+				break;
+			prev = pos;
+			pos = next;
+			continue;
+		}
+		wq_list_del(&ctx->iopoll_list, pos, prev);
+		wq_list_add_tail(pos, &done);
+		pos = next;
+
 		nr_events++;
 		if (unlikely(req->flags & REQ_F_CQE_SKIP))
 			continue;
@@ -1067,8 +1248,6 @@ int io_do_iopoll(struct io_ring_ctx *ctx, bool force_nonspin)
 
 	io_commit_cqring(ctx);
 	io_cqring_ev_posted_iopoll(ctx);
-	pos = start ? start->next : ctx->iopoll_list.first;
-	wq_list_cut(&ctx->iopoll_list, prev, start);
-	io_free_batch_list(ctx, pos);
+	io_free_batch_list(ctx, done.first);
 	return nr_events;
 }
@@ -11,14 +11,23 @@
 #include <linux/audit.h>
 #include <linux/security.h>
 #include <linux/io_uring.h>
+#include <linux/sched/clock.h>
 
 #include <uapi/linux/io_uring.h>
 
 #include "io_uring.h"
 #include "sqpoll.h"
+#include "napi.h"
 
 #define IORING_SQPOLL_CAP_ENTRIES_VALUE 8
 
+/*
+ * Time credit each ring sharing an SQPOLL thread gets per pass. A ring that
+ * overruns its credit goes into debt and is skipped until it has paid it off,
+ * so one ring doing expensive inline issue can't starve the others.
+ */
+#define IORING_SQPOLL_QUANTUM_NS	(50 * NSEC_PER_USEC)
+
 enum {
 	IO_SQ_THREAD_SHOULD_STOP = 0,
 	IO_SQ_THREAD_SHOULD_PARK,
@@ -82,6 +91,9 @@ static __cold void io_sqd_update_thread_idle(struct io_sq_data *sqd)
 	list_for_each_entry(ctx, &sqd->ctx_list, sqd_list)
 		sq_thread_idle = max(sq_thread_idle, ctx->sq_thread_idle);
 	sqd->sq_thread_idle = sq_thread_idle;
+	sqd->sq_thread_idle_cur = sq_thread_idle;
+	sqd->idle_gap_ns = 0;
+	sqd->idle_since = 0;
 }
 
 void io_sq_thread_finish(struct io_ring_ctx *ctx)
@@ -192,6 +204,8 @@ static int __io_sq_thread(struct io_ring_ctx *ctx, bool cap_entries)
 		    !(ctx->flags & IORING_SETUP_R_DISABLED))
 			ret = io_submit_sqes(ctx, to_submit);
 		mutex_unlock(&ctx->uring_lock);
+		if (ret > 0)
+			ctx->sq_submitted += ret;
 
 		if (to_submit && wq_has_sleeper(&ctx->sqo_sq_wait))
 			wake_up(&ctx->sqo_sq_wait);
@@ -199,9 +213,66 @@ static int __io_sq_thread(struct io_ring_ctx *ctx, bool cap_entries)
 			revert_creds(creds);
 	}
 
+	if (io_napi(ctx))
+		ret += io_napi_sqpoll_busy_poll(ctx);
+
 	return ret;
 }
 
+/*
+ * Deficit round robin over the rings sharing the thread. Returns false if
+ * @ctx has work but has used up its share of the thread for now.
+ */
+static bool io_sq_ring_may_run(struct io_ring_ctx *ctx)
+{
+	if (!io_sqring_entries(ctx) && wq_list_empty(&ctx->iopoll_list)) {
+		/* idle rings don't bank credit, but do keep their debt */
+		ctx->sq_deficit = min_t(s64, ctx->sq_deficit, 0);
+		return true;
+	}
+
+	ctx->sq_deficit = min_t(s64, ctx->sq_deficit + IORING_SQPOLL_QUANTUM_NS,
+				IORING_SQPOLL_QUANTUM_NS);
+	return ctx->sq_deficit > 0;
+}
+
+/*
+ * Track the gaps between bursts of work and spin for about twice the
+ * average gap before going to sleep, bounded by the configured
+ * sq_thread_idle. If work usually arrives later than that, spinning is
+ * wasted and we go to sleep as soon as possible.
+ */
+static void io_sqd_update_idle(struct io_sq_data *sqd, bool busy)
+{
+	u64 now = local_clock(), max_ns, gap;
+	unsigned long idle;
+
+	if (!busy) {
+		if (!sqd->idle_since)
+			sqd->idle_since = now;
+		return;
+	}
+	if (!sqd->idle_since)
+		return;
+
+	gap = now - sqd->idle_since;
+	sqd->idle_since = 0;
+	if (sqd->idle_gap_ns)
+		sqd->idle_gap_ns = sqd->idle_gap_ns - (sqd->idle_gap_ns >> 3) +
+				   (gap >> 3);
+	else
+		sqd->idle_gap_ns = gap;
+
+	max_ns = jiffies_to_nsecs(sqd->sq_thread_idle);
+	if (sqd->idle_gap_ns > max_ns)
+		idle = 1;
+	else
+		idle = clamp_t(unsigned long,
+			       nsecs_to_jiffies(2 * sqd->idle_gap_ns) + 1,
+			       1, sqd->sq_thread_idle);
+	sqd->sq_thread_idle_cur = idle;
+}
+
 static bool io_sqd_handle_event(struct io_sq_data *sqd)
 {
 	bool did_sig = false;
@@ -242,23 +313,41 @@ static int io_sq_thread(void *data)
 		if (io_sqd_events_pending(sqd) || signal_pending(current)) {
 			if (io_sqd_handle_event(sqd))
 				break;
-			timeout = jiffies + sqd->sq_thread_idle;
+			timeout = jiffies + sqd->sq_thread_idle_cur;
 		}
 
 		cap_entries = !list_is_singular(&sqd->ctx_list);
 		list_for_each_entry(ctx, &sqd->ctx_list, sqd_list) {
-			int ret = __io_sq_thread(ctx, cap_entries);
+			u64 start;
+			int ret;
+
+			if (cap_entries && !io_sq_ring_may_run(ctx)) {
+				/* still has work queued, keep spinning */
+				sqt_spin = true;
+				continue;
+			}
+
+			start = local_clock();
+			ret = __io_sq_thread(ctx, cap_entries);
+			start = local_clock() - start;
+			ctx->sq_work_time += start;
+			if (cap_entries)
+				ctx->sq_deficit -= start;
 
 			if (!sqt_spin && (ret > 0 || !wq_list_empty(&ctx->iopoll_list)))
 				sqt_spin = true;
 		}
+		/* don't let the same ring always go first */
+		if (cap_entries)
+			list_rotate_left(&sqd->ctx_list);
 		if (io_run_task_work())
 			sqt_spin = true;
 
+		io_sqd_update_idle(sqd, sqt_spin);
 		if (sqt_spin || !time_after(jiffies, timeout)) {
 			cond_resched();
 			if (sqt_spin)
-				timeout = jiffies + sqd->sq_thread_idle;
+				timeout = jiffies + sqd->sq_thread_idle_cur;
 			continue;
 		}
 
@@ -298,7 +387,7 @@ static int io_sq_thread(void *data)
 		}
 
 		finish_wait(&sqd->wait, &wait);
-		timeout = jiffies + sqd->sq_thread_idle;
+		timeout = jiffies + sqd->sq_thread_idle_cur;
 	}
 
 	io_uring_cancel_generic(true, sqd);
@@ -12,6 +12,10 @@ struct io_sq_data {
 	struct wait_queue_head	wait;
 
 	unsigned		sq_thread_idle;
+	/* adaptive idle period, never above sq_thread_idle */
+	unsigned		sq_thread_idle_cur;
+	u64			idle_gap_ns;
+	u64			idle_since;
 	int			sq_cpu;
 	pid_t			task_pid;
 	pid_t			task_tgid;
@@ -2062,7 +2062,7 @@ static inline void enqueue_task(struct rq *rq, struct task_struct *p, int flags)
 		update_rq_clock(rq);
 
 	if (!(flags & ENQUEUE_RESTORE)) {
-		sched_info_enqueue(rq, p);
+		sched_info_enqueue(rq, p, flags & ENQUEUE_WAKEUP);
 		psi_enqueue(p, (flags & ENQUEUE_WAKEUP) && !(flags & ENQUEUE_MIGRATED));
 	}
 
@@ -3620,6 +3620,8 @@ ttwu_stat(struct task_struct *p, int cpu, int wake_flags)
 		struct sched_domain *sd;
 
 		__schedstat_inc(p->stats.nr_wakeups_remote);
+		if (!cpus_share_l3(rq->cpu, cpu))
+			__schedstat_inc(rq->ttwu_cross_l3);
 		rcu_read_lock();
 		for_each_domain(rq->cpu, sd) {
 			if (cpumask_test_cpu(cpu, sched_domain_span(sd))) {
@@ -4381,17 +4383,46 @@ int wake_up_state(struct task_struct *p, unsigned int state)
 }
 
 #ifdef CONFIG_SCHED_BORE
-static inline void sched_fork_update_prev_burst(struct task_struct *p)
+/*
+ * Average the smoothed burst time of @p's children. Called with
+ * tasklist_lock held for reading by @p itself, which is the only
+ * writer of the cache.
+ */
+static void update_child_burst_cache(struct task_struct *p, u64 now)
 {
-	struct task_struct *sib;
+	struct task_struct *child;
 	u32 cnt = 0;
-	u64 sum = 0, avg = 0;
-	list_for_each_entry(sib, &p->sibling, sibling) {
+	u64 sum = 0;
+
+	list_for_each_entry(child, &p->children, sibling) {
 		cnt++;
-		sum += sib->se.prev_burst_time >> 8;
+		sum += child->se.prev_burst_time;
 	}
-	if (cnt) avg = do_div(sum, cnt) << 8;
-	if (p->se.prev_burst_time < avg) p->se.prev_burst_time = avg;
+
+	p->se.child_burst = cnt ? div_u64(sum, cnt) : 0;
+	p->se.child_burst_last_cached = now;
+}
+
+/*
+ * A new task has not been linked into its parent's children yet, so it
+ * inherits its burst history from the parent (copied along with the
+ * task_struct) and from its future siblings. The sibling average is
+ * cached for sched_burst_cache_lifetime ns so fork storms such as
+ * make -j don't walk the children list every time.
+ */
+static void sched_fork_update_prev_burst(struct task_struct *p)
+{
+	u64 now = ktime_get_ns();
+	u64 avg;
+
+	read_lock(&tasklist_lock);
+	if (now - current->se.child_burst_last_cached > sched_burst_cache_lifetime)
+		update_child_burst_cache(current, now);
+	avg = current->se.child_burst;
+	read_unlock(&tasklist_lock);
+
+	if (p->se.prev_burst_time < avg)
+		p->se.prev_burst_time = avg;
 }
 #endif // CONFIG_SCHED_BORE
 
@@ -4418,6 +4449,8 @@ static void __sched_fork(unsigned long clone_flags, struct task_struct *p)
 #endif
 #ifdef CONFIG_SCHED_BORE
 	p->se.burst_time      = 0;
+	p->se.child_burst     = 0;
+	p->se.child_burst_last_cached = 0;
 #endif // CONFIG_SCHED_BORE
 	INIT_LIST_HEAD(&p->se.group_node);
 	RB_CLEAR_NODE(&p->se.latency_node);
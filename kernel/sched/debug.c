@@ -294,6 +294,63 @@ static const struct file_operations sched_debug_fops = {
 	.release	= seq_release,
 };
 
+#ifdef CONFIG_SCHED_LAT_HIST
+static const char * const sched_lat_class_names[NR_SCHED_LAT_CLASSES] = {
+	[SCHED_LAT_DL]		= "dl",
+	[SCHED_LAT_RT]		= "rt",
+	[SCHED_LAT_FAIR]	= "fair",
+	[SCHED_LAT_OTHER]	= "other",
+};
+
+static void sched_lat_hist_print(struct seq_file *m, int cpu, int class,
+				 const char *kind, u64 *hist)
+{
+	int i;
+
+	seq_printf(m, "cpu%d %s %s", cpu, sched_lat_class_names[class], kind);
+	for (i = 0; i < SCHED_LAT_HIST_BUCKETS; i++)
+		seq_printf(m, " %llu", READ_ONCE(hist[i]));
+	seq_puts(m, "\n");
+}
+
+/*
+ * One line per CPU, class and kind, each followed by the counts of the
+ * SCHED_LAT_HIST_BUCKETS log2 buckets: bucket N counts delays of
+ * [2^(N-1), 2^N) ns.
+ */
+static int sched_lat_hist_show(struct seq_file *m, void *v)
+{
+	int cpu, class;
+
+	seq_printf(m, "buckets %d\n", SCHED_LAT_HIST_BUCKETS);
+
+	for_each_online_cpu(cpu) {
+		struct rq *rq = cpu_rq(cpu);
+
+		for (class = 0; class < NR_SCHED_LAT_CLASSES; class++) {
+			struct sched_lat_hist *hist = &rq->lat_hist[class];
+
+			sched_lat_hist_print(m, cpu, class, "wakeup", hist->wakeup);
+			sched_lat_hist_print(m, cpu, class, "wait", hist->wait);
+		}
+	}
+
+	return 0;
+}
+
+static int sched_lat_hist_open(struct inode *inode, struct file *filp)
+{
+	return single_open(filp, sched_lat_hist_show, NULL);
+}
+
+static const struct file_operations sched_lat_hist_fops = {
+	.open		= sched_lat_hist_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+#endif /* CONFIG_SCHED_LAT_HIST */
+
 static struct dentry *debugfs_sched;
 
 static __init int sched_init_debug(void)
@@ -337,6 +394,9 @@ static __init int sched_init_debug(void)
 #endif
 
 	debugfs_create_file("debug", 0444, debugfs_sched, NULL, &sched_debug_fops);
+#ifdef CONFIG_SCHED_LAT_HIST
+	debugfs_create_file("latency_hist", 0444, debugfs_sched, NULL, &sched_lat_hist_fops);
+#endif
 
 	return 0;
 }
@@ -766,6 +826,7 @@ do {									\
 		P(sched_goidle);
 		P(ttwu_count);
 		P(ttwu_local);
+		P(ttwu_cross_l3);
 	}
 #undef P
 
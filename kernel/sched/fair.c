@@ -158,10 +158,11 @@ static unsigned int normalized_sysctl_sched_wakeup_granularity	= 1000000UL;
 const_debug unsigned int sysctl_sched_migration_cost	= 500000UL;
 
 #ifdef CONFIG_SCHED_BORE
-unsigned int __read_mostly sched_bore                = 1;
-unsigned int __read_mostly sched_burst_penalty_scale = 1280;
-unsigned int __read_mostly sched_burst_granularity   = 12;
-unsigned int __read_mostly sched_burst_smoothness    = 1;
+unsigned int __read_mostly sched_bore                 = 3;
+unsigned int __read_mostly sched_burst_penalty_scale  = 1280;
+unsigned int __read_mostly sched_burst_granularity    = 12;
+unsigned int __read_mostly sched_burst_smoothness     = 1;
+unsigned int __read_mostly sched_burst_cache_lifetime = 15000000;
 static int three          = 3;
 static int sixty_four     = 64;
 static int maxval_12_bits = 4095;
@@ -262,6 +263,13 @@ static struct ctl_table sched_fair_sysctls[] = {
 		.extra1		= SYSCTL_ZERO,
 		.extra2		= &three,
 	},
+	{
+		.procname	= "sched_burst_cache_lifetime",
+		.data		= &sched_burst_cache_lifetime,
+		.maxlen		= sizeof(unsigned int),
+		.mode		= 0644,
+		.proc_handler	= proc_douintvec,
+	},
 #endif // CONFIG_SCHED_BORE
 	{
 		.procname       = "sched_child_runs_first",
@@ -869,6 +877,27 @@ static u64 __sched_period(unsigned long nr_running)
 
 static bool sched_idle_cfs_rq(struct cfs_rq *cfs_rq);
 
+/*
+ * Scale the slice of a task by its latency_nice: latency sensitive tasks
+ * get shorter slices and run more often, latency tolerant ones get longer
+ * slices and are preempted less. The factor ranges from 1/2 (latency_nice
+ * -20) to ~3/2 (latency_nice 19); latency_nice 0 leaves the slice as is.
+ */
+static u64 latency_scale_slice(u64 slice, struct sched_entity *se)
+{
+	long weight;
+
+	if (!entity_is_task(se))
+		return slice;
+
+	weight = sched_latency_to_weight[task_of(se)->latency_prio];
+	if (!weight)
+		return slice;
+
+	return mul_u64_u32_shr(slice, NICE_LATENCY_WEIGHT_MAX + weight / 2,
+			       NICE_LATENCY_SHIFT);
+}
+
 /*
  * We calculate the wall-time slice from the period by taking a part
  * proportional to the weight.
@@ -904,6 +933,9 @@ static u64 sched_slice(struct cfs_rq *cfs_rq, struct sched_entity *se)
 		slice = __calc_delta(slice, se->load.weight, load);
 	}
 
+	if (sched_feat(LATENCY_SLICE))
+		slice = latency_scale_slice(slice, init_se);
+
 	if (sched_feat(BASE_SLICE)) {
 		if (se_is_idle(init_se) && !sched_idle_cfs_rq(cfs_rq))
 			min_gran = sysctl_sched_idle_min_granularity;
@@ -7048,6 +7080,7 @@ static int select_idle_cpu(struct task_struct *p, struct sched_domain *sd, bool
 	struct rq *this_rq = this_rq();
 	int this = smp_processor_id();
 	struct sched_domain *this_sd = NULL;
+	struct sched_l3 *l3;
 	u64 time = 0;
 
 	cpumask_and(cpus, sched_domain_span(sd), p->cpus_ptr);
@@ -7095,6 +7128,33 @@ static int select_idle_cpu(struct task_struct *p, struct sched_domain *sd, bool
 		}
 	}
 
+	/*
+	 * When the LLC spans several L3 slices, look for an idle core/CPU in
+	 * the target's own L3 first so that waker and wakee keep sharing it.
+	 */
+	l3 = rcu_dereference(per_cpu(sd_l3, target));
+	if (l3 && sched_l3_split(target)) {
+		struct cpumask *l3_span = sched_l3_span(l3);
+
+		for_each_cpu_wrap(cpu, l3_span, target + 1) {
+			if (!cpumask_test_cpu(cpu, cpus))
+				continue;
+
+			if (has_idle_core) {
+				i = select_idle_core(p, cpu, cpus, &idle_cpu);
+				if ((unsigned int)i < nr_cpumask_bits)
+					return i;
+			} else {
+				if (!--nr)
+					return -1;
+				idle_cpu = __select_idle_cpu(cpu, p);
+				if ((unsigned int)idle_cpu < nr_cpumask_bits)
+					goto out;
+			}
+		}
+		cpumask_andnot(cpus, cpus, l3_span);
+	}
+
 	for_each_cpu_wrap(cpu, cpus, target + 1) {
 		if (has_idle_core) {
 			i = select_idle_core(p, cpu, cpus, &idle_cpu);
@@ -7110,6 +7170,7 @@ static int select_idle_cpu(struct task_struct *p, struct sched_domain *sd, bool
 		}
 	}
 
+out:
 	if (has_idle_core)
 		set_idle_cores(target, false);
 
@@ -7204,7 +7265,7 @@ static int select_idle_sibling(struct task_struct *p, int prev, int target)
 	bool has_idle_core = false;
 	struct sched_domain *sd;
 	unsigned long task_util, util_min, util_max;
-	int i, recent_used_cpu;
+	int i, recent_used_cpu, prev_aff = -1;
 
 	/*
 	 * On asymmetric system, update task utilization because we will check
@@ -7227,12 +7288,18 @@ static int select_idle_sibling(struct task_struct *p, int prev, int target)
 		return target;
 
 	/*
-	 * If the previous CPU is cache affine and idle, don't be stupid:
+	 * If the previous CPU is cache affine and idle, don't be stupid. If
+	 * it only shares the LLC but not the L3 with the target, keep it as a
+	 * fallback in case the target's L3 has no idle CPU.
 	 */
 	if (prev != target && cpus_share_cache(prev, target) &&
 	    (available_idle_cpu(prev) || sched_idle_cpu(prev)) &&
-	    asym_fits_cpu(task_util, util_min, util_max, prev))
-		return prev;
+	    asym_fits_cpu(task_util, util_min, util_max, prev)) {
+		if (!sched_l3_split(target) || cpus_share_l3(prev, target))
+			return prev;
+
+		prev_aff = prev;
+	}
 
 	/*
 	 * Allow a per-cpu kthread to stack with the wakee if the
@@ -7300,6 +7367,9 @@ static int select_idle_sibling(struct task_struct *p, int prev, int target)
 	if ((unsigned)i < nr_cpumask_bits)
 		return i;
 
+	if ((unsigned int)prev_aff < nr_cpumask_bits)
+		return prev_aff;
+
 	return target;
 }
 
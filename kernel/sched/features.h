@@ -105,3 +105,8 @@ SCHED_FEAT(LATENCY_WARN, false)
 
 SCHED_FEAT(ALT_PERIOD, true)
 SCHED_FEAT(BASE_SLICE, true)
+
+/*
+ * Scale the slice of a task by its latency_nice.
+ */
+SCHED_FEAT(LATENCY_SLICE, true)
@@ -957,6 +957,29 @@ struct balance_callback {
 	void (*func)(struct rq *rq);
 };
 
+#ifdef CONFIG_SCHED_LAT_HIST
+/*
+ * log2 histograms of scheduling latency: bucket N counts delays of
+ * [2^(N-1), 2^N) ns, the last bucket also counts everything above.
+ */
+#define SCHED_LAT_HIST_BUCKETS	32
+
+enum sched_lat_class {
+	SCHED_LAT_DL,
+	SCHED_LAT_RT,
+	SCHED_LAT_FAIR,
+	SCHED_LAT_OTHER,
+	NR_SCHED_LAT_CLASSES
+};
+
+struct sched_lat_hist {
+	/* from wakeup to running */
+	u64			wakeup[SCHED_LAT_HIST_BUCKETS];
+	/* from any enqueue (wakeup or preemption) to running */
+	u64			wait[SCHED_LAT_HIST_BUCKETS];
+};
+#endif
+
 /*
  * This is the main, per-CPU runqueue data structure.
  *
@@ -1135,6 +1158,11 @@ struct rq {
 	/* try_to_wake_up() stats */
 	unsigned int		ttwu_count;
 	unsigned int		ttwu_local;
+	unsigned int		ttwu_cross_l3;
+#endif
+
+#ifdef CONFIG_SCHED_LAT_HIST
+	struct sched_lat_hist	lat_hist[NR_SCHED_LAT_CLASSES];
 #endif
 
 #ifdef CONFIG_CPU_IDLE
@@ -1824,6 +1852,9 @@ DECLARE_PER_CPU(struct sched_domain __rcu *, sd_llc);
 DECLARE_PER_CPU(int, sd_llc_size);
 DECLARE_PER_CPU(int, sd_llc_id);
 DECLARE_PER_CPU(struct sched_domain_shared __rcu *, sd_llc_shared);
+DECLARE_PER_CPU(struct sched_l3 __rcu *, sd_l3);
+DECLARE_PER_CPU(int, sd_l3_size);
+DECLARE_PER_CPU(int, sd_l3_id);
 DECLARE_PER_CPU(struct sched_domain __rcu *, sd_numa);
 DECLARE_PER_CPU(struct sched_domain __rcu *, sd_asym_packing);
 DECLARE_PER_CPU(struct sched_domain __rcu *, sd_asym_cpucapacity);
@@ -1834,6 +1865,30 @@ static __always_inline bool sched_asym_cpucap_active(void)
 	return static_branch_unlikely(&sched_asym_cpucapacity);
 }
 
+struct sched_l3 {
+	struct rcu_head		rcu;
+	unsigned long		span[];
+};
+
+static inline struct cpumask *sched_l3_span(struct sched_l3 *l3)
+{
+	return to_cpumask(l3->span);
+}
+
+/* Does @cpu's LLC domain span more than one L3 slice? */
+static inline bool sched_l3_split(int cpu)
+{
+	return per_cpu(sd_l3_size, cpu) < per_cpu(sd_llc_size, cpu);
+}
+
+static inline bool cpus_share_l3(int this_cpu, int that_cpu)
+{
+	if (this_cpu == that_cpu)
+		return true;
+
+	return per_cpu(sd_l3_id, this_cpu) == per_cpu(sd_l3_id, that_cpu);
+}
+
 struct sched_group_capacity {
 	atomic_t		ref;
 	/*
@@ -2129,6 +2184,10 @@ extern const int		sched_prio_to_weight[40];
 extern const u32		sched_prio_to_wmult[40];
 extern const int		sched_latency_to_weight[40];
 
+#ifdef CONFIG_SCHED_BORE
+extern unsigned int sched_burst_cache_lifetime;
+#endif // CONFIG_SCHED_BORE
+
 /*
  * {de,en}queue flags:
  *
@@ -195,6 +195,38 @@ static inline void psi_sched_switch(struct task_struct *prev,
 static inline void psi_account_irqtime(struct task_struct *task, u32 delta) {}
 #endif /* CONFIG_PSI */
 
+#ifdef CONFIG_SCHED_LAT_HIST
+static inline enum sched_lat_class sched_lat_class(struct task_struct *t)
+{
+	if (t->sched_class == &fair_sched_class)
+		return SCHED_LAT_FAIR;
+	if (t->sched_class == &rt_sched_class)
+		return SCHED_LAT_RT;
+	if (t->sched_class == &dl_sched_class)
+		return SCHED_LAT_DL;
+	return SCHED_LAT_OTHER;
+}
+
+/*
+ * Expects runqueue lock to be held for atomicity of update
+ */
+static inline void
+rq_sched_lat_hist(struct rq *rq, struct task_struct *t, unsigned long long delta)
+{
+	struct sched_lat_hist *hist = &rq->lat_hist[sched_lat_class(t)];
+	unsigned int bucket;
+
+	bucket = min_t(unsigned int, fls64(delta), SCHED_LAT_HIST_BUCKETS - 1);
+
+	hist->wait[bucket]++;
+	if (t->sched_info.queued_by_wakeup)
+		hist->wakeup[bucket]++;
+}
+#else
+static inline void
+rq_sched_lat_hist(struct rq *rq, struct task_struct *t, unsigned long long delta) { }
+#endif /* CONFIG_SCHED_LAT_HIST */
+
 #ifdef CONFIG_SCHED_INFO
 /*
  * We are interested in knowing how long it was from the *first* time a
@@ -236,6 +268,7 @@ static void sched_info_arrive(struct rq *rq, struct task_struct *t)
 	t->sched_info.pcount++;
 
 	rq_sched_info_arrive(rq, delta);
+	rq_sched_lat_hist(rq, t, delta);
 }
 
 /*
@@ -243,10 +276,14 @@ static void sched_info_arrive(struct rq *rq, struct task_struct *t)
  * the timestamp if it is already not set.  It's assumed that
  * sched_info_dequeue() will clear that stamp when appropriate.
  */
-static inline void sched_info_enqueue(struct rq *rq, struct task_struct *t)
+static inline void sched_info_enqueue(struct rq *rq, struct task_struct *t, bool wakeup)
 {
-	if (!t->sched_info.last_queued)
+	if (!t->sched_info.last_queued) {
 		t->sched_info.last_queued = rq_clock(rq);
+#ifdef CONFIG_SCHED_LAT_HIST
+		t->sched_info.queued_by_wakeup = wakeup;
+#endif
+	}
 }
 
 /*
@@ -264,7 +301,7 @@ static inline void sched_info_depart(struct rq *rq, struct task_struct *t)
 	rq_sched_info_depart(rq, delta);
 
 	if (task_is_running(t))
-		sched_info_enqueue(rq, t);
+		sched_info_enqueue(rq, t, false);
 }
 
 /*
@@ -288,7 +325,7 @@ sched_info_switch(struct rq *rq, struct task_struct *prev, struct task_struct *n
 }
 
 #else /* !CONFIG_SCHED_INFO: */
-# define sched_info_enqueue(rq, t)	do { } while (0)
+# define sched_info_enqueue(rq, t, wakeup)	do { } while (0)
 # define sched_info_dequeue(rq, t)	do { } while (0)
 # define sched_info_switch(rq, t, next)	do { } while (0)
 #endif /* CONFIG_SCHED_INFO */
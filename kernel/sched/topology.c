@@ -665,6 +665,9 @@ DEFINE_PER_CPU(struct sched_domain __rcu *, sd_llc);
 DEFINE_PER_CPU(int, sd_llc_size);
 DEFINE_PER_CPU(int, sd_llc_id);
 DEFINE_PER_CPU(struct sched_domain_shared __rcu *, sd_llc_shared);
+DEFINE_PER_CPU(struct sched_l3 __rcu *, sd_l3);
+DEFINE_PER_CPU(int, sd_l3_size);
+DEFINE_PER_CPU(int, sd_l3_id);
 DEFINE_PER_CPU(struct sched_domain __rcu *, sd_numa);
 DEFINE_PER_CPU(struct sched_domain __rcu *, sd_asym_packing);
 DEFINE_PER_CPU(struct sched_domain __rcu *, sd_asym_cpucapacity);
@@ -679,6 +682,93 @@ void sched_enable_ipc_classes(void)
 }
 #endif
 
+/*
+ * The LLC domain can span several L3 slices, e.g. when multiple CCX/CCD
+ * sit in one package-level domain. Keep the part of @cpu's LLC domain that
+ * shares its L3 according to cacheinfo, along with a size and ID like for
+ * sd_llc, so that select_idle_sibling() can look there first and
+ * cpus_share_l3() can tell the slices apart.
+ *
+ * Wakeups read the mask locklessly, so a new one is built aside and
+ * published with RCU. We run under rcu_read_lock() from cpu_attach_domain(),
+ * hence GFP_ATOMIC; if that fails the L3 is made to cover the whole LLC,
+ * which turns the split off for @cpu.
+ *
+ * cacheinfo may not be populated yet on the first build; the L3 then
+ * covers the whole LLC until sched_l3_refresh() runs.
+ */
+static void update_l3_domain(int cpu, struct sched_domain *llc)
+{
+	struct cpu_cacheinfo *ci = get_cpu_cacheinfo(cpu);
+	struct sched_l3 *l3, *old;
+	struct cpumask *mask;
+	int i;
+
+	old = rcu_dereference_protected(per_cpu(sd_l3, cpu),
+					lockdep_is_held(&sched_domains_mutex));
+
+	l3 = kzalloc_node(sizeof(*l3) + cpumask_size(), GFP_ATOMIC,
+			  cpu_to_node(cpu));
+	if (!l3) {
+		RCU_INIT_POINTER(per_cpu(sd_l3, cpu), NULL);
+		per_cpu(sd_l3_size, cpu) = per_cpu(sd_llc_size, cpu);
+		per_cpu(sd_l3_id, cpu) = per_cpu(sd_llc_id, cpu);
+		goto free;
+	}
+	mask = sched_l3_span(l3);
+
+	if (!llc) {
+		cpumask_copy(mask, cpumask_of(cpu));
+		goto out;
+	}
+
+	cpumask_copy(mask, sched_domain_span(llc));
+	for (i = 0; i < ci->num_leaves; i++) {
+		struct cacheinfo *leaf = &ci->info_list[i];
+
+		if (leaf->level == 3 && leaf->type == CACHE_TYPE_UNIFIED) {
+			cpumask_and(mask, mask, &leaf->shared_cpu_map);
+			break;
+		}
+	}
+
+	if (!cpumask_test_cpu(cpu, mask))
+		cpumask_copy(mask, sched_domain_span(llc));
+out:
+	per_cpu(sd_l3_size, cpu) = cpumask_weight(mask);
+	per_cpu(sd_l3_id, cpu) = cpumask_first(mask);
+	rcu_assign_pointer(per_cpu(sd_l3, cpu), l3);
+free:
+	if (old)
+		kfree_rcu(old, rcu);
+}
+
+/*
+ * The first domains are built from sched_init_smp(), before cacheinfo is
+ * populated by its device_initcall on most architectures. Recompute the
+ * L3 data once it is there. rebuild_sched_domains() would not do: it keeps
+ * the existing domains when the partition is unchanged.
+ *
+ * CPUs that come up later have cacheinfo before CPUHP_AP_ACTIVE, so their
+ * domains are built with it.
+ */
+static int __init sched_l3_refresh(void)
+{
+	int cpu;
+
+	cpus_read_lock();
+	mutex_lock(&sched_domains_mutex);
+	rcu_read_lock();
+	for_each_online_cpu(cpu)
+		update_l3_domain(cpu, rcu_dereference(per_cpu(sd_llc, cpu)));
+	rcu_read_unlock();
+	mutex_unlock(&sched_domains_mutex);
+	cpus_read_unlock();
+
+	return 0;
+}
+late_initcall(sched_l3_refresh);
+
 static void update_top_cache_domain(int cpu)
 {
 	struct sched_domain_shared *sds = NULL;
@@ -698,6 +788,8 @@ static void update_top_cache_domain(int cpu)
 	per_cpu(sd_llc_id, cpu) = id;
 	rcu_assign_pointer(per_cpu(sd_llc_shared, cpu), sds);
 
+	update_l3_domain(cpu, sd);
+
 	sd = lowest_flag_domain(cpu, SD_NUMA);
 	rcu_assign_pointer(per_cpu(sd_numa, cpu), sd);
 
@@ -2413,6 +2413,28 @@ static int tcp_inq_hint(struct sock *sk)
 	return inq;
 }
 
+#ifdef CONFIG_MMU
+/*
+ * TCP_ZEROCOPY_RECEIVE for in-kernel callers acting on behalf of the current
+ * task, such as io_uring: map whole pages of received data into the
+ * tcp_mmap() area at zc->address.
+ */
+int tcp_zerocopy_receive_sk(struct sock *sk, struct tcp_zerocopy_receive *zc)
+{
+	struct scm_timestamping_internal tss;
+	int ret;
+
+	if (zc->reserved || zc->copybuf_len)
+		return -EINVAL;
+
+	lock_sock(sk);
+	ret = tcp_zerocopy_receive(sk, zc, &tss);
+	release_sock(sk);
+	zc->inq = tcp_inq_hint(sk);
+	return ret;
+}
+#endif
+
 /*
  *	This routine copies from a sock struct into the user buffer.
  *
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Wakeup latency test for latency_nice.
+ *
+ * A set of CPU hogs, a waker and a wakee are pinned to the same CPU. The
+ * waker periodically writes a timestamp into a pipe the wakee is blocked
+ * on, and the wakee records how long it took to get on the CPU. This is
+ * done NR_RUNS times with the wakee at latency_nice -20 and at latency_nice 19
+ * alternately; the median p99 wakeup latency at -20 must not be above the one
+ * at 19 by more than P99_MARGIN_PCT percent.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include "../kselftest.h"
+
+#ifndef SCHED_FLAG_LATENCY_NICE
+#define SCHED_FLAG_LATENCY_NICE	0x80
+#endif
+
+#define NR_HOGS		4
+#define NR_SAMPLES	2000
+#define WAKE_PERIOD_US	500
+#define NR_RUNS		5
+#define P99_MARGIN_PCT	10
+
+struct latnice_attr {
+	uint32_t size;
+	uint32_t sched_policy;
+	uint64_t sched_flags;
+	int32_t  sched_nice;
+	uint32_t sched_priority;
+	uint64_t sched_runtime;
+	uint64_t sched_deadline;
+	uint64_t sched_period;
+	uint32_t sched_util_min;
+	uint32_t sched_util_max;
+	int32_t  sched_latency_nice;
+};
+
+static volatile int stop_hogs;
+static int pipefd[2];
+static uint64_t samples[NR_SAMPLES];
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int set_latency_nice(int latency_nice)
+{
+	struct latnice_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.sched_policy = SCHED_OTHER;
+	attr.sched_flags = SCHED_FLAG_LATENCY_NICE;
+	attr.sched_latency_nice = latency_nice;
+
+	return syscall(__NR_sched_setattr, 0, &attr, 0);
+}
+
+static int get_latency_nice(int *latency_nice)
+{
+	struct latnice_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	if (syscall(__NR_sched_getattr, 0, &attr, sizeof(attr), 0))
+		return -1;
+
+	*latency_nice = attr.sched_latency_nice;
+	return 0;
+}
+
+static void *hog(void *arg)
+{
+	while (!stop_hogs)
+		;
+
+	return NULL;
+}
+
+static void *wakee(void *arg)
+{
+	int latency_nice = *(int *)arg;
+	uint64_t ts;
+	int i;
+
+	if (set_latency_nice(latency_nice))
+		return (void *)(long)errno;
+
+	for (i = 0; i < NR_SAMPLES; i++) {
+		if (read(pipefd[0], &ts, sizeof(ts)) != sizeof(ts))
+			return (void *)(long)EIO;
+		samples[i] = now_ns() - ts;
+	}
+
+	return NULL;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+static uint64_t percentile(int pct)
+{
+	return samples[(NR_SAMPLES - 1) * pct / 100];
+}
+
+static int run_latency(int latency_nice, uint64_t *p99)
+{
+	pthread_t thread;
+	void *ret;
+	uint64_t ts;
+	int i;
+
+	if (pthread_create(&thread, NULL, wakee, &latency_nice))
+		return -1;
+
+	for (i = 0; i < NR_SAMPLES; i++) {
+		usleep(WAKE_PERIOD_US);
+		ts = now_ns();
+		if (write(pipefd[1], &ts, sizeof(ts)) != sizeof(ts))
+			break;
+	}
+
+	pthread_join(thread, &ret);
+	if (ret || i != NR_SAMPLES)
+		return -1;
+
+	qsort(samples, NR_SAMPLES, sizeof(samples[0]), cmp_u64);
+	ksft_print_msg("latency_nice %3d: p50 %8llu ns  p90 %8llu ns  p99 %8llu ns  max %8llu ns\n",
+		       latency_nice,
+		       (unsigned long long)percentile(50),
+		       (unsigned long long)percentile(90),
+		       (unsigned long long)percentile(99),
+		       (unsigned long long)samples[NR_SAMPLES - 1]);
+	*p99 = percentile(99);
+
+	return 0;
+}
+
+static uint64_t median(uint64_t *v, int nr)
+{
+	qsort(v, nr, sizeof(v[0]), cmp_u64);
+	return v[nr / 2];
+}
+
+int main(void)
+{
+	pthread_t hogs[NR_HOGS];
+	uint64_t p99_low[NR_RUNS], p99_high[NR_RUNS];
+	uint64_t med_low, med_high;
+	cpu_set_t cpus;
+	int latency_nice;
+	int err_low = 0, err_high = 0;
+	int i;
+
+	ksft_print_header();
+	ksft_set_plan(4);
+
+	if (set_latency_nice(-20)) {
+		if (errno == EINVAL || errno == E2BIG)
+			ksft_exit_skip("latency_nice not supported\n");
+		if (errno == EPERM || errno == EACCES)
+			ksft_exit_skip("latency_nice -20 needs CAP_SYS_NICE\n");
+		ksft_exit_fail_msg("sched_setattr: %s\n", strerror(errno));
+	}
+
+	if (get_latency_nice(&latency_nice) || latency_nice != -20)
+		ksft_test_result_fail("latency_nice round trip\n");
+	else
+		ksft_test_result_pass("latency_nice round trip\n");
+
+	if (set_latency_nice(0))
+		ksft_exit_fail_msg("sched_setattr: %s\n", strerror(errno));
+
+	/* Everything competes for the same CPU */
+	CPU_ZERO(&cpus);
+	CPU_SET(sched_getcpu(), &cpus);
+	if (sched_setaffinity(0, sizeof(cpus), &cpus))
+		ksft_exit_fail_msg("sched_setaffinity: %s\n", strerror(errno));
+
+	if (pipe(pipefd))
+		ksft_exit_fail_msg("pipe: %s\n", strerror(errno));
+
+	for (i = 0; i < NR_HOGS; i++) {
+		if (pthread_create(&hogs[i], NULL, hog, NULL))
+			ksft_exit_fail_msg("pthread_create failed\n");
+	}
+
+	/* Alternate the two settings so that noise hits both alike */
+	for (i = 0; i < NR_RUNS; i++) {
+		err_low |= run_latency(-20, &p99_low[i]);
+		err_high |= run_latency(19, &p99_high[i]);
+	}
+
+	if (err_low)
+		ksft_test_result_fail("wakeup latency at latency_nice -20\n");
+	else
+		ksft_test_result_pass("wakeup latency at latency_nice -20\n");
+
+	if (err_high)
+		ksft_test_result_fail("wakeup latency at latency_nice 19\n");
+	else
+		ksft_test_result_pass("wakeup latency at latency_nice 19\n");
+
+	stop_hogs = 1;
+	for (i = 0; i < NR_HOGS; i++)
+		pthread_join(hogs[i], NULL);
+
+	if (err_low || err_high) {
+		ksft_test_result_skip("p99 wakeup latency ordering\n");
+		ksft_finished();
+	}
+
+	med_low = median(p99_low, NR_RUNS);
+	med_high = median(p99_high, NR_RUNS);
+	ksft_print_msg("median p99 over %d runs: %llu ns at -20, %llu ns at 19\n",
+		       NR_RUNS, (unsigned long long)med_low,
+		       (unsigned long long)med_high);
+
+	if (med_low * 100 > med_high * (100 + P99_MARGIN_PCT))
+		ksft_test_result_fail("p99 wakeup latency ordering\n");
+	else
+		ksft_test_result_pass("p99 wakeup latency ordering\n");
+
+	ksft_finished();
+}